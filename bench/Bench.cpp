@@ -0,0 +1,315 @@
+#include "Bench.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ---- 分配计数 ----
+
+namespace {
+    std::atomic<size_t> allocation_count{0};
+    std::atomic<size_t> allocation_bytes{0};
+
+    void* counted_alloc(size_t size) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* counted_aligned_alloc(size_t size, size_t alignment) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+        if (alignment < sizeof(void*)) alignment = sizeof(void*);
+#if defined(_WIN32)
+        return _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+        void* p = nullptr;
+        return posix_memalign(&p, alignment, size == 0 ? 1 : size) == 0 ? p : nullptr;
+#endif
+    }
+
+    void counted_aligned_free(void* p) {
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+void* operator new(size_t size) {
+    void* p = counted_alloc(size);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    void* p = counted_aligned_alloc(size, static_cast<size_t>(alignment));
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    counted_aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    counted_aligned_free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+    counted_aligned_free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+    counted_aligned_free(p);
+}
+
+namespace Bench {
+    AllocationCount allocations() {
+        return {allocation_count.load(std::memory_order_relaxed), allocation_bytes.load(std::memory_order_relaxed)};
+    }
+
+    // ---- 内存占用 ----
+
+    void reset_peak_rss() {
+#if defined(__linux__)
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        if (clear_refs) clear_refs << "5";
+#endif
+    }
+
+    size_t peak_rss_kb() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS pmc;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return pmc.PeakWorkingSetSize / 1024;
+        return 0;
+#else
+#if defined(__linux__)
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 6, "VmHWM:") == 0) return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+#endif
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#else
+        return static_cast<size_t>(usage.ru_maxrss);
+#endif
+#endif
+    }
+
+    // ---- 输出 ----
+
+    namespace {
+        std::string escape_json(const std::string& text) {
+            std::string out;
+            for (char c : text) {
+                if (c == '"' || c == '\\') out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        double per_op(size_t count, const Result& r) {
+            return static_cast<double>(count) / (static_cast<double>(r.operations) * r.repetitions);
+        }
+
+        void print_header() {
+            std::printf("%-24s %-14s %-7s %9s %11s %11s %10s %12s", "container", "operation", "type", "size",
+                        "ns/op", "min ns/op", "allocs/op", "peak RSS KB");
+            if (stats_enabled) {
+                std::printf(" %9s %9s %9s %9s %9s %9s %9s", "realloc", "moves", "copies", "nodes", "cmp", "rot",
+                            "split");
+            }
+            std::printf("\n");
+        }
+    }
+
+    void Runner::record(Result result) {
+        if (results_.empty()) print_header();
+        std::printf("%-24s %-14s %-7s %9zu %11.2f %11.2f %10.3f %12zu", result.container.c_str(),
+                    result.operation.c_str(), result.type.c_str(), result.size, result.ns_per_op,
+                    result.min_ns_per_op, result.allocs_per_op, result.peak_rss_kb);
+        if (stats_enabled) {
+            const Linear::stats::Counters& c = result.counters;
+            std::printf(" %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f", per_op(c.reallocations, result),
+                        per_op(c.moves, result), per_op(c.copies, result), per_op(c.node_allocations, result),
+                        per_op(c.comparisons, result), per_op(c.rotations, result), per_op(c.splits, result));
+        }
+        std::printf("\n");
+        std::fflush(stdout);
+        results_.push_back(std::move(result));
+    }
+
+    void Runner::write_csv(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "cannot open " << path << std::endl;
+            return;
+        }
+        out << "container,operation,type,size,operations,repetitions,ns_per_op,min_ns_per_op,"
+               "allocs_per_op,bytes_per_op,peak_rss_kb";
+        if (stats_enabled) {
+            out << ",reallocations_per_op,moves_per_op,copies_per_op,node_allocations_per_op,comparisons_per_op,"
+                   "rotations_per_op,splits_per_op";
+        }
+        out << '\n';
+        for (const Result& r : results_) {
+            out << r.container << ',' << r.operation << ',' << r.type << ',' << r.size << ',' << r.operations << ','
+                << r.repetitions << ',' << r.ns_per_op << ',' << r.min_ns_per_op << ',' << r.allocs_per_op << ','
+                << r.bytes_per_op << ',' << r.peak_rss_kb;
+            if (stats_enabled) {
+                const Linear::stats::Counters& c = r.counters;
+                out << ',' << per_op(c.reallocations, r) << ',' << per_op(c.moves, r) << ',' << per_op(c.copies, r)
+                    << ',' << per_op(c.node_allocations, r) << ',' << per_op(c.comparisons, r) << ','
+                    << per_op(c.rotations, r) << ',' << per_op(c.splits, r);
+            }
+            out << '\n';
+        }
+    }
+
+    void Runner::write_json(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "cannot open " << path << std::endl;
+            return;
+        }
+        out << "{\n  \"warmup\": " << options_.warmup << ",\n  \"repetitions\": " << options_.repetitions
+            << ",\n  \"results\": [";
+        for (size_t i = 0; i < results_.size(); i++) {
+            const Result& r = results_[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"container\": \"" << escape_json(r.container)
+                << "\", \"operation\": \"" << escape_json(r.operation) << "\", \"type\": \"" << escape_json(r.type)
+                << "\", \"size\": " << r.size << ", \"operations\": " << r.operations
+                << ", \"ns_per_op\": " << r.ns_per_op << ", \"min_ns_per_op\": " << r.min_ns_per_op
+                << ", \"allocs_per_op\": " << r.allocs_per_op << ", \"bytes_per_op\": " << r.bytes_per_op
+                << ", \"peak_rss_kb\": " << r.peak_rss_kb;
+            if (stats_enabled) {
+                const Linear::stats::Counters& c = r.counters;
+                out << ", \"reallocations_per_op\": " << per_op(c.reallocations, r)
+                    << ", \"moves_per_op\": " << per_op(c.moves, r) << ", \"copies_per_op\": " << per_op(c.copies, r)
+                    << ", \"node_allocations_per_op\": " << per_op(c.node_allocations, r)
+                    << ", \"comparisons_per_op\": " << per_op(c.comparisons, r)
+                    << ", \"rotations_per_op\": " << per_op(c.rotations, r)
+                    << ", \"splits_per_op\": " << per_op(c.splits, r);
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    void Runner::finish() const {
+        if (!options_.csv_path.empty()) write_csv(options_.csv_path);
+        if (!options_.json_path.empty()) write_json(options_.json_path);
+    }
+}
+
+// ---- 主函数 ----
+
+namespace {
+    void usage(const char* program) {
+        std::cout << "usage: " << program << " [options]\n"
+                  << "  --sizes N,N,...   element counts (default 1000,100000,1000000)\n"
+                  << "  --reps N          timed repetitions per case (default 5)\n"
+                  << "  --warmup N        untimed repetitions per case (default 1)\n"
+                  << "  --filter TEXT     run only cases whose container/operation/type contains TEXT\n"
+                  << "  --suite NAME      linear, tree or all (default all)\n"
+                  << "  --csv PATH        also write results as CSV\n"
+                  << "  --json PATH       also write results as JSON\n"
+                  << "  --quick           same as --sizes 1000,10000 --reps 3 --warmup 1\n";
+    }
+
+    std::vector<size_t> parse_sizes(const std::string& text) {
+        std::vector<size_t> sizes;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (!item.empty()) sizes.push_back(std::strtoull(item.c_str(), nullptr, 10));
+        }
+        return sizes;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Bench::Options options;
+    std::string suite = "all";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--sizes" && has_value) {
+            options.sizes = parse_sizes(argv[++i]);
+        } else if (arg == "--reps" && has_value) {
+            options.repetitions = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--warmup" && has_value) {
+            options.warmup = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--filter" && has_value) {
+            options.filter = argv[++i];
+        } else if (arg == "--suite" && has_value) {
+            suite = argv[++i];
+        } else if (arg == "--csv" && has_value) {
+            options.csv_path = argv[++i];
+        } else if (arg == "--json" && has_value) {
+            options.json_path = argv[++i];
+        } else if (arg == "--quick") {
+            options.sizes = {1000, 10000};
+            options.repetitions = 3;
+            options.warmup = 1;
+        } else {
+            usage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    Bench::Runner runner(options);
+    if (suite == "all" || suite == "linear") Bench::linear_suite(runner);
+    if (suite == "all" || suite == "tree") Bench::tree_suite(runner);
+    runner.finish();
+    return 0;
+}
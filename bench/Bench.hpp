@@ -0,0 +1,214 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Linear/Stats.hpp"
+
+namespace Bench {
+    // 当前为止经过全局 operator new 的分配次数与字节数（计数器在 Bench.cpp 中替换的 operator new 里累加）
+    struct AllocationCount {
+        size_t count;
+        size_t bytes;
+    };
+
+    AllocationCount allocations();
+
+    // 把进程的峰值常驻内存重置为当前值。Linux 上写 /proc/self/clear_refs，其他平台无法重置
+    void reset_peak_rss();
+    // 峰值常驻内存（KB）：Linux 读 /proc/self/status 的 VmHWM，其他 POSIX 平台用 getrusage，Windows 用 PeakWorkingSetSize
+    size_t peak_rss_kb();
+
+    // 让编译器认为 value 被读取且可能被修改，防止基准循环被整体优化掉
+    template <typename T>
+    inline void keep(T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile const void* sink;
+        sink = &value;
+#else
+        asm volatile("" : : "g"(&value) : "memory");
+#endif
+    }
+
+    template <typename T>
+    inline void keep(const T& value) {
+        keep(const_cast<T&>(value));
+    }
+
+    // 由 64 位整数生成元素。字符串固定 24 字符，超出常见实现的短字符串缓冲，每个元素都有一次堆分配
+    template <typename T>
+    T make_value(uint64_t x);
+
+    template <>
+    inline int make_value<int>(uint64_t x) {
+        return static_cast<int>(x & 0x7fffffff);
+    }
+
+    template <>
+    inline std::string make_value<std::string>(uint64_t x) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "key-%020llu", static_cast<unsigned long long>(x));
+        return buffer;
+    }
+
+    template <typename T>
+    const char* type_name();
+
+    template <>
+    inline const char* type_name<int>() {
+        return "int";
+    }
+
+    template <>
+    inline const char* type_name<std::string>() {
+        return "string";
+    }
+
+    // 遍历时从元素提取的数值，累加后交给 keep
+    inline size_t weight(int value) {
+        return static_cast<size_t>(value);
+    }
+
+    inline size_t weight(const std::string& value) {
+        return value.size() + static_cast<unsigned char>(value.back());
+    }
+
+    // 可复现的 splitmix64 序列
+    class Random {
+    private:
+        uint64_t state_;
+
+    public:
+        explicit Random(uint64_t seed = 0x9e3779b97f4a7c15ULL) : state_(seed) {}
+
+        uint64_t operator()() {
+            uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+    };
+
+    // n 个互不相同、顺序随机的元素
+    template <typename T>
+    std::vector<T> distinct_values(size_t n, uint64_t seed = 1) {
+        std::vector<uint64_t> raw(n);
+        for (size_t i = 0; i < n; i++) raw[i] = i * 2 + 1;
+        Random rng(seed);
+        for (size_t i = n; i > 1; i--) std::swap(raw[i - 1], raw[rng() % i]);
+        std::vector<T> values;
+        values.reserve(n);
+        for (uint64_t x : raw) values.push_back(make_value<T>(x));
+        return values;
+    }
+
+    struct Result {
+        std::string container;
+        std::string operation;
+        std::string type;
+        size_t size;
+        size_t operations;      // 每次重复中计时的操作数
+        size_t repetitions;
+        double ns_per_op;       // 各次重复的中位数
+        double min_ns_per_op;
+        double allocs_per_op;
+        double bytes_per_op;
+        size_t peak_rss_kb;
+        // 计时重复中容器自身记录的操作计数之和，仅在定义 BASESTRUCT_STATS 时非零（见 Linear/Stats.hpp）
+        Linear::stats::Counters counters;
+    };
+
+    // 以 BASESTRUCT_STATS 构建时，基准中默认策略的容器都会计数，输出中附加每次操作的计数
+    inline constexpr bool stats_enabled = Linear::stats::enabled<Linear::stats::default_policy>;
+
+    struct Options {
+        size_t warmup = 1;
+        size_t repetitions = 5;
+        std::vector<size_t> sizes = {1000, 100000, 1000000};
+        std::string filter;     // 只运行 "容器/操作/类型" 中包含此子串的用例
+        std::string csv_path;
+        std::string json_path;
+    };
+
+    class Runner {
+    private:
+        Options options_;
+        std::vector<Result> results_;
+
+        void record(Result result);
+
+    public:
+        explicit Runner(Options options) : options_(std::move(options)) {}
+
+        const std::vector<size_t>& sizes() const {
+            return options_.sizes;
+        }
+
+        const std::vector<Result>& results() const {
+            return results_;
+        }
+
+        bool enabled(const std::string& container, const std::string& operation, const std::string& type) const {
+            if (options_.filter.empty()) return true;
+            return (container + "/" + operation + "/" + type).find(options_.filter) != std::string::npos;
+        }
+
+        // 每次重复先调用 setup() 在计时区外构造夹具，再对夹具计时执行 body(fixture)，
+        // body 完成 operations 次操作。预热的重复不计入结果；夹具的析构也不计时
+        template <typename Setup, typename Body>
+        void run(const std::string& container, const std::string& operation, const std::string& type,
+                 size_t size, size_t operations, Setup setup, Body body) {
+            using clock = std::chrono::steady_clock;
+            if (!enabled(container, operation, type) || operations == 0) return;
+
+            reset_peak_rss();
+            std::vector<double> samples;
+            AllocationCount allocated = {0, 0};
+            Linear::stats::Counters counted;
+            for (size_t rep = 0; rep < options_.warmup + options_.repetitions; rep++) {
+                auto fixture = setup();
+                Linear::stats::Counters counters_before;
+                if constexpr (stats_enabled) counters_before = Linear::stats::registry().total();
+                AllocationCount before = allocations();
+                auto start = clock::now();
+                body(fixture);
+                auto stop = clock::now();
+                AllocationCount after = allocations();
+                if (rep < options_.warmup) continue;
+                samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / operations);
+                allocated.count += after.count - before.count;
+                allocated.bytes += after.bytes - before.bytes;
+                if constexpr (stats_enabled) counted += Linear::stats::registry().total() - counters_before;
+            }
+
+            std::sort(samples.begin(), samples.end());
+            double total = static_cast<double>(operations) * options_.repetitions;
+            record({container, operation, type, size, operations, options_.repetitions,
+                    samples[samples.size() / 2], samples.front(),
+                    allocated.count / total, allocated.bytes / total, peak_rss_kb(), counted});
+        }
+
+        // 只读操作：数据结构在调用前构造一次，各次重复共用
+        template <typename Body>
+        void run(const std::string& container, const std::string& operation, const std::string& type,
+                 size_t size, size_t operations, Body body) {
+            run(container, operation, type, size, operations, [] { return 0; }, [&](int) { body(); });
+        }
+
+        void write_csv(const std::string& path) const;
+        void write_json(const std::string& path) const;
+        void finish() const;
+    };
+
+    // 各组用例，定义在 LinearBench.cpp 与 TreeBench.cpp
+    void linear_suite(Runner& runner);
+    void tree_suite(Runner& runner);
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include "Bench.hpp"
+
+#include "Linear/DoublyList.hpp"
+#include "Linear/UnrolledList.hpp"
+#include "Linear/Vector.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <memory>
+#include <vector>
+
+// 线性容器与对应的标准容器：Vector 对 std::vector，DoublyList 对 std::list，
+// UnrolledList 对 std::deque（同为分块存放）。每组测 push_back、中间插入、中间删除、遍历、排序，
+// 链表另测两个有序链表的合并
+
+namespace {
+    using Bench::Runner;
+
+    template <typename Seq>
+    struct IsList : std::false_type {};
+
+    template <typename T, typename Alloc, typename Stats>
+    struct IsList<Linear::DoublyList<T, Alloc, Stats>> : std::true_type {};
+
+    template <typename T, size_t N, typename Alloc>
+    struct IsList<Linear::UnrolledList<T, N, Alloc>> : std::true_type {};
+
+    template <typename T, typename Alloc>
+    struct IsList<std::list<T, Alloc>> : std::true_type {};
+
+    // ---- 中间位置的插入与删除 ----
+    // 随机访问容器用下标定位，链表用迭代器；插入后游标指向新元素之后的原位置或新元素本身，
+    // 删除后指向被删元素的后继，连续操作始终停留在中间附近
+
+    template <typename T, typename Alloc, typename Growth, typename Stats>
+    size_t middle(Linear::Vector<T, Alloc, Growth, Stats>& seq) {
+        return seq.size() / 2;
+    }
+
+    template <typename T, typename Alloc, typename Growth, typename Stats>
+    size_t insert_at(Linear::Vector<T, Alloc, Growth, Stats>& seq, size_t pos, const T& value) {
+        seq.insert(pos, value);
+        return pos;
+    }
+
+    template <typename T, typename Alloc, typename Growth, typename Stats>
+    size_t erase_at(Linear::Vector<T, Alloc, Growth, Stats>& seq, size_t pos) {
+        seq.erase(pos);
+        return pos;
+    }
+
+    template <typename Seq>
+    size_t middle_index(Seq& seq) {
+        return seq.size() / 2;
+    }
+
+    template <typename T, typename Alloc>
+    size_t middle(std::vector<T, Alloc>& seq) {
+        return middle_index(seq);
+    }
+
+    template <typename T, typename Alloc>
+    size_t middle(std::deque<T, Alloc>& seq) {
+        return middle_index(seq);
+    }
+
+    template <typename Seq, typename T>
+    size_t insert_index(Seq& seq, size_t pos, const T& value) {
+        seq.insert(seq.begin() + pos, value);
+        return pos;
+    }
+
+    template <typename Seq>
+    size_t erase_index(Seq& seq, size_t pos) {
+        seq.erase(seq.begin() + pos);
+        return pos;
+    }
+
+    template <typename T, typename Alloc>
+    size_t insert_at(std::vector<T, Alloc>& seq, size_t pos, const T& value) {
+        return insert_index(seq, pos, value);
+    }
+
+    template <typename T, typename Alloc>
+    size_t erase_at(std::vector<T, Alloc>& seq, size_t pos) {
+        return erase_index(seq, pos);
+    }
+
+    template <typename T, typename Alloc>
+    size_t insert_at(std::deque<T, Alloc>& seq, size_t pos, const T& value) {
+        return insert_index(seq, pos, value);
+    }
+
+    template <typename T, typename Alloc>
+    size_t erase_at(std::deque<T, Alloc>& seq, size_t pos) {
+        return erase_index(seq, pos);
+    }
+
+    // 链表的迭代器不一定满足 std::advance 的要求，逐个前进
+    template <typename List>
+    auto middle_iterator(List& list) {
+        auto it = list.begin();
+        for (size_t i = list.size() / 2; i > 0; i--) ++it;
+        return it;
+    }
+
+    template <typename T, typename Alloc, typename Stats>
+    auto middle(Linear::DoublyList<T, Alloc, Stats>& list) {
+        return middle_iterator(list);
+    }
+
+    template <typename T, typename Alloc, typename Stats>
+    Linear::DoublyListIterator<T> insert_at(Linear::DoublyList<T, Alloc, Stats>& list,
+                                            Linear::DoublyListIterator<T> pos, const T& value) {
+        list.insert(value, pos);
+        return pos;
+    }
+
+    template <typename T, typename Alloc, typename Stats>
+    Linear::DoublyListIterator<T> erase_at(Linear::DoublyList<T, Alloc, Stats>& list,
+                                           Linear::DoublyListIterator<T> pos) {
+        Linear::DoublyListIterator<T> next = pos;
+        ++next;
+        list.erase(pos);
+        return next;
+    }
+
+    template <typename T, size_t N, typename Alloc>
+    auto middle(Linear::UnrolledList<T, N, Alloc>& list) {
+        return middle_iterator(list);
+    }
+
+    template <typename T, size_t N, typename Alloc>
+    Linear::UnrolledListIterator<T, N> insert_at(Linear::UnrolledList<T, N, Alloc>& list,
+                                                 Linear::UnrolledListIterator<T, N> pos, const T& value) {
+        return list.insert(value, pos);
+    }
+
+    template <typename T, size_t N, typename Alloc>
+    Linear::UnrolledListIterator<T, N> erase_at(Linear::UnrolledList<T, N, Alloc>& list,
+                                                Linear::UnrolledListIterator<T, N> pos) {
+        return list.erase(pos);
+    }
+
+    template <typename T, typename Alloc>
+    auto middle(std::list<T, Alloc>& list) {
+        return middle_iterator(list);
+    }
+
+    template <typename T, typename Alloc>
+    typename std::list<T, Alloc>::iterator insert_at(std::list<T, Alloc>& list,
+                                                     typename std::list<T, Alloc>::iterator pos, const T& value) {
+        return list.insert(pos, value);
+    }
+
+    template <typename T, typename Alloc>
+    typename std::list<T, Alloc>::iterator erase_at(std::list<T, Alloc>& list,
+                                                    typename std::list<T, Alloc>::iterator pos) {
+        return list.erase(pos);
+    }
+
+    // ---- 排序 ----
+
+    template <typename Seq>
+    void sort_all(Seq& seq) {
+        if constexpr (IsList<Seq>::value) {
+            seq.sort();
+        } else {
+            std::sort(seq.begin(), seq.end());
+        }
+    }
+
+    template <typename T, typename Alloc, typename Growth, typename Stats>
+    void sort_all(Linear::Vector<T, Alloc, Growth, Stats>& seq) {
+        seq.sort();
+    }
+
+    // ---- 用例 ----
+
+    template <typename Seq, typename T>
+    void append_values(Seq& seq, const std::vector<T>& values, size_t count) {
+        for (size_t i = 0; i < count; i++) seq.push_back(values[i]);
+    }
+
+    template <typename Seq, typename T>
+    Seq make_filled(const std::vector<T>& values) {
+        Seq seq;
+        append_values(seq, values, values.size());
+        return seq;
+    }
+
+    // 装满的容器和指向其中间的游标。链表迭代器不能默认构造，游标在容器填好后才能初始化
+    template <typename Seq>
+    struct Positioned {
+        Seq seq;
+        decltype(middle(std::declval<Seq&>())) pos;
+
+        template <typename T>
+        explicit Positioned(const std::vector<T>& values) : seq(make_filled<Seq>(values)), pos(middle(seq)) {}
+    };
+
+    template <typename Seq, typename T>
+    void sequence_cases(Runner& runner, const char* name, const std::vector<T>& values) {
+        const char* type = Bench::type_name<T>();
+        size_t n = values.size();
+
+        runner.run(name, "push_back", type, n, n, [] { return Seq(); },
+                   [&](Seq& seq) { append_values(seq, values, n); });
+
+        // 随机访问容器的中间插入是 O(n)，控制总搬移量；链表每次 O(1)，做满 n/2 次
+        size_t edits = IsList<Seq>::value ? std::max<size_t>(1, n / 2)
+                                          : std::max<size_t>(1, std::min<size_t>(n / 2, 20000000 / n));
+        auto positioned = [&] { return std::make_unique<Positioned<Seq>>(values); };
+        runner.run(name, "insert_middle", type, n, edits, positioned, [&](std::unique_ptr<Positioned<Seq>>& fixture) {
+            for (size_t i = 0; i < edits; i++) fixture->pos = insert_at(fixture->seq, fixture->pos, values[i]);
+        });
+        runner.run(name, "erase_middle", type, n, edits, positioned, [&](std::unique_ptr<Positioned<Seq>>& fixture) {
+            for (size_t i = 0; i < edits; i++) fixture->pos = erase_at(fixture->seq, fixture->pos);
+        });
+
+        {
+            Seq seq = make_filled<Seq>(values);
+            runner.run(name, "iterate", type, n, n, [&] {
+                size_t sum = 0;
+                for (auto it = seq.begin(); it != seq.end(); ++it) sum += Bench::weight(*it);
+                Bench::keep(sum);
+            });
+        }
+
+        runner.run(name, "sort", type, n, n, [&] { return make_filled<Seq>(values); }, [](Seq& seq) { sort_all(seq); });
+
+        if constexpr (IsList<Seq>::value) {
+            // 两个各含一半元素的有序链表交错合并
+            auto sorted_pair = [&] {
+                std::vector<T> sorted(values);
+                std::sort(sorted.begin(), sorted.end());
+                auto fixture = std::make_unique<std::pair<Seq, Seq>>();
+                for (size_t i = 0; i < n; i++) (i % 2 == 0 ? fixture->first : fixture->second).push_back(sorted[i]);
+                return fixture;
+            };
+            runner.run(name, "merge", type, n, n, sorted_pair,
+                       [](std::unique_ptr<std::pair<Seq, Seq>>& fixture) { fixture->first.merge(fixture->second); });
+        }
+    }
+
+    template <typename T>
+    void linear_cases(Runner& runner) {
+        for (size_t n : runner.sizes()) {
+            std::vector<T> values = Bench::distinct_values<T>(n);
+            sequence_cases<Linear::Vector<T>>(runner, "Linear::Vector", values);
+            sequence_cases<std::vector<T>>(runner, "std::vector", values);
+            sequence_cases<Linear::DoublyList<T>>(runner, "Linear::DoublyList", values);
+            sequence_cases<std::list<T>>(runner, "std::list", values);
+            sequence_cases<Linear::UnrolledList<T>>(runner, "Linear::UnrolledList", values);
+            sequence_cases<std::deque<T>>(runner, "std::deque", values);
+        }
+    }
+}
+
+namespace Bench {
+    void linear_suite(Runner& runner) {
+        linear_cases<int>(runner);
+        linear_cases<std::string>(runner);
+    }
+}
@@ -0,0 +1,177 @@
+#include "Bench.hpp"
+
+#include "Tree/AVLTree.hpp"
+#include "Tree/B+_Tree.hpp"
+#include "Tree/B_Tree.hpp"
+#include "Tree/BinarySearchTree.hpp"
+#include "Tree/Heap.hpp"
+#include "Tree/RedBlackTree.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <queue>
+#include <vector>
+
+// 有序映射与 std::map：随机键插入、随机顺序查找、删除一半的键、按键序遍历；
+// 只读的 FrozenSearchTree 与有序数组上的 std::lower_bound 比较查找；Heap 与 std::priority_queue 比较入堆和出堆
+
+namespace {
+    using Bench::Runner;
+
+    template <typename Map, typename K>
+    bool contains(Map& map, const K& key) {
+        return map.find(key) != map.end();
+    }
+
+    template <typename K, typename V, size_t Order, typename Compare, typename Alloc, typename Search,
+              typename Stats>
+    bool contains(Tree::BTree<K, V, Order, Compare, Alloc, Search, Stats>& map, const K& key) {
+        return map.find(key) != nullptr;
+    }
+
+    template <typename Map>
+    size_t scan(Map& map) {
+        size_t sum = 0;
+        for (auto it = map.begin(); it != map.end(); ++it) sum += Bench::weight((*it).first);
+        return sum;
+    }
+
+    // BTree 没有迭代器，用它的 for_each
+    template <typename K, typename V, size_t Order, typename Compare, typename Alloc, typename Search,
+              typename Stats>
+    size_t scan(Tree::BTree<K, V, Order, Compare, Alloc, Search, Stats>& map) {
+        size_t sum = 0;
+        map.for_each([&](const K& key, const V&) { sum += Bench::weight(key); });
+        return sum;
+    }
+
+    template <typename Map, typename K>
+    void map_cases(Runner& runner, const char* name, const std::vector<K>& keys, const std::vector<K>& probes) {
+        const char* type = Bench::type_name<K>();
+        size_t n = keys.size();
+        auto filled = [&] {
+            auto map = std::make_unique<Map>();
+            for (size_t i = 0; i < n; i++) map->insert(keys[i], static_cast<int>(i));
+            return map;
+        };
+
+        runner.run(name, "insert", type, n, n, [] { return std::make_unique<Map>(); }, [&](std::unique_ptr<Map>& map) {
+            for (size_t i = 0; i < n; i++) map->insert(keys[i], static_cast<int>(i));
+        });
+
+        size_t erased = std::max<size_t>(1, n / 2);
+        runner.run(name, "erase", type, n, erased, filled, [&](std::unique_ptr<Map>& map) {
+            for (size_t i = 0; i < erased; i++) map->erase(probes[i]);
+        });
+
+        std::unique_ptr<Map> map = filled();
+        runner.run(name, "lookup", type, n, n, [&] {
+            size_t hits = 0;
+            for (const K& key : probes) hits += contains(*map, key);
+            Bench::keep(hits);
+        });
+        runner.run(name, "iterate", type, n, n, [&] {
+            size_t sum = scan(*map);
+            Bench::keep(sum);
+        });
+    }
+
+    // std::map 的 insert 接受 pair，包一层与其他树一致的接口
+    template <typename K>
+    struct StdMap : std::map<K, int> {
+        void insert(const K& key, int value) {
+            std::map<K, int>::emplace(key, value);
+        }
+    };
+
+    template <typename K>
+    void frozen_cases(Runner& runner, const std::vector<K>& keys, const std::vector<K>& probes) {
+        const char* type = Bench::type_name<K>();
+        size_t n = keys.size();
+        std::vector<std::pair<K, int>> sorted;
+        sorted.reserve(n);
+        for (size_t i = 0; i < n; i++) sorted.emplace_back(keys[i], static_cast<int>(i));
+        std::sort(sorted.begin(), sorted.end());
+
+        auto lookups = [&](const char* name, auto& frozen) {
+            runner.run(name, "lookup", type, n, n, [&] {
+                size_t hits = 0;
+                for (const K& key : probes) hits += frozen.contains(key);
+                Bench::keep(hits);
+            });
+        };
+        {
+            Tree::FrozenSearchTree<K, int, std::less<K>, Tree::SearchLayout::eytzinger> frozen(sorted.begin(),
+                                                                                            sorted.end());
+            lookups("Tree::Frozen<eytzinger>", frozen);
+        }
+        {
+            Tree::FrozenSearchTree<K, int, std::less<K>, Tree::SearchLayout::van_emde_boas> frozen(sorted.begin(),
+                                                                                                sorted.end());
+            lookups("Tree::Frozen<vEB>", frozen);
+        }
+
+        std::vector<K> sorted_keys;
+        sorted_keys.reserve(n);
+        for (const auto& item : sorted) sorted_keys.push_back(item.first);
+        runner.run("std::lower_bound", "lookup", type, n, n, [&] {
+            size_t hits = 0;
+            for (const K& key : probes) {
+                auto it = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), key);
+                hits += it != sorted_keys.end() && !(key < *it);
+            }
+            Bench::keep(hits);
+        });
+    }
+
+    template <typename Queue, typename T>
+    void heap_cases(Runner& runner, const char* name, const std::vector<T>& values) {
+        const char* type = Bench::type_name<T>();
+        size_t n = values.size();
+        runner.run(name, "push", type, n, n, [] { return std::make_unique<Queue>(); }, [&](std::unique_ptr<Queue>& queue) {
+            for (const T& value : values) queue->push(value);
+        });
+        auto filled = [&] {
+            auto queue = std::make_unique<Queue>();
+            for (const T& value : values) queue->push(value);
+            return queue;
+        };
+        runner.run(name, "pop", type, n, n, filled, [&](std::unique_ptr<Queue>& queue) {
+            size_t sum = 0;
+            for (size_t i = 0; i < n; i++) {
+                sum += Bench::weight(queue->top());
+                queue->pop();
+            }
+            Bench::keep(sum);
+        });
+    }
+
+    template <typename K>
+    void tree_cases(Runner& runner) {
+        for (size_t n : runner.sizes()) {
+            std::vector<K> keys = Bench::distinct_values<K>(n, 1);
+            // 同一组键的另一种随机顺序，查找与删除不沿插入顺序进行
+            std::vector<K> probes(keys);
+            Bench::Random rng(7);
+            for (size_t i = n; i > 1; i--) std::swap(probes[i - 1], probes[rng() % i]);
+
+            map_cases<Tree::RedBlackTree<K, int>>(runner, "Tree::RedBlackTree", keys, probes);
+            map_cases<Tree::AVLTree<K, int>>(runner, "Tree::AVLTree", keys, probes);
+            map_cases<Tree::BinarySearchTree<K, int>>(runner, "Tree::BinarySearchTree", keys, probes);
+            map_cases<Tree::BTree<K, int>>(runner, "Tree::BTree", keys, probes);
+            map_cases<Tree::BPlusTree<K, int>>(runner, "Tree::BPlusTree", keys, probes);
+            map_cases<StdMap<K>>(runner, "std::map", keys, probes);
+            frozen_cases(runner, keys, probes);
+            heap_cases<Tree::Heap<K>>(runner, "Tree::Heap", keys);
+            heap_cases<std::priority_queue<K>>(runner, "std::priority_queue", keys);
+        }
+    }
+}
+
+namespace Bench {
+    void tree_suite(Runner& runner) {
+        tree_cases<int>(runner);
+        tree_cases<std::string>(runner);
+    }
+}
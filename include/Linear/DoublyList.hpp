@@ -1,10 +1,16 @@
 #ifndef DOUBLY_LIST_HPP
 #define DOUBLY_LIST_HPP
 
+#include <Linear/Execution.hpp>
+#include <Linear/NodePool.hpp>
+#include <Linear/Stats.hpp>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace Linear {
-    template <typename T>
+    template <typename T, typename Alloc, typename Stats>
     class DoublyList;
     template <typename T>
     class DoublyListIterator;
@@ -15,10 +21,14 @@ namespace Linear {
         Node* prev;
         Node* next;
 
-        Node() : data(T()), next(nullptr), prev(nullptr) {}
-        Node(const T& val) : data(val), next(nullptr), prev(nullptr) {}
-        Node(const T& val, Node* next) : data(val), next(next), prev(nullptr) {}
-        Node(const T& val, Node* next, Node* prev) : data(val), next(next), prev(prev) {}
+        Node() : data(T()), prev(nullptr), next(nullptr) {}
+        Node(const T& val) : data(val), prev(nullptr), next(nullptr) {}
+        Node(const T& val, Node* next) : data(val), prev(nullptr), next(next) {}
+        Node(const T& val, Node* next, Node* prev) : data(val), prev(prev), next(next) {}
+        Node(T&& val, Node* next, Node* prev) : data(std::move(val)), prev(prev), next(next) {}
+        template <typename... Args>
+        Node(std::in_place_t, Node* next, Node* prev, Args&&... args)
+            : data(std::forward<Args>(args)...), prev(prev), next(next) {}
 
         bool operator==(const Node& other) const {
             return data == other.data;
@@ -56,117 +66,240 @@ namespace Linear {
             return !(*this == other);
         }
 
-        friend class DoublyList<T>;
+        template <typename, typename, typename>
+        friend class DoublyList;
     };
 
-    template <typename T>
-    class DoublyList {
+    namespace detail {
+        struct doubly_list_stats_name {
+            static constexpr const char* value = "Linear::DoublyList";
+        };
+    }
+
+    // Stats 为计数策略，见 Linear/Stats.hpp；并行排序的比较不计数
+    template <typename T, typename Alloc = std::allocator<T>, typename Stats = stats::default_policy>
+    class DoublyList : private stats::Recorder<Stats, detail::doubly_list_stats_name> {
     private:
-        Node<T>* head_;
-        Node<T>* tail_;
+        // 首尾哨兵直接放在链表对象里，空链表不向池申请内存
+        Node<T> head_;
+        Node<T> tail_;
         size_t size_;
+        NodePool<Node<T>, Alloc> pool_;
 
     private:
-        template <typename Compare>
-        Node<T>* merge_sort(Node<T>* other, Compare& comp) {
-            if (other == tail_ || other->next == tail_) {
-                return other;
+        template <typename... Args>
+        Node<T>* create_node(Args&&... args) {
+            Node<T>* node = pool_.allocate();
+            try {
+                new (node) Node<T>(std::forward<Args>(args)...);
+            } catch (...) {
+                pool_.deallocate(node);
+                throw;
             }
+            return node;
+        }
+        void destroy_node(Node<T>* node) {
+            node->~Node();
+            pool_.deallocate(node);
+        }
 
-            Node<T>* slow = other;
-            Node<T>* fast = other->next;
-            while (fast != tail_ && fast->next != tail_) {
-                slow = slow->next;
-                fast = fast->next->next;
+        // 合并两条以 nullptr 结尾、只维护 next 的有序链，相等时先取 left 以保持稳定
+        template <typename Compare>
+        static Node<T>* merge_runs(Node<T>* left, Node<T>* right, Compare& comp) {
+            Node<T>* first = nullptr;
+            Node<T>** link = &first;
+
+            while (left != nullptr && right != nullptr) {
+                if (comp(right->data, left->data)) {
+                    *link = right;
+                    link = &right->next;
+                    right = right->next;
+                } else {
+                    *link = left;
+                    link = &left->next;
+                    left = left->next;
+                }
             }
+            *link = (left != nullptr) ? left : right;
 
-            Node<T>* mid = slow->next;
-            slow->next = tail_;
-            mid->prev = head_;
-            
-            Node<T>* left = merge_sort(other, comp);
-            Node<T>* right = merge_sort(mid, comp);
-
-            return merge_sort(left, right, comp);
+            return first;
         }
+
+        // 非递归自底向上归并：依次切出自然有序段（严格递减段就地翻转），
+        // 像二进制计数一样放进桶里，bucket[i] 存放 2^i 个段合并的结果
         template <typename Compare>
-        Node<T>* merge_sort(Node<T>* left, Node<T>* right, Compare& comp) {
-            Node<T> dummy;
-            Node<T>* cur = &dummy;
-            
-            while (left != tail_ && right != tail_) {
-                if (comp(left->data, right->data)) {
-                    cur->next = left;
-                    left->prev = cur;
-                    left = left->next;
+        static Node<T>* sort_chain(Node<T>* chain, Compare& comp) {
+            Node<T>* buckets[64] = {};
+            size_t used = 0;
+
+            while (chain != nullptr) {
+                Node<T>* run = chain;
+                chain = chain->next;
+                run->next = nullptr;
+
+                if (chain != nullptr && comp(chain->data, run->data)) {
+                    while (chain != nullptr && comp(chain->data, run->data)) {
+                        Node<T>* next = chain->next;
+                        chain->next = run;
+                        run = chain;
+                        chain = next;
+                    }
                 } else {
-                    cur->next = right;
-                    right->prev = cur;
-                    right = right->next;
+                    Node<T>* last = run;
+                    while (chain != nullptr && !comp(chain->data, last->data)) {
+                        last->next = chain;
+                        last = chain;
+                        chain = chain->next;
+                    }
+                    last->next = nullptr;
                 }
-                cur = cur->next;
+
+                size_t i = 0;
+                for (; i < used && buckets[i] != nullptr; i++) {
+                    run = merge_runs(buckets[i], run, comp);
+                    buckets[i] = nullptr;
+                }
+                if (i == used) used++;
+                buckets[i] = run;
             }
 
-            cur->next = (left != tail_) ? left : right;
-            
-            if (cur->next != tail_) {
-                cur->next->prev = cur;
-            } else {
-                tail_->prev = cur;
+            Node<T>* result = nullptr;
+            for (size_t i = 0; i < used; i++) {
+                if (buckets[i] != nullptr) {
+                    result = (result == nullptr) ? buckets[i] : merge_runs(buckets[i], result, comp);
+                }
             }
+            return result;
+        }
 
-            return dummy.next;
+        // 把以 nullptr 结尾的链接回 head_/tail_ 之间，一次遍历重建 prev
+        void relink(Node<T>* first) {
+            Node<T>* prev = &head_;
+            for (Node<T>* cur = first; cur != nullptr; cur = cur->next) {
+                prev->next = cur;
+                cur->prev = prev;
+                prev = cur;
+            }
+            prev->next = &tail_;
+            tail_.prev = prev;
         }
 
     public:
-        DoublyList() : size_(0) {
-            head_ = new Node<T>();
-            tail_ = new Node<T>();
+        using allocator_type = Alloc;
 
-            head_->next = tail_;
-            tail_->prev = head_;
+        DoublyList() : DoublyList(Alloc()) {}
+        explicit DoublyList(const Alloc& alloc) : size_(0), pool_(alloc) {
+            head_.next = &tail_;
+            tail_.prev = &head_;
         }
         ~DoublyList() {
             clear();
-            delete head_;
-            delete tail_;
         }
 
-        void push_back(const T& val) {
-            Node<T>* cur = new Node<T>(val, tail_, tail_->prev);
+        DoublyList(const DoublyList& other)
+            : DoublyList(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.get_allocator())) {
+            for (Node<T>* cur = other.head_.next; cur != &other.tail_; cur = cur->next) {
+                push_back(cur->data);
+            }
+        }
+        // 连同节点池一起接管，other 留下一个空池
+        DoublyList(DoublyList&& other) noexcept : size_(0), pool_(std::move(other.pool_)) {
+            head_.next = &tail_;
+            tail_.prev = &head_;
+            splice(other);
+        }
 
-            tail_->prev->next = cur;
-            tail_->prev = cur;
+        DoublyList& operator=(const DoublyList& other) {
+            if (this == &other) return *this;
 
-            size_++;
+            // 复用已有节点，只对长度差额做分配或释放
+            Node<T>* cur = head_.next;
+            Node<T>* src = other.head_.next;
+            while (cur != &tail_ && src != &other.tail_) {
+                this->count_copies(1);
+                cur->data = src->data;
+                cur = cur->next;
+                src = src->next;
+            }
+            while (src != &other.tail_) {
+                push_back(src->data);
+                src = src->next;
+            }
+            while (size_ > other.size_) {
+                pop_back();
+            }
+            return *this;
+        }
+        // 不传播分配器；分配器不相等时逐个移动元素
+        DoublyList& operator=(DoublyList&& other) {
+            if (this == &other) return *this;
+
+            clear();
+            if (get_allocator() == other.get_allocator()) {
+                pool_.swap(other.pool_);
+                splice(other);
+            } else {
+                for (Node<T>* cur = other.head_.next; cur != &other.tail_; cur = cur->next) {
+                    emplace_back(std::move(cur->data));
+                }
+                other.clear();
+            }
+            return *this;
+        }
+
+        void push_back(const T& val) {
+            emplace_back(val);
+        }
+        void push_back(T&& val) {
+            emplace_back(std::move(val));
         }
         void push_front(const T& val) {
-            Node<T>* cur = new Node<T>(val, head_->next, head_);
+            emplace_front(val);
+        }
+        void push_front(T&& val) {
+            emplace_front(std::move(val));
+        }
 
-            head_->next->prev = cur;
-            head_->next = cur;
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+        template <typename... Args>
+        T& emplace_front(Args&&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+        template <typename... Args>
+        DoublyListIterator<T> emplace(DoublyListIterator<T> pos, Args&&... args) {
+            Node<T>* target = pos.current_;
+            this->count_node_allocations(1);
+            this->template count_construction<T, Args&&...>();
+            Node<T>* cur = create_node(std::in_place, target, target->prev, std::forward<Args>(args)...);
+
+            target->prev->next = cur;
+            target->prev = cur;
 
             size_++;
+            return DoublyListIterator<T>(cur);
         }
 
         void pop_back() {
             if (empty()) return;
 
-            Node<T>* cur = tail_->prev;
-            tail_->prev = cur->prev;
-            cur->prev->next = tail_;
+            Node<T>* cur = tail_.prev;
+            tail_.prev = cur->prev;
+            cur->prev->next = &tail_;
 
-            delete cur;
+            destroy_node(cur);
             size_--;
         }
         void pop_front() {
             if (empty()) return;
 
-            Node<T>* cur = head_->next;
-            head_->next = cur->next;
-            cur->next->prev = head_;
+            Node<T>* cur = head_.next;
+            head_.next = cur->next;
+            cur->next->prev = &head_;
 
-            delete cur;
+            destroy_node(cur);
             size_--;
         }
 
@@ -174,13 +307,10 @@ namespace Linear {
             push_front(val);
         }
         void insert(const T& val, DoublyListIterator<T> pos) {
-            Node<T>* target = pos.current_;
-            Node<T>* cur = new Node<T>(val, target, target->prev);
-
-            target->prev->next = cur;
-            target->prev = cur;
-
-            size_++;
+            emplace(pos, val);
+        }
+        void insert(T&& val, DoublyListIterator<T> pos) {
+            emplace(pos, std::move(val));
         }
 
         void erase() {
@@ -194,19 +324,19 @@ namespace Linear {
             target->prev->next = target->next;
             target->next->prev = target->prev;
 
-            delete target;
+            destroy_node(target);
             size_--;
         }
 
         T& back() {
             if (empty()) throw std::out_of_range("List is empty");
 
-            return tail_->prev->data;
+            return tail_.prev->data;
         }
         T& front() {
             if (empty()) throw std::out_of_range("List is empty");
 
-            return head_->next->data;
+            return head_.next->data;
         }
         T& at(DoublyListIterator<T> pos) {
             return pos.current_->data;
@@ -222,74 +352,130 @@ namespace Linear {
             return size_;
         }
 
-        void splice(DoublyList<T>& other) {
+        void splice(DoublyList& other) {
             if (other.empty()) return;
             if (empty()) {
-                head_->next = other.head_->next;
-                other.head_->next->prev = head_;
-                tail_->prev = other.tail_->prev;
-                other.tail_->prev->next = tail_;
+                head_.next = other.head_.next;
+                other.head_.next->prev = &head_;
+                tail_.prev = other.tail_.prev;
+                other.tail_.prev->next = &tail_;
             } else {
-                tail_->prev->next = other.head_->next;
-                other.head_->next->prev = tail_->prev;
-                tail_->prev = other.tail_->prev;
-                other.tail_->prev->next = tail_;
+                tail_.prev->next = other.head_.next;
+                other.head_.next->prev = tail_.prev;
+                tail_.prev = other.tail_.prev;
+                other.tail_.prev->next = &tail_;
             }
 
             size_ += other.size_;
 
-            other.head_->next = other.tail_;
-            other.tail_->prev = other.head_;
+            other.head_.next = &other.tail_;
+            other.tail_.prev = &other.head_;
             other.size_ = 0;
         }
-        void splice(DoublyList<T>& other, DoublyListIterator<T> pos) {
+        void splice(DoublyList& other, DoublyListIterator<T> pos) {
             if (other.empty()) return;
             if (pos == end()) {
                 splice(other);
                 return;
             } else {
-                pos.current_->prev->next = other.head_->next;
-                other.head_->next->prev = pos.current_->prev;
-                other.tail_->prev->next = pos.current_;
-                pos.current_->prev = other.tail_->prev;
+                pos.current_->prev->next = other.head_.next;
+                other.head_.next->prev = pos.current_->prev;
+                other.tail_.prev->next = pos.current_;
+                pos.current_->prev = other.tail_.prev;
             }
 
             size_ += other.size_;
 
-            other.head_->next = other.tail_;
-            other.tail_->prev = other.head_;
+            other.head_.next = &other.tail_;
+            other.tail_.prev = &other.head_;
             other.size_ = 0;
         }
 
-        void merge(DoublyList<T>& other) {
+        // 把 other 中 [first, last) 移到 pos 之前；跨链表时需要 O(k) 统计长度
+        void splice(DoublyListIterator<T> pos, DoublyList& other, DoublyListIterator<T> first, DoublyListIterator<T> last) {
+            if (first == last) return;
+
+            size_t count = 0;
+            if (this != &other) {
+                for (DoublyListIterator<T> it = first; it != last; ++it) {
+                    count++;
+                }
+            }
+            splice(pos, other, first, last, count);
+        }
+        // 调用方已知区间长度 count 时为 O(1)
+        void splice(DoublyListIterator<T> pos, DoublyList& other, DoublyListIterator<T> first, DoublyListIterator<T> last,
+                    size_t count) {
+            if (first == last || pos == last) return;
+
+            Node<T>* front = first.current_;
+            Node<T>* back = last.current_->prev;
+            front->prev->next = last.current_;
+            last.current_->prev = front->prev;
+
+            Node<T>* target = pos.current_;
+            front->prev = target->prev;
+            back->next = target;
+            target->prev->next = front;
+            target->prev = back;
+
+            if (this != &other) {
+                size_ += count;
+                other.size_ -= count;
+            }
+        }
+
+        void merge(DoublyList& other) {
             merge(other, [](const T& a, const T& b) { return a < b; });
         }
         template <typename Compare>
-        void merge(DoublyList<T>& other, Compare comp) {
-            if (this == &other) return;
-
-            DoublyListIterator<T> it1 = begin();
-            DoublyListIterator<T> it2 = other.begin();
+        void merge(DoublyList& other, Compare comp) {
+            if (this == &other || other.empty()) return;
+            auto&& less = this->counted(comp);
+
+            // 直接把 other 中连续的一段节点接到 this 中：不分配、不拷贝，相等元素保持 this 在前
+            Node<T>* cur = head_.next;
+            Node<T>* run = other.head_.next;
+            while (cur != &tail_ && run != &other.tail_) {
+                if (!less(run->data, cur->data)) {
+                    cur = cur->next;
+                    continue;
+                }
 
-            while (it2 != other.end()) {
-                if (it1 == end() || comp(*it2, *it1)) {
-                    insert(*it2, it1);
-                    ++it2;
-                } else {
-                    ++it1;
+                Node<T>* run_end = run->next;
+                while (run_end != &other.tail_ && less(run_end->data, cur->data)) {
+                    run_end = run_end->next;
                 }
+                Node<T>* run_last = run_end->prev;
+
+                run->prev = cur->prev;
+                cur->prev->next = run;
+                run_last->next = cur;
+                cur->prev = run_last;
+                run = run_end;
+            }
+            if (run != &other.tail_) {
+                Node<T>* run_last = other.tail_.prev;
+                run->prev = tail_.prev;
+                tail_.prev->next = run;
+                run_last->next = &tail_;
+                tail_.prev = run_last;
             }
+            size_ += other.size_;
 
-            other.clear();
-            other.head_->next = other.tail_;
-            other.tail_->prev = other.head_;
+            other.head_.next = &other.tail_;
+            other.tail_.prev = &other.head_;
+            other.size_ = 0;
         }
 
         void remove(const T& val) {
             DoublyListIterator<T> it = begin();
             while (it != end()) {
                 if (*it == val) {
-                    erase(it);
+                    DoublyListIterator<T> cur = it;
+                    ++it;
+
+                    erase(cur);
                 } else {
                     ++it;
                 }
@@ -314,17 +500,17 @@ namespace Linear {
         void reverse() {
             if (size_ <= 1) return;
 
-            Node<T>* current = head_->next;
-            head_->next = tail_->prev;
-            tail_->prev = current;
+            Node<T>* current = head_.next;
+            head_.next = tail_.prev;
+            tail_.prev = current;
 
-            while (current != tail_) {
+            while (current != &tail_) {
                 std::swap(current->next, current->prev);
                 current = current->prev;
             }
 
-            head_->next->prev = head_;
-            tail_->prev->next = tail_;
+            head_.next->prev = &head_;
+            tail_.prev->next = &tail_;
         }
 
         void sort() {
@@ -334,17 +520,137 @@ namespace Linear {
         void sort(Compare comp) {
             if (size_ <= 1) return;
 
-            Node<T>* data_head = merge_sort(head_->next, comp);
+            tail_.prev->next = nullptr;
+            auto&& less = this->counted(comp);
+            relink(sort_chain(head_.next, less));
+        }
+        void sort(const execution::sequenced_policy& policy) {
+            sort(policy, [](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void sort(const execution::sequenced_policy&, Compare comp) {
+            sort(comp);
+        }
+        void sort(const execution::parallel_policy& policy) {
+            sort(policy, [](const T& a, const T& b) { return a < b; });
+        }
+        // 并行排序：切成 P 段各自排序，再从各段取样选出 P - 1 个分隔值，
+        // 把每段按值域切片后，P 个线程各自对一个值域做 k 路归并
+        template <typename Compare>
+        void sort(const execution::parallel_policy& policy, Compare comp) {
+            size_t threads = detail::resolve_threads(policy, size_);
+            if (threads <= 1) {
+                sort(comp);
+                return;
+            }
+
+            std::vector<Node<T>*> runs(threads);
+            std::vector<size_t> lengths(threads);
+            Node<T>* cur = head_.next;
+            for (size_t i = 0; i < threads; i++) {
+                lengths[i] = size_ * (i + 1) / threads - size_ * i / threads;
+                runs[i] = cur;
+                for (size_t k = 1; k < lengths[i]; k++) {
+                    cur = cur->next;
+                }
+                Node<T>* next = cur->next;
+                cur->next = nullptr;
+                cur = next;
+            }
+
+            std::vector<const T*> samples(threads * threads);
+            detail::parallel_for(threads, [&](size_t i) {
+                runs[i] = sort_chain(runs[i], comp);
+
+                Node<T>* node = runs[i];
+                size_t position = 0;
+                for (size_t k = 0; k < threads; k++) {
+                    size_t target = lengths[i] * (2 * k + 1) / (2 * threads);
+                    for (; position < target; position++) {
+                        node = node->next;
+                    }
+                    samples[i * threads + k] = &node->data;
+                }
+            });
+
+            std::sort(samples.begin(), samples.end(), [&comp](const T* a, const T* b) { return comp(*a, *b); });
+            std::vector<const T*> splitters(threads - 1);
+            for (size_t t = 0; t + 1 < threads; t++) {
+                splitters[t] = samples[(t + 1) * threads];
+            }
 
-            head_->next = data_head;
-            data_head->prev = head_;
+            std::vector<Node<T>*> pieces(threads * threads, nullptr);
+            detail::parallel_for(threads, [&](size_t i) {
+                Node<T>** row = &pieces[i * threads];
+                Node<T>* prev = nullptr;
+                size_t t = 0;
+                row[0] = runs[i];
+                for (Node<T>* node = runs[i]; node != nullptr; node = node->next) {
+                    if (t + 1 < threads && !comp(node->data, *splitters[t])) {
+                        while (t + 1 < threads && !comp(node->data, *splitters[t])) t++;
+                        if (prev != nullptr) {
+                            prev->next = nullptr;
+                        } else {
+                            row[0] = nullptr;
+                        }
+                        row[t] = node;
+                    }
+                    prev = node;
+                }
+            });
+
+            std::vector<Node<T>*> firsts(threads, nullptr);
+            std::vector<Node<T>*> lasts(threads, nullptr);
+            detail::parallel_for(threads, [&](size_t t) {
+                std::vector<Node<T>*> lists(threads);
+                for (size_t i = 0; i < threads; i++) {
+                    lists[i] = pieces[i * threads + t];
+                }
+                for (size_t width = 1; width < threads; width *= 2) {
+                    for (size_t i = 0; i + width < threads; i += 2 * width) {
+                        lists[i] = merge_runs(lists[i], lists[i + width], comp);
+                    }
+                }
+
+                Node<T>* prev = nullptr;
+                for (Node<T>* node = lists[0]; node != nullptr; node = node->next) {
+                    node->prev = prev;
+                    prev = node;
+                }
+                firsts[t] = lists[0];
+                lasts[t] = prev;
+            });
+
+            Node<T>* prev = &head_;
+            for (size_t t = 0; t < threads; t++) {
+                if (firsts[t] == nullptr) continue;
+                prev->next = firsts[t];
+                firsts[t]->prev = prev;
+                prev = lasts[t];
+            }
+            prev->next = &tail_;
+            tail_.prev = prev;
+        }
+
+        Alloc get_allocator() const {
+            return Alloc(pool_.get_allocator());
+        }
+
+        // 归还节点池中完全空闲的内存块
+        void shrink_to_fit() {
+            pool_.shrink_to_fit();
         }
 
         DoublyListIterator<T> end() {
-            return DoublyListIterator<T>(tail_);
+            return DoublyListIterator<T>(&tail_);
         }
         DoublyListIterator<T> begin() {
-            return DoublyListIterator<T>(head_->next);
+            return DoublyListIterator<T>(head_.next);
+        }
+
+        // Stats 为 stats::none 时全为零
+        stats::Counters stats() const {
+            return this->counters();
         }
     };
 }
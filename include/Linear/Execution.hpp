@@ -0,0 +1,154 @@
+#ifndef EXECUTION_HPP
+#define EXECUTION_HPP
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Linear {
+    namespace execution {
+        struct sequenced_policy {};
+
+        // threads 为 0 时使用 std::thread::hardware_concurrency()；
+        // 元素个数低于 threshold 时退化为串行
+        struct parallel_policy {
+            size_t threads = 0;
+            size_t threshold = size_t(1) << 16;
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+    }
+
+    namespace detail {
+        inline size_t resolve_threads(const execution::parallel_policy& policy, size_t size) {
+            size_t threads = policy.threads;
+            if (threads == 0) threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+            if (size < policy.threshold) return 1;
+            return std::min(threads, std::max<size_t>(1, size / 2));
+        }
+
+        // 在 count 个线程上执行 fn(0) ... fn(count - 1)，当前线程承担 fn(0)；
+        // 任务抛出的第一个异常在全部线程结束后重新抛出
+        template <typename Fn>
+        void parallel_for(size_t count, Fn&& fn) {
+            if (count == 0) return;
+
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            auto run = [&](size_t index) {
+                try {
+                    fn(index);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) error = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(count - 1);
+            for (size_t i = 1; i < count; i++) {
+                workers.emplace_back(run, i);
+            }
+            run(0);
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            if (error) std::rethrow_exception(error);
+        }
+
+        // 稳定归并的划分点：返回 i，使得 a[0, i) 与 b[0, diagonal - i) 恰好是合并结果的前 diagonal 个元素
+        template <typename T, typename Compare>
+        size_t merge_path(const T* a, size_t a_size, const T* b, size_t b_size, size_t diagonal, Compare& comp) {
+            size_t lo = diagonal > b_size ? diagonal - b_size : 0;
+            size_t hi = std::min(diagonal, a_size);
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                size_t j = diagonal - mid;
+                if (j > 0 && !comp(b[j - 1], a[mid])) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return lo;
+        }
+
+        // 连续区间的并行归并排序：分块并行 std::sort，再逐轮两两归并，
+        // 每轮按 merge path 把归并切成与线程数相当的独立片段。
+        // buffer 为至少 size 个元素的未初始化内存，由调用方分配和释放。
+        template <typename T, typename Compare>
+        void parallel_sort(T* data, size_t size, T* buffer, Compare comp, size_t threads) {
+            std::vector<size_t> bounds(threads + 1);
+            for (size_t i = 0; i <= threads; i++) {
+                bounds[i] = size * i / threads;
+            }
+
+            // constructed[i] 记录 buffer 中第 i 块是否已构造；comp 或元素的移动抛出异常时
+            // 只析构已构造的块再重新抛出，data 中的元素处于有效但未指定的状态
+            std::vector<char> constructed(threads, 0);
+            try {
+                parallel_for(threads, [&](size_t i) {
+                    std::uninitialized_move(data + bounds[i], data + bounds[i + 1], buffer + bounds[i]);
+                    constructed[i] = 1;
+                    std::sort(buffer + bounds[i], buffer + bounds[i + 1], comp);
+                });
+
+                T* src = buffer;
+                T* dst = data;
+                for (size_t width = 1; width < threads; width *= 2) {
+                    // 先在只读阶段算出全部划分点，归并时源元素会被移走
+                    struct Piece {
+                        size_t a_begin, a_end, b_begin, b_end, out;
+                    };
+                    std::vector<Piece> pieces;
+
+                    for (size_t run = 0; run < threads; run += 2 * width) {
+                        size_t lo = bounds[run];
+                        size_t mid = bounds[std::min(run + width, threads)];
+                        size_t hi = bounds[std::min(run + 2 * width, threads)];
+                        size_t parts = std::max<size_t>(1, threads * (hi - lo) / size);
+
+                        size_t prev = 0;
+                        for (size_t p = 1; p <= parts; p++) {
+                            size_t diagonal = (hi - lo) * p / parts;
+                            size_t split = merge_path(src + lo, mid - lo, src + mid, hi - mid, diagonal, comp);
+                            size_t prev_diagonal = (hi - lo) * (p - 1) / parts;
+                            pieces.push_back(Piece{lo + prev, lo + split, mid + (prev_diagonal - prev), mid + (diagonal - split),
+                                                   lo + prev_diagonal});
+                            prev = split;
+                        }
+                    }
+
+                    parallel_for(pieces.size(), [&](size_t k) {
+                        const Piece& piece = pieces[k];
+                        std::merge(std::make_move_iterator(src + piece.a_begin), std::make_move_iterator(src + piece.a_end),
+                                   std::make_move_iterator(src + piece.b_begin), std::make_move_iterator(src + piece.b_end),
+                                   dst + piece.out, comp);
+                    });
+                    std::swap(src, dst);
+                }
+
+                parallel_for(threads, [&](size_t i) {
+                    if (src != data) {
+                        std::move(src + bounds[i], src + bounds[i + 1], data + bounds[i]);
+                    }
+                    constructed[i] = 0;
+                    std::destroy(buffer + bounds[i], buffer + bounds[i + 1]);
+                });
+            } catch (...) {
+                for (size_t i = 0; i < threads; i++) {
+                    if (constructed[i]) std::destroy(buffer + bounds[i], buffer + bounds[i + 1]);
+                }
+                throw;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef GROWTH_HPP
+#define GROWTH_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Linear {
+    // 扩容策略：next(capacity, required, element_size) 返回不小于 required 的新容量。
+    // 首次分配至少占满 kMinBytes 字节，避免小 Vector 从 1 开始反复扩容。
+    namespace growth {
+        inline constexpr size_t kMinBytes = 32;
+        inline constexpr size_t kPageBytes = 4096;
+
+        inline constexpr size_t first_capacity(size_t element_size) {
+            return std::max<size_t>(1, kMinBytes / element_size);
+        }
+
+        // 2 倍扩容：摊还代价最低，最坏浪费 50% 内存
+        struct doubling {
+            static constexpr size_t next(size_t capacity, size_t required, size_t element_size) {
+                size_t grown = capacity == 0 ? first_capacity(element_size) : capacity * 2;
+                return std::max(grown, required);
+            }
+        };
+
+        // 1.5 倍扩容：最坏浪费约 33%，且释放的旧块之和最终能容纳新块，便于分配器复用
+        struct one_and_half {
+            static constexpr size_t next(size_t capacity, size_t required, size_t element_size) {
+                size_t grown = capacity == 0 ? first_capacity(element_size) : capacity + (capacity + 1) / 2;
+                return std::max(grown, required);
+            }
+        };
+
+        // 按分配器的尺寸档位取整：先按 1.5 倍扩容，再把字节数补齐到所在档位的上界，
+        // 多出的部分本来也会被分配器占用，不如直接用作容量
+        struct size_class {
+            // 小于 128 字节按 16 字节对齐，4 KiB 以内每个 2 的幂区间分 4 档，更大的按页对齐
+            static constexpr size_t round_bytes(size_t bytes) {
+                if (bytes <= 128) return (bytes + 15) / 16 * 16;
+                if (bytes <= kPageBytes) {
+                    size_t power = 128;
+                    while (power * 2 < bytes) power *= 2;
+                    size_t step = power / 4;
+                    return (bytes + step - 1) / step * step;
+                }
+                return (bytes + kPageBytes - 1) / kPageBytes * kPageBytes;
+            }
+
+            static constexpr size_t next(size_t capacity, size_t required, size_t element_size) {
+                size_t count = one_and_half::next(capacity, required, element_size);
+                return round_bytes(count * element_size) / element_size;
+            }
+        };
+    }
+}
+
+#endif
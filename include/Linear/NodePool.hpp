@@ -0,0 +1,287 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Linear {
+    namespace detail {
+        constexpr size_t pool_slab_bytes(size_t header, size_t cell, size_t min_cells) {
+            size_t bytes = 4096;
+            while (bytes < header + cell * min_cells) bytes *= 2;
+            return bytes;
+        }
+
+        // 池的编号，永不复用：slab 以编号而不是地址记录所属的池，池析构后在同一地址新建的池不会误认旧 slab
+        inline uint64_t next_pool_id() {
+            static std::atomic<uint64_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+    }
+
+    // 节点池：按 slab 批量申请节点内存，每个 slab 按自身大小对齐并维护独立的空闲链表，
+    // 释放时通过地址掩码找到所属 slab。节点可以随 splice 在不同容器之间转移：
+    // 由其他池释放的节点不碰所属池的链表和计数，而是无锁压入该 slab 的归还链，
+    // 所属池在 slab 用尽时成批收回，因此交换过节点的容器仍可以在不同线程中各自使用。
+    // 池析构时仍有存活节点的 slab 会被保留，直到最后一个节点释放时再归还。
+    // 只负责原始内存，节点的构造与析构由使用者完成。
+    template <typename NodeT, typename Alloc = std::allocator<NodeT>>
+    class NodePool {
+    private:
+        union Cell {
+            Cell* next;
+            alignas(NodeT) unsigned char storage[sizeof(NodeT)];
+        };
+
+        // owner 之外的字段中，prev、next、free、live 只由所属池读写；
+        // remote 与 orphan_live 供其他池释放节点时使用
+        struct Slab {
+            uint64_t owner;
+            Slab* prev;
+            Slab* next;
+            Cell* free;
+            size_t live;                            // 已分配且未被所属池收回的节点数
+            std::atomic<uintptr_t> remote;          // 其他池释放的节点组成的链，最低位为孤儿标记
+            std::atomic<ptrdiff_t> orphan_live;     // 成为孤儿后尚未释放的节点数
+        };
+
+        static constexpr uintptr_t kOrphaned = 1;
+
+        static constexpr size_t kCellOffset = (sizeof(Slab) + alignof(Cell) - 1) / alignof(Cell) * alignof(Cell);
+        static constexpr size_t kSlabBytes = detail::pool_slab_bytes(kCellOffset, sizeof(Cell), 8);
+        static constexpr size_t kCellsPerSlab = (kSlabBytes - kCellOffset) / sizeof(Cell);
+
+        struct alignas(kSlabBytes) Page {
+            unsigned char bytes[kSlabBytes];
+        };
+
+        using page_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Page>;
+        using page_traits = std::allocator_traits<page_alloc_type>;
+
+        uint64_t id_;
+        Slab* partial_;
+        Slab* full_;
+        size_t slab_count_;
+        size_t live_;
+        size_t collect_at_;
+        page_alloc_type alloc_;
+
+    private:
+        static Slab* slab_of(void* node) {
+            return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(node) & ~static_cast<uintptr_t>(kSlabBytes - 1));
+        }
+        static Cell* cell_at(Slab* slab, size_t index) {
+            return reinterpret_cast<Cell*>(reinterpret_cast<unsigned char*>(slab) + kCellOffset) + index;
+        }
+
+        static void link(Slab*& list, Slab* slab) {
+            slab->prev = nullptr;
+            slab->next = list;
+            if (list != nullptr) list->prev = slab;
+            list = slab;
+        }
+        static void unlink(Slab*& list, Slab* slab) {
+            if (slab->prev != nullptr) {
+                slab->prev->next = slab->next;
+            } else {
+                list = slab->next;
+            }
+            if (slab->next != nullptr) slab->next->prev = slab->prev;
+        }
+
+        void add_slab() {
+            Slab* slab = new (page_traits::allocate(alloc_, 1)) Slab{id_, nullptr, nullptr, nullptr, 0, {0}, {0}};
+
+            // 逆序入链，保证连续分配得到地址递增的节点
+            for (size_t i = kCellsPerSlab; i > 0; i--) {
+                Cell* cell = cell_at(slab, i - 1);
+                cell->next = slab->free;
+                slab->free = cell;
+            }
+
+            link(partial_, slab);
+            slab_count_++;
+        }
+
+        void free_slab(Slab* slab) {
+            slab->~Slab();
+            page_traits::deallocate(alloc_, reinterpret_cast<Page*>(slab), 1);
+        }
+
+        static size_t chain_length(uintptr_t head) {
+            size_t count = 0;
+            for (Cell* cell = reinterpret_cast<Cell*>(head); cell != nullptr; cell = cell->next) count++;
+            return count;
+        }
+
+        // 收回其他池释放到本 slab 的节点
+        void drain(Slab* slab) {
+            if (slab->remote.load(std::memory_order_relaxed) == 0) return;
+            Cell* cell = reinterpret_cast<Cell*>(slab->remote.exchange(0, std::memory_order_acquire));
+            bool was_full = slab->free == nullptr;
+            size_t count = 0;
+            while (cell != nullptr) {
+                Cell* next = cell->next;
+                cell->next = slab->free;
+                slab->free = cell;
+                cell = next;
+                count++;
+            }
+            slab->live -= count;
+            live_ -= count;
+            if (was_full && slab->free != nullptr) {
+                unlink(full_, slab);
+                link(partial_, slab);
+            }
+        }
+
+        // 遍历全部 slab 收回归还链。只在 slab 数比上次收回时增长了 1/8 以后进行，
+        // 摊到每个节点是常数；代价是归还的节点最多要等这么多新 slab 之后才被复用
+        void collect() {
+            for (Slab* list : {full_, partial_}) {
+                while (list != nullptr) {
+                    Slab* next = list->next;
+                    drain(list);
+                    list = next;
+                }
+            }
+            collect_at_ = slab_count_ + slab_count_ / 8 + 1;
+        }
+
+        // 其他池释放节点：slab 仍有所属池时压入归还链；已成孤儿时递减计数，最后一个归还 slab
+        void remote_free(Slab* slab, Cell* cell) {
+            uintptr_t head = slab->remote.load(std::memory_order_relaxed);
+            do {
+                if (head & kOrphaned) {
+                    if (slab->orphan_live.fetch_sub(1, std::memory_order_acq_rel) == 1) free_slab(slab);
+                    return;
+                }
+                cell->next = reinterpret_cast<Cell*>(head);
+            } while (!slab->remote.compare_exchange_weak(head, reinterpret_cast<uintptr_t>(cell),
+                                                         std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        // 池析构时：取走归还链并打上孤儿标记，此后其他池的释放改为递减 orphan_live。
+        // 打标记之前已经递减的释放使 orphan_live 为负，加上剩余节点数后恰好归零的一方归还 slab
+        void orphan(Slab* list) {
+            while (list != nullptr) {
+                Slab* next = list->next;
+                uintptr_t head = list->remote.exchange(kOrphaned, std::memory_order_acq_rel);
+                ptrdiff_t remaining = static_cast<ptrdiff_t>(list->live - chain_length(head));
+                if (list->orphan_live.fetch_add(remaining, std::memory_order_acq_rel) + remaining == 0) {
+                    free_slab(list);
+                }
+                list = next;
+            }
+        }
+
+    public:
+        explicit NodePool(const Alloc& alloc = Alloc())
+            : id_(detail::next_pool_id()), partial_(nullptr), full_(nullptr), slab_count_(0), live_(0),
+              collect_at_(0), alloc_(alloc) {}
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        // 接管 other 的全部 slab 及其编号，other 换上新编号、成为空池
+        NodePool(NodePool&& other) noexcept
+            : id_(other.id_), partial_(other.partial_), full_(other.full_), slab_count_(other.slab_count_),
+              live_(other.live_), collect_at_(other.collect_at_), alloc_(other.alloc_) {
+            other.id_ = detail::next_pool_id();
+            other.partial_ = nullptr;
+            other.full_ = nullptr;
+            other.slab_count_ = 0;
+            other.live_ = 0;
+            other.collect_at_ = 0;
+        }
+
+        // 交换两池的 slab 与编号，要求分配器相等；分配器本身不交换
+        void swap(NodePool& other) noexcept {
+            std::swap(id_, other.id_);
+            std::swap(partial_, other.partial_);
+            std::swap(full_, other.full_);
+            std::swap(slab_count_, other.slab_count_);
+            std::swap(live_, other.live_);
+            std::swap(collect_at_, other.collect_at_);
+        }
+
+        ~NodePool() {
+            orphan(partial_);
+            orphan(full_);
+        }
+
+        NodeT* allocate() {
+            if (partial_ == nullptr) {
+                if (slab_count_ >= collect_at_) collect();
+                if (partial_ == nullptr) add_slab();
+            }
+
+            Slab* slab = partial_;
+            Cell* cell = slab->free;
+            slab->free = cell->next;
+            slab->live++;
+            live_++;
+
+            if (slab->free == nullptr) {
+                unlink(partial_, slab);
+                link(full_, slab);
+            }
+            return reinterpret_cast<NodeT*>(cell->storage);
+        }
+
+        // 节点可以来自任何与本池分配器相等的 NodePool，所属池可能已经析构或正在其他线程中使用
+        void deallocate(NodeT* node) {
+            Slab* slab = slab_of(node);
+            Cell* cell = reinterpret_cast<Cell*>(node);
+            if (slab->owner != id_) {
+                remote_free(slab, cell);
+                return;
+            }
+
+            bool was_full = slab->free == nullptr;
+            cell->next = slab->free;
+            slab->free = cell;
+            slab->live--;
+            live_--;
+            if (was_full) {
+                unlink(full_, slab);
+                link(partial_, slab);
+            }
+        }
+
+        // 收回其他池归还的节点后，归还完全空闲的 slab
+        void shrink_to_fit() {
+            collect();
+            Slab* slab = partial_;
+            while (slab != nullptr) {
+                Slab* next = slab->next;
+                if (slab->live == 0) {
+                    unlink(partial_, slab);
+                    free_slab(slab);
+                    slab_count_--;
+                }
+                slab = next;
+            }
+        }
+
+        size_t slab_count() const {
+            return slab_count_;
+        }
+        size_t capacity() const {
+            return slab_count_ * kCellsPerSlab;
+        }
+        // 其他池释放、尚未收回的节点仍计入
+        size_t live() const {
+            return live_;
+        }
+
+        page_alloc_type get_allocator() const {
+            return alloc_;
+        }
+    };
+}
+
+#endif
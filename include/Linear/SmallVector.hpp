@@ -0,0 +1,259 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <Linear/Vector.hpp>
+
+namespace Linear {
+    // 小缓冲优化的 Vector：前 N 个元素存放在对象内部，超出后才向分配器申请堆内存。
+    // 适合大量短小、长度通常不超过 N 的序列；元素在内联缓冲区时，移动需要逐个搬移元素。
+    template <typename T, size_t N, typename Alloc = std::allocator<T>, typename Growth = growth::doubling>
+    class SmallVector {
+        static_assert(N > 0, "SmallVector needs at least one inline element");
+
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        T* data_;
+        size_t size_;
+        size_t capacity_;
+        Alloc alloc_;
+        alignas(T) unsigned char inline_[N * sizeof(T)];
+
+    private:
+        T* inline_data() {
+            return reinterpret_cast<T*>(inline_);
+        }
+        const T* inline_data() const {
+            return reinterpret_cast<const T*>(inline_);
+        }
+
+        void reset_inline() {
+            data_ = inline_data();
+            size_ = 0;
+            capacity_ = N;
+        }
+
+        void free_heap() {
+            if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+        }
+
+        // 把元素搬到容量为 new_capacity 的新位置：不超过 N 时回到内联缓冲区
+        void move_storage(size_t new_capacity) {
+            T* new_data = new_capacity <= N ? inline_data() : alloc_traits::allocate(alloc_, new_capacity);
+            if (new_data == data_) return;
+
+            detail::relocate(alloc_, new_data, data_, size_);
+            free_heap();
+            data_ = new_data;
+            capacity_ = new_capacity <= N ? N : new_capacity;
+        }
+
+        // 接管 other 的元素：对方在堆上时直接接管指针，在内联缓冲区时逐个搬移
+        void take(SmallVector& other) {
+            if (other.is_inline()) {
+                detail::relocate(alloc_, inline_data(), other.data_, other.size_);
+                data_ = inline_data();
+                capacity_ = N;
+            } else {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+            }
+            size_ = other.size_;
+            other.reset_inline();
+        }
+
+        template <typename... Args>
+        void grow_and_emplace_back(Args&&... args) {
+            size_t new_capacity = Growth::next(capacity_, size_ + 1, sizeof(T));
+            T* new_data = alloc_traits::allocate(alloc_, new_capacity);
+            try {
+                alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                alloc_traits::deallocate(alloc_, new_data, new_capacity);
+                throw;
+            }
+            detail::relocate(alloc_, new_data, data_, size_);
+            free_heap();
+            data_ = new_data;
+            capacity_ = new_capacity;
+        }
+
+    public:
+        using allocator_type = Alloc;
+
+        explicit SmallVector(const Alloc& alloc = Alloc()) : alloc_(alloc) {
+            reset_inline();
+        }
+        explicit SmallVector(size_t count, const T& val, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+            reset_inline();
+            reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                alloc_traits::construct(alloc_, data_ + i, val);
+                size_++;
+            }
+        }
+        SmallVector(const SmallVector& other)
+            : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+            reset_inline();
+            reserve(other.size_);
+            for (size_t i = 0; i < other.size_; i++) {
+                alloc_traits::construct(alloc_, data_ + i, other.data_[i]);
+                size_++;
+            }
+        }
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            : alloc_(std::move(other.alloc_)) {
+            take(other);
+        }
+
+        ~SmallVector() {
+            clear();
+            free_heap();
+        }
+
+        SmallVector& operator=(const SmallVector& other) {
+            if (this == &other) return *this;
+
+            clear();
+            reserve(other.size_);
+            for (size_t i = 0; i < other.size_; i++) {
+                alloc_traits::construct(alloc_, data_ + i, other.data_[i]);
+                size_++;
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) {
+            if (this == &other) return *this;
+
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                free_heap();
+                alloc_ = std::move(other.alloc_);
+                take(other);
+            } else {
+                if (other.is_inline() || alloc_ == other.alloc_) {
+                    free_heap();
+                    take(other);
+                } else {
+                    // 分配器不相等时不能接管对方的堆内存，只能逐个移动元素
+                    reserve(other.size_);
+                    for (size_t i = 0; i < other.size_; i++) {
+                        alloc_traits::construct(alloc_, data_ + i, std::move(other.data_[i]));
+                    }
+                    size_ = other.size_;
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return alloc_;
+        }
+
+        // 元素是否仍在对象内部的缓冲区中
+        bool is_inline() const {
+            return data_ == inline_data();
+        }
+
+        T& operator[](size_t index) {
+            return data_[index];
+        }
+
+        const T& operator[](size_t index) const {
+            return data_[index];
+        }
+
+        T& at(size_t index) {
+            if (index >= size_) throw std::out_of_range("Index is out");
+            return data_[index];
+        }
+
+        void reserve(size_t new_capacity) {
+            if (new_capacity <= capacity_) return;
+            move_storage(new_capacity);
+        }
+
+        // 元素个数不超过 N 时回到内联缓冲区，否则把堆内存收缩到与元素个数相同
+        void shrink_to_fit() {
+            if (is_inline() || size_ == capacity_) return;
+            move_storage(size_);
+        }
+
+        void push_back(const T& val) {
+            emplace_back(val);
+        }
+
+        void push_back(T&& val) {
+            emplace_back(std::move(val));
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (size_ >= capacity_) {
+                grow_and_emplace_back(std::forward<Args>(args)...);
+            } else {
+                alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+            }
+            ++size_;
+            return data_[size_ - 1];
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        size_t capacity() const {
+            return capacity_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        void clear() {
+            for (size_t i = 0; i < size_; i++) {
+                alloc_traits::destroy(alloc_, data_ + i);
+            }
+            size_ = 0;
+        }
+
+        void erase (size_t index) {
+            detail::erase_at(alloc_, data_, size_, index);
+            size_ -= 1;
+        }
+
+        void insert (size_t index, const T& val) {
+            emplace(index, val);
+        }
+
+        void insert (size_t index, T&& val) {
+            emplace(index, std::move(val));
+        }
+
+        template <typename... Args>
+        T& emplace(size_t index, Args&&... args) {
+            if (index == size_) return emplace_back(std::forward<Args>(args)...);
+
+            T temp(std::forward<Args>(args)...);
+            if (size_ >= capacity_) {
+                reserve(Growth::next(capacity_, size_ + 1, sizeof(T)));
+            }
+
+            detail::insert_at(alloc_, data_, size_, index, std::move(temp));
+            size_ += 1;
+            return data_[index];
+        }
+
+        VectorIterator<T> end() {
+            return VectorIterator<T>(data_ + size_);
+        }
+
+        VectorIterator<T> begin() {
+            return VectorIterator<T>(data_);
+        }
+    };
+}
+
+#endif
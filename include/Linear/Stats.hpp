@@ -0,0 +1,286 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <cstddef>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Linear {
+    // 操作计数策略，作为容器的 Stats 模板参数：
+    // none 不计数，容器以空基类持有它，不占空间，所有记录调用都是空的内联函数；
+    // counting 在每个容器实例里计数，并把实例登记到全局注册表，按容器名汇总。
+    // 不指定时默认为 none，定义宏 BASESTRUCT_STATS 后默认为 counting
+    namespace stats {
+        struct Counters {
+            size_t reallocations = 0;       // 连续存储换用新缓冲区的次数
+            size_t relocated_bytes = 0;     // 换缓冲区时搬过去的字节数
+            size_t moves = 0;               // 元素的移动构造与移动赋值，包括扩容搬移和插入删除时的平移
+            size_t copies = 0;              // 元素的复制构造与复制赋值
+            size_t node_allocations = 0;
+            size_t comparisons = 0;
+            size_t rotations = 0;           // 二叉树的旋转；B 树经父节点向兄弟借键也算一次
+            size_t splits = 0;              // B 树节点分裂
+
+            Counters& operator+=(const Counters& other) {
+                reallocations += other.reallocations;
+                relocated_bytes += other.relocated_bytes;
+                moves += other.moves;
+                copies += other.copies;
+                node_allocations += other.node_allocations;
+                comparisons += other.comparisons;
+                rotations += other.rotations;
+                splits += other.splits;
+                return *this;
+            }
+
+            Counters& operator-=(const Counters& other) {
+                reallocations -= other.reallocations;
+                relocated_bytes -= other.relocated_bytes;
+                moves -= other.moves;
+                copies -= other.copies;
+                node_allocations -= other.node_allocations;
+                comparisons -= other.comparisons;
+                rotations -= other.rotations;
+                splits -= other.splits;
+                return *this;
+            }
+
+            friend Counters operator+(Counters a, const Counters& b) {
+                return a += b;
+            }
+
+            friend Counters operator-(Counters a, const Counters& b) {
+                return a -= b;
+            }
+        };
+
+        inline std::ostream& operator<<(std::ostream& os, const Counters& c) {
+            return os << "reallocations=" << c.reallocations << " relocated_bytes=" << c.relocated_bytes
+                      << " moves=" << c.moves << " copies=" << c.copies << " node_allocations=" << c.node_allocations
+                      << " comparisons=" << c.comparisons << " rotations=" << c.rotations << " splits=" << c.splits;
+        }
+
+        struct none {};
+        struct counting {};
+
+#ifdef BASESTRUCT_STATS
+        using default_policy = counting;
+#else
+        using default_policy = none;
+#endif
+
+        template <typename Policy>
+        inline constexpr bool enabled = std::is_same<Policy, counting>::value;
+
+        // 全局注册表：按容器名保存存活实例的计数器，实例析构时把计数并入该名字的历史累计。
+        // 登记与注销加锁；读取存活实例的计数不加锁，其他线程正在修改这些容器时读到的只是近似值
+        class Registry {
+        private:
+            struct Entry {
+                Counters retired;
+                std::set<Counters*> live;
+            };
+
+            mutable std::mutex mutex_;
+            std::map<std::string, Entry> entries_;
+
+            static Counters sum(const Entry& entry) {
+                Counters result = entry.retired;
+                for (const Counters* counters : entry.live) result += *counters;
+                return result;
+            }
+
+        public:
+            void attach(const char* name, Counters* counters) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                entries_[name].live.insert(counters);
+            }
+
+            void detach(const char* name, Counters* counters) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                Entry& entry = entries_[name];
+                entry.live.erase(counters);
+                entry.retired += *counters;
+            }
+
+            // 某个容器名的累计，包括已析构和仍存活的实例
+            Counters total(const std::string& name) const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto it = entries_.find(name);
+                return it == entries_.end() ? Counters() : sum(it->second);
+            }
+
+            // 所有容器的累计
+            Counters total() const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                Counters result;
+                for (const auto& item : entries_) result += sum(item.second);
+                return result;
+            }
+
+            std::map<std::string, Counters> snapshot() const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::map<std::string, Counters> result;
+                for (const auto& item : entries_) result[item.first] = sum(item.second);
+                return result;
+            }
+
+            // 清零历史累计和存活实例的计数
+            void reset() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (auto& item : entries_) {
+                    item.second.retired = Counters();
+                    for (Counters* counters : item.second.live) *counters = Counters();
+                }
+            }
+
+            void dump(std::ostream& os) const {
+                for (const auto& item : snapshot()) {
+                    os << std::left << std::setw(24) << item.first << std::right << ' ' << item.second << '\n';
+                }
+            }
+        };
+
+        inline Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        namespace detail {
+            // 构造参数恰好是一个 T 时，左值为复制，右值为移动
+            template <typename T, typename... Args>
+            struct construction {
+                static constexpr bool copy = false;
+                static constexpr bool move = false;
+            };
+
+            template <typename T, typename Arg>
+            struct construction<T, Arg> {
+                static constexpr bool same = std::is_same<std::remove_cv_t<std::remove_reference_t<Arg>>, T>::value;
+                static constexpr bool copy = same && std::is_lvalue_reference<Arg>::value;
+                static constexpr bool move = same && !std::is_lvalue_reference<Arg>::value;
+            };
+
+            // 每次调用给计数加一的比较器，按值传递时各副本共用同一个计数
+            template <typename Compare>
+            class CountedCompare {
+            private:
+                Compare* comp_;
+                size_t* count_;
+
+            public:
+                CountedCompare(Compare* comp, size_t* count) : comp_(comp), count_(count) {}
+
+                template <typename A, typename B>
+                bool operator()(const A& a, const B& b) const {
+                    ++*count_;
+                    return (*comp_)(a, b);
+                }
+            };
+        }
+
+        // 容器私有继承的记录器，Name::value 为注册表中的容器名。记录函数为 protected，
+        // 容器在自己的 stats() 中返回 counters()
+        template <typename Policy, typename Name>
+        class Recorder;
+
+        template <typename Name>
+        class Recorder<none, Name> {
+        protected:
+            void count_reallocation(size_t) const {}
+            void count_moves(size_t) const {}
+            void count_copies(size_t) const {}
+            void count_node_allocations(size_t) const {}
+            void count_comparisons(size_t) const {}
+            void count_rotations(size_t) const {}
+            void count_splits(size_t) const {}
+
+            template <typename T, typename... Args>
+            void count_construction() const {}
+
+            template <typename Compare>
+            Compare& counted(Compare& comp) const {
+                return comp;
+            }
+
+            Counters counters() const {
+                return Counters();
+            }
+        };
+
+        // 复制或移动容器时新实例从零开始计数，赋值不改变双方的计数
+        template <typename Name>
+        class Recorder<counting, Name> {
+        private:
+            mutable Counters counters_;
+
+        protected:
+            Recorder() {
+                registry().attach(Name::value, &counters_);
+            }
+
+            Recorder(const Recorder&) : Recorder() {}
+
+            Recorder& operator=(const Recorder&) {
+                return *this;
+            }
+
+            ~Recorder() {
+                registry().detach(Name::value, &counters_);
+            }
+
+            void count_reallocation(size_t bytes) const {
+                counters_.reallocations++;
+                counters_.relocated_bytes += bytes;
+            }
+
+            void count_moves(size_t count) const {
+                counters_.moves += count;
+            }
+
+            void count_copies(size_t count) const {
+                counters_.copies += count;
+            }
+
+            void count_node_allocations(size_t count) const {
+                counters_.node_allocations += count;
+            }
+
+            void count_comparisons(size_t count) const {
+                counters_.comparisons += count;
+            }
+
+            void count_rotations(size_t count) const {
+                counters_.rotations += count;
+            }
+
+            void count_splits(size_t count) const {
+                counters_.splits += count;
+            }
+
+            template <typename T, typename... Args>
+            void count_construction() const {
+                if constexpr (detail::construction<T, Args...>::copy) counters_.copies++;
+                if constexpr (detail::construction<T, Args...>::move) counters_.moves++;
+            }
+
+            // 单线程使用：计数不是原子的
+            template <typename Compare>
+            detail::CountedCompare<Compare> counted(Compare& comp) const {
+                return detail::CountedCompare<Compare>(&comp, &counters_.comparisons);
+            }
+
+            Counters counters() const {
+                return counters_;
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,536 @@
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <Linear/Vector.hpp>
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Linear {
+    template <typename T, size_t N, typename Alloc>
+    class UnrolledList;
+    template <typename T, size_t N>
+    class UnrolledListIterator;
+
+    namespace detail {
+        // 默认每块约 512 字节，至少 8 个元素
+        template <typename T>
+        constexpr size_t unrolled_block_capacity() {
+            return sizeof(T) * 8 >= 512 ? 8 : 512 / sizeof(T);
+        }
+    }
+
+    struct UnrolledLink {
+        UnrolledLink* prev;
+        UnrolledLink* next;
+        size_t count;
+    };
+
+    template <typename T, size_t N>
+    struct UnrolledBlock : UnrolledLink {
+        alignas(T) unsigned char storage[N * sizeof(T)];
+
+        T* data() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    template <typename T, size_t N>
+    class UnrolledListIterator {
+    private:
+        UnrolledLink* block_;
+        size_t index_;
+
+    public:
+        explicit UnrolledListIterator(UnrolledLink* block, size_t index) : block_(block), index_(index) {}
+
+        T& operator*() const {
+            return static_cast<UnrolledBlock<T, N>*>(block_)->data()[index_];
+        }
+
+        UnrolledListIterator& operator++() {
+            if (++index_ >= block_->count) {
+                block_ = block_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        UnrolledListIterator& operator--() {
+            if (index_ == 0) {
+                block_ = block_->prev;
+                index_ = block_->count - 1;
+            } else {
+                --index_;
+            }
+            return *this;
+        }
+
+        bool operator==(const UnrolledListIterator& other) const {
+            return block_ == other.block_ && index_ == other.index_;
+        }
+        bool operator!=(const UnrolledListIterator& other) const {
+            return !(*this == other);
+        }
+
+        template <typename, size_t, typename>
+        friend class UnrolledList;
+    };
+
+    // 展开链表：每个节点连续存放最多 N 个元素，接口与 DoublyList 保持一致。
+    // 插入、删除、splice 可能移动同一块内的元素，使指向该块的迭代器失效。
+    template <typename T, size_t N = detail::unrolled_block_capacity<T>(), typename Alloc = std::allocator<T>>
+    class UnrolledList {
+    private:
+        static_assert(N >= 2, "UnrolledList needs at least two elements per block");
+
+        using Block = UnrolledBlock<T, N>;
+        using block_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+        using block_traits = std::allocator_traits<block_alloc_type>;
+        using elem_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+        using elem_traits = std::allocator_traits<elem_alloc_type>;
+
+        static constexpr bool relocatable_ = is_trivially_relocatable<T>::value;
+
+        UnrolledLink sentinel_;
+        size_t size_;
+        block_alloc_type alloc_;
+
+    private:
+        static Block* as_block(UnrolledLink* link) {
+            return static_cast<Block*>(link);
+        }
+
+        static void relocate(T* dst, T* src, size_t count) {
+            if (count == 0) return;
+            if constexpr (relocatable_) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            } else if (dst < src) {
+                for (size_t i = 0; i < count; i++) {
+                    new (dst + i) T(std::move(src[i]));
+                    src[i].~T();
+                }
+            } else {
+                for (size_t i = count; i > 0; i--) {
+                    new (dst + i - 1) T(std::move(src[i - 1]));
+                    src[i - 1].~T();
+                }
+            }
+        }
+
+        static void link_before(UnrolledLink* pos, UnrolledLink* first, UnrolledLink* last) {
+            first->prev = pos->prev;
+            last->next = pos;
+            pos->prev->next = first;
+            pos->prev = last;
+        }
+        static void unlink(UnrolledLink* link) {
+            link->prev->next = link->next;
+            link->next->prev = link->prev;
+        }
+
+        void reset() {
+            sentinel_.prev = &sentinel_;
+            sentinel_.next = &sentinel_;
+            sentinel_.count = 0;
+            size_ = 0;
+        }
+
+        Block* create_block(UnrolledLink* before) {
+            Block* block = block_traits::allocate(alloc_, 1);
+            new (block) Block;
+            block->count = 0;
+            link_before(before, block, block);
+            return block;
+        }
+        void free_block(Block* block) {
+            unlink(block);
+            block->~Block();
+            block_traits::deallocate(alloc_, block, 1);
+        }
+
+        Block* back_block_with_room() {
+            if (sentinel_.prev == &sentinel_ || sentinel_.prev->count == N) {
+                return create_block(&sentinel_);
+            }
+            return as_block(sentinel_.prev);
+        }
+
+        // 把 block 中 [index, count) 拆到紧随其后的新块里
+        Block* split(Block* block, size_t index) {
+            Block* tail = create_block(block->next);
+            relocate(tail->data(), block->data() + index, block->count - index);
+            tail->count = block->count - index;
+            block->count = index;
+            return tail;
+        }
+
+        UnrolledListIterator<T, N> insert_value(UnrolledLink* link, size_t index, T&& val) {
+            if (link == &sentinel_) {
+                Block* block = back_block_with_room();
+                new (block->data() + block->count) T(std::move(val));
+                block->count++;
+                size_++;
+                return UnrolledListIterator<T, N>(block, block->count - 1);
+            }
+
+            Block* block = as_block(link);
+            if (block->count == N) {
+                Block* tail = split(block, N / 2);
+                if (index > N / 2) {
+                    block = tail;
+                    index -= N / 2;
+                }
+            }
+
+            relocate(block->data() + index + 1, block->data() + index, block->count - index);
+            new (block->data() + index) T(std::move(val));
+            block->count++;
+            size_++;
+            return UnrolledListIterator<T, N>(block, index);
+        }
+
+        void append_copy(const UnrolledList& other) {
+            for (UnrolledLink* link = other.sentinel_.next; link != &other.sentinel_; link = link->next) {
+                for (size_t i = 0; i < link->count; i++) {
+                    emplace_back(as_block(link)->data()[i]);
+                }
+            }
+        }
+
+        // 逐块压缩：drop(x, last) 返回 true 的元素被删除，last 为上一个保留的元素；
+        // 压缩后能整体并入前一块的块会被合并
+        template <typename Drop>
+        void compact(Drop drop) {
+            const T* last = nullptr;
+            Block* prev_block = nullptr;
+            UnrolledLink* link = sentinel_.next;
+
+            while (link != &sentinel_) {
+                Block* block = as_block(link);
+                UnrolledLink* next = link->next;
+                T* data = block->data();
+
+                size_t kept = 0;
+                for (size_t i = 0; i < block->count; i++) {
+                    if (drop(data[i], last)) {
+                        data[i].~T();
+                        size_--;
+                        continue;
+                    }
+                    if (kept != i) relocate(data + kept, data + i, 1);
+                    last = data + kept;
+                    kept++;
+                }
+                block->count = kept;
+
+                if (kept != 0 && prev_block != nullptr && prev_block->count + kept <= N) {
+                    relocate(prev_block->data() + prev_block->count, data, kept);
+                    prev_block->count += kept;
+                    last = prev_block->data() + prev_block->count - 1;
+                    block->count = 0;
+                }
+                if (block->count == 0) {
+                    free_block(block);
+                } else {
+                    prev_block = block;
+                }
+                link = next;
+            }
+        }
+
+    public:
+        using allocator_type = Alloc;
+
+        UnrolledList() : UnrolledList(Alloc()) {}
+        explicit UnrolledList(const Alloc& alloc) : alloc_(alloc) {
+            reset();
+        }
+        UnrolledList(const UnrolledList& other)
+            : UnrolledList(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.get_allocator())) {
+            append_copy(other);
+        }
+        UnrolledList(UnrolledList&& other) noexcept : UnrolledList(other.get_allocator()) {
+            splice(other);
+        }
+
+        UnrolledList& operator=(const UnrolledList& other) {
+            if (this == &other) return *this;
+
+            clear();
+            append_copy(other);
+            return *this;
+        }
+        // 不传播分配器；分配器不相等时逐个移动元素
+        UnrolledList& operator=(UnrolledList&& other) {
+            if (this == &other) return *this;
+
+            clear();
+            if (get_allocator() == other.get_allocator()) {
+                splice(other);
+            } else {
+                for (UnrolledLink* link = other.sentinel_.next; link != &other.sentinel_; link = link->next) {
+                    for (size_t i = 0; i < link->count; i++) {
+                        emplace_back(std::move(as_block(link)->data()[i]));
+                    }
+                }
+                other.clear();
+            }
+            return *this;
+        }
+
+        ~UnrolledList() {
+            clear();
+        }
+
+        void push_back(const T& val) {
+            emplace_back(val);
+        }
+        void push_back(T&& val) {
+            emplace_back(std::move(val));
+        }
+        void push_front(const T& val) {
+            emplace_front(val);
+        }
+        void push_front(T&& val) {
+            emplace_front(std::move(val));
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            Block* block = back_block_with_room();
+            try {
+                new (block->data() + block->count) T(std::forward<Args>(args)...);
+            } catch (...) {
+                if (block->count == 0) free_block(block);
+                throw;
+            }
+            block->count++;
+            size_++;
+            return block->data()[block->count - 1];
+        }
+        template <typename... Args>
+        T& emplace_front(Args&&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+        template <typename... Args>
+        UnrolledListIterator<T, N> emplace(UnrolledListIterator<T, N> pos, Args&&... args) {
+            T temp(std::forward<Args>(args)...);
+            return insert_value(pos.block_, pos.index_, std::move(temp));
+        }
+
+        void pop_back() {
+            if (empty()) return;
+            erase(--end());
+        }
+        void pop_front() {
+            if (empty()) return;
+            erase(begin());
+        }
+
+        void insert(const T& val) {
+            push_front(val);
+        }
+        UnrolledListIterator<T, N> insert(const T& val, UnrolledListIterator<T, N> pos) {
+            return emplace(pos, val);
+        }
+        UnrolledListIterator<T, N> insert(T&& val, UnrolledListIterator<T, N> pos) {
+            return emplace(pos, std::move(val));
+        }
+
+        void erase() {
+            pop_front();
+        }
+        UnrolledListIterator<T, N> erase(UnrolledListIterator<T, N> pos) {
+            if (pos == end()) return pos;
+
+            Block* block = as_block(pos.block_);
+            size_t index = pos.index_;
+            block->data()[index].~T();
+            relocate(block->data() + index, block->data() + index + 1, block->count - index - 1);
+            block->count--;
+            size_--;
+
+            UnrolledLink* next = block->next;
+            if (block->count == 0) {
+                free_block(block);
+                return UnrolledListIterator<T, N>(next, 0);
+            }
+            if (block->count <= N / 4 && next != &sentinel_ && block->count + next->count <= N) {
+                relocate(block->data() + block->count, as_block(next)->data(), next->count);
+                block->count += next->count;
+                next->count = 0;
+                free_block(as_block(next));
+                return UnrolledListIterator<T, N>(block, index);
+            }
+            if (index == block->count) return UnrolledListIterator<T, N>(next, 0);
+            return UnrolledListIterator<T, N>(block, index);
+        }
+
+        T& back() {
+            if (empty()) throw std::out_of_range("List is empty");
+
+            return *--end();
+        }
+        T& front() {
+            if (empty()) throw std::out_of_range("List is empty");
+
+            return *begin();
+        }
+        T& at(UnrolledListIterator<T, N> pos) {
+            return *pos;
+        }
+
+        void clear() {
+            UnrolledLink* link = sentinel_.next;
+            while (link != &sentinel_) {
+                Block* block = as_block(link);
+                link = link->next;
+                std::destroy_n(block->data(), block->count);
+                free_block(block);
+            }
+            reset();
+        }
+        bool empty() {
+            return size_ == 0;
+        }
+        size_t size() {
+            return size_;
+        }
+
+        void splice(UnrolledList& other) {
+            if (this == &other || other.empty()) return;
+
+            link_before(&sentinel_, other.sentinel_.next, other.sentinel_.prev);
+            size_ += other.size_;
+            other.reset();
+        }
+        void splice(UnrolledList& other, UnrolledListIterator<T, N> pos) {
+            if (this == &other || other.empty()) return;
+            if (pos == end()) {
+                splice(other);
+                return;
+            }
+
+            UnrolledLink* before = pos.block_;
+            if (pos.index_ != 0) {
+                before = split(as_block(pos.block_), pos.index_);
+            }
+            link_before(before, other.sentinel_.next, other.sentinel_.prev);
+            size_ += other.size_;
+            other.reset();
+        }
+
+        void merge(UnrolledList& other) {
+            merge(other, [](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void merge(UnrolledList& other, Compare comp) {
+            if (this == &other || other.empty()) return;
+
+            // 摘下两条块链，按序把元素搬进新的满块中，旧块随消耗释放
+            UnrolledLink* a = sentinel_.next;
+            UnrolledLink* b = other.sentinel_.next;
+            sentinel_.prev->next = nullptr;
+            other.sentinel_.prev->next = nullptr;
+            if (a == &sentinel_) a = nullptr;
+
+            size_t total = size_ + other.size_;
+            reset();
+            other.reset();
+
+            size_t ia = 0;
+            size_t ib = 0;
+            auto take = [&](UnrolledLink*& link, size_t& index) {
+                T& src = as_block(link)->data()[index];
+                Block* block = back_block_with_room();
+                new (block->data() + block->count) T(std::move(src));
+                block->count++;
+                src.~T();
+
+                if (++index == link->count) {
+                    UnrolledLink* next = link->next;
+                    as_block(link)->~Block();
+                    block_traits::deallocate(alloc_, as_block(link), 1);
+                    link = next;
+                    index = 0;
+                }
+            };
+
+            while (a != nullptr && b != nullptr) {
+                if (comp(as_block(b)->data()[ib], as_block(a)->data()[ia])) {
+                    take(b, ib);
+                } else {
+                    take(a, ia);
+                }
+            }
+            while (a != nullptr) take(a, ia);
+            while (b != nullptr) take(b, ib);
+
+            size_ = total;
+        }
+
+        void remove(const T& val) {
+            compact([&val](const T& x, const T*) { return x == val; });
+        }
+
+        void unique() {
+            if (size_ <= 1) return;
+
+            compact([](const T& x, const T* last) { return last != nullptr && x == *last; });
+        }
+        void reverse() {
+            if (size_ <= 1) return;
+
+            UnrolledLink* link = &sentinel_;
+            do {
+                std::swap(link->prev, link->next);
+                if (link != &sentinel_) {
+                    std::reverse(as_block(link)->data(), as_block(link)->data() + link->count);
+                }
+                link = link->prev;
+            } while (link != &sentinel_);
+        }
+
+        void sort() {
+            sort([](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void sort(Compare comp) {
+            if (size_ <= 1) return;
+
+            // 元素先搬到连续缓冲区排序，再按原有块布局搬回
+            elem_alloc_type elem_alloc(alloc_);
+            T* buffer = elem_traits::allocate(elem_alloc, size_);
+            size_t offset = 0;
+            for (UnrolledLink* link = sentinel_.next; link != &sentinel_; link = link->next) {
+                relocate(buffer + offset, as_block(link)->data(), link->count);
+                offset += link->count;
+            }
+
+            std::stable_sort(buffer, buffer + size_, comp);
+
+            offset = 0;
+            for (UnrolledLink* link = sentinel_.next; link != &sentinel_; link = link->next) {
+                relocate(as_block(link)->data(), buffer + offset, link->count);
+                offset += link->count;
+            }
+            elem_traits::deallocate(elem_alloc, buffer, size_);
+        }
+
+        Alloc get_allocator() const {
+            return Alloc(alloc_);
+        }
+
+        UnrolledListIterator<T, N> end() {
+            return UnrolledListIterator<T, N>(&sentinel_, 0);
+        }
+        UnrolledListIterator<T, N> begin() {
+            return UnrolledListIterator<T, N>(sentinel_.next, 0);
+        }
+    };
+}
+
+#endif
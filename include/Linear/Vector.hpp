@@ -1,10 +1,76 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <Linear/Execution.hpp>
+#include <Linear/Growth.hpp>
+#include <Linear/Stats.hpp>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace Linear {
+    // 可按位搬移的类型：搬移时可以直接 memcpy/memmove，无需逐个移动构造再析构。
+    // 默认等价于 std::is_trivially_copyable，其他类型可以特化为 std::true_type 来启用。
     template <typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    // Vector 与 SmallVector 共用的元素搬移操作，dst/src 均为同一分配器管理的内存
+    namespace detail {
+        // 把 src 的 count 个元素搬到未初始化的 dst，搬移后 src 视为未初始化
+        template <typename Alloc, typename T>
+        void relocate(Alloc& alloc, T* dst, T* src, size_t count) {
+            using alloc_traits = std::allocator_traits<Alloc>;
+            if (count == 0) return;
+            if constexpr (is_trivially_relocatable<T>::value) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    alloc_traits::construct(alloc, dst + i, std::move(src[i]));
+                    alloc_traits::destroy(alloc, src + i);
+                }
+            }
+        }
+
+        // 删除 data[index]，后面的元素前移一位；调用方负责 size 减一
+        template <typename Alloc, typename T>
+        void erase_at(Alloc& alloc, T* data, size_t size, size_t index) {
+            using alloc_traits = std::allocator_traits<Alloc>;
+            if constexpr (is_trivially_relocatable<T>::value) {
+                alloc_traits::destroy(alloc, data + index);
+                std::memmove(static_cast<void*>(data + index), static_cast<const void*>(data + index + 1),
+                             (size - index - 1) * sizeof(T));
+            } else {
+                std::move(data + index + 1, data + size, data + index);
+                alloc_traits::destroy(alloc, data + size - 1);
+            }
+        }
+
+        // 在 data[index] 处放入 value，后面的元素后移一位；要求 index < size 且容量至少为 size + 1
+        template <typename Alloc, typename T>
+        void insert_at(Alloc& alloc, T* data, size_t size, size_t index, T&& value) {
+            using alloc_traits = std::allocator_traits<Alloc>;
+            if constexpr (is_trivially_relocatable<T>::value) {
+                std::memmove(static_cast<void*>(data + index + 1), static_cast<const void*>(data + index),
+                             (size - index) * sizeof(T));
+                alloc_traits::construct(alloc, data + index, std::move(value));
+            } else {
+                alloc_traits::construct(alloc, data + size, std::move(data[size - 1]));
+                std::move_backward(data + index, data + size - 1, data + size);
+                data[index] = std::move(value);
+            }
+        }
+
+        struct vector_stats_name {
+            static constexpr const char* value = "Linear::Vector";
+        };
+    }
+
+    template <typename T, typename Alloc, typename Growth, typename Stats>
     class Vector;
     template <typename T>
     class VectorIterator;
@@ -15,22 +81,44 @@ namespace Linear {
         T* current_;
     
     public:
-        explicit VectorIterator(T* data_) : current_(data_) {}
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        explicit VectorIterator(T* data_ = nullptr) : current_(data_) {}
 
-        T& operator*() {
+        T& operator*() const {
             return *current_;
         }
 
+        T* operator->() const {
+            return current_;
+        }
+
         VectorIterator& operator++() {
-            current_ = ++current_;
+            ++current_;
             return *this;
         }
 
+        VectorIterator operator++(int) {
+            VectorIterator old = *this;
+            ++current_;
+            return old;
+        }
+
         VectorIterator& operator--() {
-            current_ = --current_;
+            --current_;
             return *this;
         }
 
+        VectorIterator operator--(int) {
+            VectorIterator old = *this;
+            --current_;
+            return old;
+        }
+
         bool operator==(const VectorIterator& other) const {
             return current_ == other.current_;
         }
@@ -39,62 +127,261 @@ namespace Linear {
             return !(*this == other);
         }
 
-        friend class Vector<T>;
+        template <typename, typename, typename, typename>
+        friend class Vector;
     };
 
-    template <typename T>
-    class Vector {
+    // Growth 为扩容策略，见 Linear/Growth.hpp；Stats 为计数策略，见 Linear/Stats.hpp。
+    // 计数时 reallocations 为换缓冲区的次数，moves 包括扩容搬移与插入删除时的平移；并行排序的比较不计数
+    template <typename T, typename Alloc = std::allocator<T>, typename Growth = growth::doubling,
+              typename Stats = stats::default_policy>
+    class Vector : private stats::Recorder<Stats, detail::vector_stats_name> {
     private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
         T* data_;
         size_t size_;
         size_t capacity_;
-    
+        Alloc alloc_;
+
+    private:
+        T* allocate(size_t count) {
+            return count == 0 ? nullptr : alloc_traits::allocate(alloc_, count);
+        }
+        void deallocate(T* data, size_t count) {
+            if (data != nullptr) alloc_traits::deallocate(alloc_, data, count);
+        }
+
+        size_t next_capacity(size_t required) const {
+            return Growth::next(capacity_, required, sizeof(T));
+        }
+
+        // 扩容时先在新缓冲区构造新元素，再搬移旧元素，因此参数可以引用容器内的元素
+        template <typename... Args>
+        void grow_and_emplace_back(Args&&... args) {
+            size_t new_capacity = next_capacity(size_ + 1);
+            T* new_data = allocate(new_capacity);
+            try {
+                alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            this->count_reallocation(size_ * sizeof(T));
+            relocate(new_data, data_, size_);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+        }
+
+        void steal(Vector& other) {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+
+        void relocate(T* dst, T* src, size_t count) {
+            this->count_moves(count);
+            detail::relocate(alloc_, dst, src, count);
+        }
+
+        // 容量不足 required 时按扩容策略扩容，保证批量插入的摊还代价
+        void grow_for(size_t required) {
+            if (required > capacity_) reserve(next_capacity(required));
+        }
+
+        void destroy_range(T* first, T* last) {
+            for (; first != last; ++first) {
+                alloc_traits::destroy(alloc_, first);
+            }
+        }
+
+        // 在未初始化的 dst 处依次构造 [first, last)，异常时析构已构造的部分
+        template <typename ForwardIt>
+        void construct_range(T* dst, ForwardIt first, ForwardIt last) {
+            T* current = dst;
+            try {
+                for (; first != last; ++first, ++current) {
+                    alloc_traits::construct(alloc_, current, *first);
+                }
+            } catch (...) {
+                destroy_range(dst, current);
+                throw;
+            }
+        }
+
+        // 需要扩容的插入：先在新缓冲区构造插入的元素，再把前后两段搬过去
+        template <typename ForwardIt>
+        void insert_realloc(size_t index, ForwardIt first, ForwardIt last, size_t count) {
+            size_t new_capacity = next_capacity(size_ + count);
+            T* new_data = allocate(new_capacity);
+            try {
+                construct_range(new_data + index, first, last);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            this->count_reallocation(size_ * sizeof(T));
+            relocate(new_data, data_, index);
+            relocate(new_data + index + count, data_ + index, size_ - index);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            size_ += count;
+        }
+
+        // 容量足够的插入：尾部一次整体后移 count 位，再填入新元素
+        template <typename ForwardIt>
+        void insert_in_place(size_t index, ForwardIt first, ForwardIt last, size_t count) {
+            T* pos = data_ + index;
+            T* end = data_ + size_;
+            size_t after = size_ - index;
+            this->count_moves(after);
+
+            if constexpr (is_trivially_relocatable<T>::value) {
+                std::memmove(static_cast<void*>(pos + count), static_cast<const void*>(pos), after * sizeof(T));
+                try {
+                    construct_range(pos, first, last);
+                } catch (...) {
+                    std::memmove(static_cast<void*>(pos), static_cast<const void*>(pos + count), after * sizeof(T));
+                    throw;
+                }
+            } else if (after > count) {
+                construct_range(end, std::make_move_iterator(end - count), std::make_move_iterator(end));
+                std::move_backward(pos, end - count, end);
+                std::copy(first, last, pos);
+            } else {
+                ForwardIt mid = std::next(first, after);
+                construct_range(end, mid, last);
+                try {
+                    construct_range(pos + count, std::make_move_iterator(pos), std::make_move_iterator(end));
+                } catch (...) {
+                    destroy_range(end, pos + count);
+                    throw;
+                }
+                std::copy(first, mid, pos);
+            }
+            size_ += count;
+        }
+
+        // 丢弃空 Vector 的缓冲区，换成恰好容纳 count 个元素的新缓冲区
+        void reallocate_empty(size_t count) {
+            deallocate(data_, capacity_);
+            data_ = nullptr;
+            capacity_ = 0;
+            data_ = allocate(count);
+            capacity_ = count;
+        }
+
+        void fill_to(size_t count, const T& val) {
+            if (count > size_) this->count_copies(count - size_);
+            for (; size_ < count; size_++) {
+                alloc_traits::construct(alloc_, data_ + size_, val);
+            }
+        }
+
     public:
-        explicit Vector() : data_(nullptr), size_(0), capacity_(0) {}
-        explicit Vector(size_t initial_capacity)
-            : data_(static_cast<T*>(::operator new(initial_capacity * sizeof(T)))),
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using iterator = VectorIterator<T>;
+        using allocator_type = Alloc;
+
+        explicit Vector() : data_(nullptr), size_(0), capacity_(0), alloc_() {}
+        explicit Vector(const Alloc& alloc) : data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
+        explicit Vector(size_t initial_capacity, const Alloc& alloc = Alloc())
+            : data_(nullptr),
               size_(0),
-              capacity_(initial_capacity) {}
-        explicit Vector(size_t count, const T& val) {
-            data_ = static_cast<T*>(::operator new(count * sizeof(T)));
+              capacity_(initial_capacity),
+              alloc_(alloc) {
+            data_ = allocate(initial_capacity);
+        }
+        explicit Vector(size_t count, const T& val, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+            data_ = allocate(count);
             capacity_ = count;
+            this->count_copies(count);
 
             for (size_t i = 0; i < count; i++) {
-                new (data_+i) T(val);
+                alloc_traits::construct(alloc_, data_ + i, val);
             }
 
             size_ = count;
         }
-        explicit Vector(const Vector& other) {
-            data_ = static_cast<T*>(::operator new(other.capacity_ * sizeof(T)));
+        Vector(const Vector& other)
+            : stats::Recorder<Stats, detail::vector_stats_name>(),
+              alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+            data_ = allocate(other.capacity_);
             capacity_ = other.capacity_;
+            this->count_copies(other.size_);
 
-            for (int i = 0; i < other.size_; i++) {
-                new (data_+i) T(other.data_[i]);
+            for (size_t i = 0; i < other.size_; i++) {
+                alloc_traits::construct(alloc_, data_ + i, other.data_[i]);
             }
             size_ = other.size_;
         }
+        Vector(Vector&& other) noexcept : alloc_(std::move(other.alloc_)) {
+            steal(other);
+        }
         
         ~Vector() {
             clear();
-            ::operator delete(data_);
+            deallocate(data_, capacity_);
         }
 
         Vector& operator=(const Vector& other) {
-            size_t temp_size = other.size_;
+            if (this == &other) return *this;
+
             clear();
-            ::operator delete(data_);
+            deallocate(data_, capacity_);
 
-            data_ = static_cast<T*>(::operator new(other.capacity_ * sizeof(T)));
+            data_ = allocate(other.capacity_);
             capacity_ = other.capacity_;
+            this->count_copies(other.size_);
+
+            for (size_t i = 0; i < other.size_; i++) {
+                alloc_traits::construct(alloc_, data_ + i, other.data_[i]);
+            }
+            size_ = other.size_;
+            return *this;
+        }
+
+        Vector& operator=(Vector&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                   alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
 
-            for (int i = 0; i < other.size_; i++) {
-                new (data_+i) T(other.data_[i]);
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                deallocate(data_, capacity_);
+                alloc_ = std::move(other.alloc_);
+                steal(other);
+            } else {
+                if (alloc_ == other.alloc_) {
+                    deallocate(data_, capacity_);
+                    steal(other);
+                } else {
+                    // 分配器不相等时不能接管对方的内存，只能逐个移动元素
+                    reserve(other.size_);
+                    this->count_moves(other.size_);
+                    for (size_t i = 0; i < other.size_; i++) {
+                        alloc_traits::construct(alloc_, data_ + i, std::move(other.data_[i]));
+                    }
+                    size_ = other.size_;
+                    other.clear();
+                }
             }
-            size_ = temp_size;
             return *this;
         }
 
+        Alloc get_allocator() const {
+            return alloc_;
+        }
+
         T& operator[](size_t index) {
             return data_[index];
         }
@@ -110,70 +397,274 @@ namespace Linear {
 
         void reserve(size_t new_capacity) {
             if (new_capacity <= capacity_) return;
-            T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
-            for (size_t i = 0; i < size_; i++) {
-                new (new_data + i) T(std::move(data_[i]));
-                data_[i].~T();
-            }
-            ::operator delete(data_);
+            T* new_data = allocate(new_capacity);
+            this->count_reallocation(size_ * sizeof(T));
+            relocate(new_data, data_, size_);
+            deallocate(data_, capacity_);
             data_ = new_data;
             capacity_ = new_capacity;
         }
 
+        // 与 reserve 相同，但容量不足时按扩容策略增长，逐个追加前调用仍是摊还常数代价
+        void reserve_amortized(size_t required) {
+            grow_for(required);
+        }
+
+        // 把容量收缩到与元素个数相同
+        void shrink_to_fit() {
+            if (size_ == capacity_) return;
+            T* new_data = allocate(size_);
+            this->count_reallocation(size_ * sizeof(T));
+            relocate(new_data, data_, size_);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = size_;
+        }
+
         void push_back(const T& val) {
-            if (size_ >= capacity_) {
-                reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-            }
-            new (data_ + size_) T(val);
-            ++size_;
+            emplace_back(val);
         }
 
         void push_back(T&& val) {
+            emplace_back(std::move(val));
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            this->template count_construction<T, Args&&...>();
             if (size_ >= capacity_) {
-                reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+                grow_and_emplace_back(std::forward<Args>(args)...);
+            } else {
+                alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
             }
-            new (data_ + size_) T(std::move(val));
             ++size_;
+            return data_[size_ - 1];
+        }
+
+        // 删除最后一个元素，空 Vector 上调用的行为未定义
+        void pop_back() {
+            --size_;
+            alloc_traits::destroy(alloc_, data_ + size_);
         }
 
-        size_t size() {
+        T& back() {
+            return data_[size_ - 1];
+        }
+
+        const T& back() const {
+            return data_[size_ - 1];
+        }
+
+        T* data() {
+            return data_;
+        }
+
+        const T* data() const {
+            return data_;
+        }
+
+        size_t size() const {
             return size_;
         }
 
-        size_t capacity() {
+        size_t capacity() const {
             return capacity_;
         }
 
-        bool empty() {
+        bool empty() const {
             return size_ == 0;
         }
 
+        // Stats 为 stats::none 时全为零
+        stats::Counters stats() const {
+            return this->counters();
+        }
+
         void clear() {
             for (size_t i = 0; i < size_; i++) {
-                data_[i].~T();
+                alloc_traits::destroy(alloc_, data_ + i);
             }
             size_ = 0;
         }
 
         void erase (size_t index) {
-            for (size_t i = index + 1; i < size_; i++) {
-                data_[i-1] = data_[i];
-            }
+            this->count_moves(size_ - index - 1);
+            detail::erase_at(alloc_, data_, size_, index);
             size_ -= 1;
         }
 
         void insert (size_t index, const T& val) {
-            if (size_ >= capacity_) {
-                reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+            emplace(index, val);
+        }
+
+        void insert (size_t index, T&& val) {
+            emplace(index, std::move(val));
+        }
+
+        // 在 index 处插入 [first, last)：至多一次扩容，尾部元素只移动一次。
+        // 区间不能来自本 Vector
+        template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        void insert(size_t index, InputIt first, InputIt last) {
+            using category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+                size_t count = static_cast<size_t>(std::distance(first, last));
+                if (count == 0) return;
+                this->count_copies(count);
+                if (size_ + count > capacity_) {
+                    insert_realloc(index, first, last, count);
+                } else {
+                    insert_in_place(index, first, last, count);
+                }
+            } else {
+                // 单遍迭代器无法预知长度：先追加到末尾，再整体旋转到位
+                size_t old_size = size_;
+                append(first, last);
+                std::rotate(data_ + index, data_ + old_size, data_ + size_);
             }
+        }
 
-            for (size_t i = size_; i > index; i--) {
-                if (i < capacity_) { 
-                    data_[i] = data_[i-1];
+        // 在末尾追加 [first, last)，前向迭代器只扩容一次
+        template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        void append(InputIt first, InputIt last) {
+            using category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+                size_t count = static_cast<size_t>(std::distance(first, last));
+                this->count_copies(count);
+                grow_for(size_ + count);
+                construct_range(data_ + size_, first, last);
+                size_ += count;
+            } else {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
                 }
             }
-            data_[index] = val;
+        }
+
+        // 删除下标区间 [first, last)，尾部元素只移动一次
+        void erase(size_t first, size_t last) {
+            if (first >= last) return;
+            size_t count = last - first;
+            this->count_moves(size_ - last);
+            if constexpr (is_trivially_relocatable<T>::value) {
+                destroy_range(data_ + first, data_ + last);
+                std::memmove(static_cast<void*>(data_ + first), static_cast<const void*>(data_ + last),
+                             (size_ - last) * sizeof(T));
+            } else {
+                std::move(data_ + last, data_ + size_, data_ + first);
+                destroy_range(data_ + size_ - count, data_ + size_);
+            }
+            size_ -= count;
+        }
+
+        // 删除所有满足 pred 的元素，单遍压实，返回删除的个数
+        template <typename Predicate>
+        size_t erase_if(Predicate pred) {
+            T* end = data_ + size_;
+            T* kept = std::remove_if(data_, end, pred);
+            size_t removed = static_cast<size_t>(end - kept);
+            destroy_range(kept, end);
+            size_ -= removed;
+            return removed;
+        }
+
+        // 用 count 个 val 替换全部内容
+        void assign(size_t count, const T& val) {
+            T temp(val);
+            clear();
+            if (count > capacity_) reallocate_empty(count);
+            fill_to(count, temp);
+        }
+
+        // 用 [first, last) 替换全部内容，区间不能来自本 Vector
+        template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        void assign(InputIt first, InputIt last) {
+            using category = typename std::iterator_traits<InputIt>::iterator_category;
+            clear();
+            if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+                size_t count = static_cast<size_t>(std::distance(first, last));
+                if (count > capacity_) reallocate_empty(count);
+            }
+            append(first, last);
+        }
+
+        // 调整元素个数，新增的元素值初始化
+        void resize(size_t count) {
+            if (count <= size_) {
+                destroy_range(data_ + count, data_ + size_);
+                size_ = count;
+                return;
+            }
+            grow_for(count);
+            for (; size_ < count; size_++) {
+                alloc_traits::construct(alloc_, data_ + size_);
+            }
+        }
+
+        void resize(size_t count, const T& val) {
+            if (count <= size_) {
+                destroy_range(data_ + count, data_ + size_);
+                size_ = count;
+                return;
+            }
+            if (count > capacity_) {
+                // val 可能引用本 Vector 的元素，扩容前先复制一份
+                T temp(val);
+                grow_for(count);
+                fill_to(count, temp);
+            } else {
+                fill_to(count, val);
+            }
+        }
+
+        template <typename... Args>
+        T& emplace(size_t index, Args&&... args) {
+            if (index == size_) return emplace_back(std::forward<Args>(args)...);
+
+            T temp(std::forward<Args>(args)...);
+            this->template count_construction<T, Args&&...>();
+            if (size_ >= capacity_) {
+                reserve(next_capacity(size_ + 1));
+            }
+            this->count_moves(size_ - index + 1);
+
+            detail::insert_at(alloc_, data_, size_, index, std::move(temp));
             size_ += 1;
+            return data_[index];
+        }
+
+        void sort() {
+            sort([](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void sort(Compare comp) {
+            std::sort(data_, data_ + size_, this->counted(comp));
+        }
+        void sort(const execution::sequenced_policy& policy) {
+            sort(policy, [](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void sort(const execution::sequenced_policy&, Compare comp) {
+            sort(comp);
+        }
+        void sort(const execution::parallel_policy& policy) {
+            sort(policy, [](const T& a, const T& b) { return a < b; });
+        }
+        template <typename Compare>
+        void sort(const execution::parallel_policy& policy, Compare comp) {
+            size_t threads = detail::resolve_threads(policy, size_);
+            if (threads <= 1) {
+                sort(comp);
+                return;
+            }
+
+            T* buffer = allocate(size_);
+            try {
+                detail::parallel_sort(data_, size_, buffer, comp, threads);
+            } catch (...) {
+                deallocate(buffer, size_);
+                throw;
+            }
+            deallocate(buffer, size_);
         }
 
         VectorIterator<T> end() {
@@ -0,0 +1,725 @@
+#ifndef AVL_TREE_HPP
+#define AVL_TREE_HPP
+
+#include <Linear/NodePool.hpp>
+#include <Linear/Stats.hpp>
+#include <Tree/BinaryTree.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Tree {
+    // 子树聚合策略：value_type 为聚合值，identity() 为单位元，from(key, value) 为单个元素的聚合值，
+    // combine(left, right) 按键序合并相邻两段（需满足结合律，不要求交换律）
+    namespace augment {
+        struct none {
+            struct value_type {};
+            static value_type identity() {
+                return {};
+            }
+            template <typename K, typename V>
+            static value_type from(const K&, const V&) {
+                return {};
+            }
+            static value_type combine(const value_type&, const value_type&) {
+                return {};
+            }
+        };
+
+        // 值的和
+        template <typename V>
+        struct sum {
+            using value_type = V;
+            static V identity() {
+                return V();
+            }
+            template <typename K>
+            static V from(const K&, const V& value) {
+                return value;
+            }
+            static V combine(const V& left, const V& right) {
+                return left + right;
+            }
+        };
+
+        // 值的最大值，空区间为 numeric_limits<V>::lowest()
+        template <typename V>
+        struct max {
+            using value_type = V;
+            static V identity() {
+                return std::numeric_limits<V>::lowest();
+            }
+            template <typename K>
+            static V from(const K&, const V& value) {
+                return value;
+            }
+            static V combine(const V& left, const V& right) {
+                return left < right ? right : left;
+            }
+        };
+    }
+
+    // 平衡与计数所需的链接，size 为子树元素个数，height 为子树高度（叶子为 1）
+    struct AVLLink {
+        AVLLink* left;
+        AVLLink* right;
+        AVLLink* parent;
+        size_t size;
+        int height;
+    };
+
+    namespace detail {
+        inline AVLLink* avl_next(AVLLink* node) {
+            if (node->right != nullptr) {
+                node = node->right;
+                while (node->left != nullptr) node = node->left;
+                return node;
+            }
+            AVLLink* parent = node->parent;
+            while (parent != nullptr && node == parent->right) {
+                node = parent;
+                parent = parent->parent;
+            }
+            return parent;
+        }
+
+        inline AVLLink* avl_prev(AVLLink* node) {
+            if (node->left != nullptr) {
+                node = node->left;
+                while (node->right != nullptr) node = node->right;
+                return node;
+            }
+            AVLLink* parent = node->parent;
+            while (parent != nullptr && node == parent->left) {
+                node = parent;
+                parent = parent->parent;
+            }
+            return parent;
+        }
+
+        // 空聚合不占节点空间
+        template <typename S, bool = std::is_empty_v<S>>
+        struct AVLSummary {
+            S summary;
+
+            const S& get_summary() const {
+                return summary;
+            }
+            void set_summary(S value) {
+                summary = std::move(value);
+            }
+        };
+
+        template <typename S>
+        struct AVLSummary<S, true> {
+            S get_summary() const {
+                return S();
+            }
+            void set_summary(const S&) {}
+        };
+
+        struct avl_tree_stats_name {
+            static constexpr const char* value = "Tree::AVLTree";
+        };
+    }
+
+    template <typename K, typename V, typename S>
+    struct AVLNode : AVLLink, detail::AVLSummary<S> {
+        std::pair<const K, V> value;
+
+        template <typename... Args>
+        explicit AVLNode(Args&&... args) : AVLLink(), value(std::forward<Args>(args)...) {}
+    };
+
+    // 双向迭代器，元素只读：值需要经 insert_or_assign 修改，以便维护子树聚合
+    template <typename Value, typename Access>
+    class AVLTreeIterator {
+    private:
+        AVLLink* node_;
+        AVLLink* const* root_;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using reference = const Value&;
+        using pointer = const Value*;
+
+        AVLTreeIterator(AVLLink* node = nullptr, AVLLink* const* root = nullptr) : node_(node), root_(root) {}
+
+        reference operator*() const {
+            return Access::value(node_);
+        }
+
+        pointer operator->() const {
+            return &Access::value(node_);
+        }
+
+        AVLTreeIterator& operator++() {
+            node_ = detail::avl_next(node_);
+            return *this;
+        }
+
+        AVLTreeIterator& operator--() {
+            if (node_ == nullptr) {
+                node_ = *root_;
+                while (node_->right != nullptr) node_ = node_->right;
+            } else {
+                node_ = detail::avl_prev(node_);
+            }
+            return *this;
+        }
+
+        bool operator==(const AVLTreeIterator& other) const {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const AVLTreeIterator& other) const {
+            return !(*this == other);
+        }
+
+        template <typename, typename, typename, typename, typename, typename>
+        friend class AVLTree;
+    };
+
+    // AVL 树有序映射，每个节点维护子树大小和 Augment 聚合，旋转时一并更新。
+    // select、rank、count_range 与 summarize_range 都是 O(log n)。节点由 Linear::NodePool 分配。
+    // Stats 为计数策略（见 Linear/Stats.hpp），计节点分配、键比较与旋转
+    template <typename K, typename V, typename Compare = std::less<K>, typename Augment = augment::none,
+              typename Alloc = std::allocator<std::pair<const K, V>>, typename Stats = Linear::stats::default_policy>
+    class AVLTree : public BinaryTree<AVLTree<K, V, Compare, Augment, Alloc, Stats>, AVLLink>,
+                    private Linear::stats::Recorder<Stats, detail::avl_tree_stats_name> {
+    public:
+        using summary_type = typename Augment::value_type;
+
+    private:
+        using Node = AVLNode<K, V, summary_type>;
+
+        struct Access {
+            static const std::pair<const K, V>& value(AVLLink* link) {
+                return static_cast<Node*>(link)->value;
+            }
+        };
+
+        friend class BinaryTree<AVLTree, AVLLink>;
+
+        AVLLink* root_;
+        Compare comp_;
+        Linear::NodePool<Node, Alloc> pool_;
+
+    private:
+        AVLLink* root_link() const {
+            return root_;
+        }
+
+        static Node* node_of(AVLLink* link) {
+            return static_cast<Node*>(link);
+        }
+
+        static const K& key_of(const AVLLink* link) {
+            return static_cast<const Node*>(link)->value.first;
+        }
+
+        bool less(const K& a, const K& b) const {
+            this->count_comparisons(1);
+            return comp_(a, b);
+        }
+
+        static int height_of(const AVLLink* link) {
+            return link == nullptr ? 0 : link->height;
+        }
+
+        static size_t size_of(const AVLLink* link) {
+            return link == nullptr ? 0 : link->size;
+        }
+
+        static summary_type summary_of(AVLLink* link) {
+            return link == nullptr ? Augment::identity() : node_of(link)->get_summary();
+        }
+
+        static summary_type element_summary(AVLLink* link) {
+            const std::pair<const K, V>& entry = node_of(link)->value;
+            return Augment::from(entry.first, entry.second);
+        }
+
+        // 由子节点重新计算 node 的高度、大小和聚合
+        static void update(AVLLink* node) {
+            node->height = 1 + std::max(height_of(node->left), height_of(node->right));
+            node->size = 1 + size_of(node->left) + size_of(node->right);
+            if constexpr (!std::is_empty_v<summary_type>) {
+                node_of(node)->set_summary(Augment::combine(
+                    Augment::combine(summary_of(node->left), element_summary(node)), summary_of(node->right)));
+            }
+        }
+
+        void replace_child(AVLLink* old_child, AVLLink* new_child, AVLLink* parent) {
+            if (parent == nullptr) {
+                root_ = new_child;
+            } else if (parent->left == old_child) {
+                parent->left = new_child;
+            } else {
+                parent->right = new_child;
+            }
+        }
+
+        AVLLink* rotate_left(AVLLink* node) {
+            this->count_rotations(1);
+            AVLLink* pivot = node->right;
+            node->right = pivot->left;
+            if (pivot->left != nullptr) pivot->left->parent = node;
+            pivot->parent = node->parent;
+            replace_child(node, pivot, node->parent);
+            pivot->left = node;
+            node->parent = pivot;
+            update(node);
+            update(pivot);
+            return pivot;
+        }
+
+        AVLLink* rotate_right(AVLLink* node) {
+            this->count_rotations(1);
+            AVLLink* pivot = node->left;
+            node->left = pivot->right;
+            if (pivot->right != nullptr) pivot->right->parent = node;
+            pivot->parent = node->parent;
+            replace_child(node, pivot, node->parent);
+            pivot->right = node;
+            node->parent = pivot;
+            update(node);
+            update(pivot);
+            return pivot;
+        }
+
+        // 从 node 开始向上逐个更新祖先，失衡处旋转；大小和聚合一直要更新到根
+        void retrace(AVLLink* node) {
+            while (node != nullptr) {
+                int balance = height_of(node->left) - height_of(node->right);
+                if (balance > 1) {
+                    if (height_of(node->left->left) < height_of(node->left->right)) rotate_left(node->left);
+                    node = rotate_right(node);
+                } else if (balance < -1) {
+                    if (height_of(node->right->right) < height_of(node->right->left)) rotate_right(node->right);
+                    node = rotate_left(node);
+                } else {
+                    update(node);
+                }
+                node = node->parent;
+            }
+        }
+
+        template <typename... Args>
+        Node* create_node(Args&&... args) {
+            this->count_node_allocations(1);
+            Node* node = pool_.allocate();
+            try {
+                new (node) Node(std::forward<Args>(args)...);
+            } catch (...) {
+                pool_.deallocate(node);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(AVLLink* link) {
+            Node* node = node_of(link);
+            node->~Node();
+            pool_.deallocate(node);
+        }
+
+        void destroy_subtree(AVLLink* node) {
+            while (node != nullptr) {
+                destroy_subtree(node->right);
+                AVLLink* left = node->left;
+                destroy_node(node);
+                node = left;
+            }
+        }
+
+        // 按原形状复制子树，高度、大小和聚合直接沿用
+        AVLLink* clone(AVLLink* src, AVLLink* parent) {
+            Node* node = create_node(node_of(src)->value);
+            node->left = nullptr;
+            node->right = nullptr;
+            node->parent = parent;
+            node->size = src->size;
+            node->height = src->height;
+            node->set_summary(node_of(src)->get_summary());
+            try {
+                if (src->left != nullptr) node->left = clone(src->left, node);
+                if (src->right != nullptr) node->right = clone(src->right, node);
+            } catch (...) {
+                destroy_subtree(node);
+                throw;
+            }
+            return node;
+        }
+
+        AVLLink* lower_bound_link(const K& key) const {
+            AVLLink* node = root_;
+            AVLLink* result = nullptr;
+            while (node != nullptr) {
+                if (!less(key_of(node), key)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        AVLLink* upper_bound_link(const K& key) const {
+            AVLLink* node = root_;
+            AVLLink* result = nullptr;
+            while (node != nullptr) {
+                if (less(key, key_of(node))) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        template <typename M>
+        std::pair<AVLLink*, bool> insert_unique(const K& key, M&& value, bool assign) {
+            AVLLink* parent = nullptr;
+            AVLLink* candidate = nullptr;
+            bool left = false;
+            for (AVLLink* node = root_; node != nullptr;) {
+                parent = node;
+                left = less(key, key_of(node));
+                if (left) {
+                    node = node->left;
+                } else {
+                    candidate = node;
+                    node = node->right;
+                }
+            }
+            if (candidate != nullptr && !less(key_of(candidate), key)) {
+                if (assign) {
+                    node_of(candidate)->value.second = std::forward<M>(value);
+                    if constexpr (!std::is_empty_v<summary_type>) {
+                        for (AVLLink* node = candidate; node != nullptr; node = node->parent) update(node);
+                    }
+                }
+                return {candidate, false};
+            }
+
+            Node* node = create_node(key, std::forward<M>(value));
+            node->left = nullptr;
+            node->right = nullptr;
+            node->parent = parent;
+            update(node);
+            if (parent == nullptr) {
+                root_ = node;
+            } else if (left) {
+                parent->left = node;
+            } else {
+                parent->right = node;
+            }
+            retrace(parent);
+            return {node, true};
+        }
+
+        void erase_link(AVLLink* node) {
+            AVLLink* start;
+            if (node->left == nullptr || node->right == nullptr) {
+                AVLLink* child = node->left != nullptr ? node->left : node->right;
+                start = node->parent;
+                replace_child(node, child, node->parent);
+                if (child != nullptr) child->parent = node->parent;
+            } else {
+                // 有两个子节点时用后继顶替 node 的位置
+                AVLLink* successor = node->right;
+                while (successor->left != nullptr) successor = successor->left;
+                if (successor->parent != node) {
+                    start = successor->parent;
+                    start->left = successor->right;
+                    if (successor->right != nullptr) successor->right->parent = start;
+                    successor->right = node->right;
+                    node->right->parent = successor;
+                } else {
+                    start = successor;
+                }
+                successor->left = node->left;
+                node->left->parent = successor;
+                successor->parent = node->parent;
+                replace_child(node, successor, node->parent);
+            }
+            destroy_node(node);
+            retrace(start);
+        }
+
+        // 子树中不小于 lo 的元素的聚合
+        summary_type summarize_from(AVLLink* node, const K& lo) const {
+            summary_type result = Augment::identity();
+            while (node != nullptr) {
+                if (!less(key_of(node), lo)) {
+                    result = Augment::combine(Augment::combine(element_summary(node), summary_of(node->right)), result);
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        // 子树中小于 hi 的元素的聚合
+        summary_type summarize_before(AVLLink* node, const K& hi) const {
+            summary_type result = Augment::identity();
+            while (node != nullptr) {
+                if (less(key_of(node), hi)) {
+                    result = Augment::combine(result, Augment::combine(summary_of(node->left), element_summary(node)));
+                    node = node->right;
+                } else {
+                    node = node->left;
+                }
+            }
+            return result;
+        }
+
+        // 返回子树高度，结构不满足时返回 -1
+        int validate_node(const AVLLink* node, const AVLLink* parent, const K* lower, const K* upper) const {
+            if (node == nullptr) return 0;
+            if (node->parent != parent) return -1;
+            if (lower != nullptr && !less(*lower, key_of(node))) return -1;
+            if (upper != nullptr && !less(key_of(node), *upper)) return -1;
+            int left = validate_node(node->left, node, lower, &key_of(node));
+            int right = validate_node(node->right, node, &key_of(node), upper);
+            if (left < 0 || right < 0 || left - right > 1 || right - left > 1) return -1;
+            if (node->height != 1 + std::max(left, right)) return -1;
+            if (node->size != 1 + size_of(node->left) + size_of(node->right)) return -1;
+            return node->height;
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using iterator = AVLTreeIterator<value_type, Access>;
+
+        explicit AVLTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : root_(nullptr), comp_(comp), pool_(alloc) {}
+
+        AVLTree(const AVLTree& other)
+            : AVLTree(other.comp_,
+                      std::allocator_traits<Alloc>::select_on_container_copy_construction(other.get_allocator())) {
+            if (other.root_ != nullptr) root_ = clone(other.root_, nullptr);
+        }
+
+        // 连同节点池一起接管，other 留下一个空池
+        AVLTree(AVLTree&& other) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
+            : root_(nullptr), comp_(other.comp_), pool_(std::move(other.pool_)) {
+            root_ = other.root_;
+            other.root_ = nullptr;
+        }
+
+        ~AVLTree() {
+            clear();
+        }
+
+        AVLTree& operator=(const AVLTree& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if (other.root_ != nullptr) root_ = clone(other.root_, nullptr);
+            return *this;
+        }
+
+        // 不传播分配器；分配器不相等时复制节点
+        AVLTree& operator=(AVLTree&& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if (get_allocator() == other.get_allocator()) {
+                pool_.swap(other.pool_);
+                root_ = other.root_;
+                other.root_ = nullptr;
+            } else {
+                if (other.root_ != nullptr) root_ = clone(other.root_, nullptr);
+                other.clear();
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return Alloc(pool_.get_allocator());
+        }
+
+        // 键已存在时不修改，返回已有元素
+        std::pair<iterator, bool> insert(const K& key, const V& value) {
+            auto result = insert_unique(key, value, false);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        std::pair<iterator, bool> insert(const K& key, V&& value) {
+            auto result = insert_unique(key, std::move(value), false);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        // 键已存在时替换值并更新到根的聚合
+        std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+            auto result = insert_unique(key, value, true);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        const V& at(const K& key) const {
+            AVLLink* node = lower_bound_link(key);
+            if (node == nullptr || less(key, key_of(node))) throw std::out_of_range("Key not found");
+            return node_of(node)->value.second;
+        }
+
+        iterator find(const K& key) {
+            AVLLink* node = lower_bound_link(key);
+            if (node == nullptr || less(key, key_of(node))) return end();
+            return iterator(node, &root_);
+        }
+
+        bool contains(const K& key) const {
+            AVLLink* node = lower_bound_link(key);
+            return node != nullptr && !less(key, key_of(node));
+        }
+
+        // 第一个不小于 key 的元素
+        iterator lower_bound(const K& key) {
+            return iterator(lower_bound_link(key), &root_);
+        }
+
+        // 第一个大于 key 的元素
+        iterator upper_bound(const K& key) {
+            return iterator(upper_bound_link(key), &root_);
+        }
+
+        // 返回被删除元素的下一个元素
+        iterator erase(iterator pos) {
+            AVLLink* next = detail::avl_next(pos.node_);
+            erase_link(pos.node_);
+            return iterator(next, &root_);
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(const K& key) {
+            AVLLink* node = lower_bound_link(key);
+            if (node == nullptr || less(key, key_of(node))) return 0;
+            erase_link(node);
+            return 1;
+        }
+
+        // 第 k 小的元素（从 0 开始），k 不小于 size() 时返回 end()
+        iterator select(size_t k) {
+            AVLLink* node = root_;
+            while (node != nullptr) {
+                size_t left = size_of(node->left);
+                if (k < left) {
+                    node = node->left;
+                } else if (k == left) {
+                    break;
+                } else {
+                    k -= left + 1;
+                    node = node->right;
+                }
+            }
+            return iterator(node, &root_);
+        }
+
+        // 小于 key 的元素个数；key 存在时即为它的下标
+        size_t rank(const K& key) const {
+            size_t result = 0;
+            AVLLink* node = root_;
+            while (node != nullptr) {
+                if (less(key_of(node), key)) {
+                    result += size_of(node->left) + 1;
+                    node = node->right;
+                } else {
+                    node = node->left;
+                }
+            }
+            return result;
+        }
+
+        // 键在 [lo, hi) 中的元素个数
+        size_t count_range(const K& lo, const K& hi) const {
+            return less(lo, hi) ? rank(hi) - rank(lo) : 0;
+        }
+
+        // 全部元素的聚合
+        summary_type summary() const {
+            return summary_of(root_);
+        }
+
+        // 键在 [lo, hi) 中的元素按键序的聚合：先找到第一个落在区间内的节点，再分别沿左右两侧向下
+        summary_type summarize_range(const K& lo, const K& hi) const {
+            AVLLink* node = root_;
+            while (node != nullptr) {
+                if (less(key_of(node), lo)) {
+                    node = node->right;
+                } else if (!less(key_of(node), hi)) {
+                    node = node->left;
+                } else {
+                    break;
+                }
+            }
+            if (node == nullptr) return Augment::identity();
+            return Augment::combine(Augment::combine(summarize_from(node->left, lo), element_summary(node)),
+                                    summarize_before(node->right, hi));
+        }
+
+        void clear() {
+            destroy_subtree(root_);
+            root_ = nullptr;
+        }
+
+        // 归还池中完全空闲的 slab
+        void shrink_to_fit() {
+            pool_.shrink_to_fit();
+        }
+
+        size_t size() const {
+            return size_of(root_);
+        }
+
+        bool empty() const {
+            return root_ == nullptr;
+        }
+
+        // 根到最深叶子的层数，空树为 0
+        size_t height() const {
+            return static_cast<size_t>(height_of(root_));
+        }
+
+        // 检查键严格递增、父指针、平衡因子以及每个节点的高度和大小
+        bool validate() const {
+            return validate_node(root_, nullptr, nullptr, nullptr) >= 0;
+        }
+
+        iterator begin() {
+            AVLLink* node = root_;
+            if (node != nullptr) {
+                while (node->left != nullptr) node = node->left;
+            }
+            return iterator(node, &root_);
+        }
+
+        iterator end() {
+            return iterator(nullptr, &root_);
+        }
+
+        // Stats 为 Linear::stats::none 时全为零
+        Linear::stats::Counters stats() const {
+            return this->counters();
+        }
+    };
+}
+
+#endif
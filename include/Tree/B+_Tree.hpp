@@ -0,0 +1,1314 @@
+#ifndef B_PLUS_TREE_HPP
+#define B_PLUS_TREE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Linear/Stats.hpp>
+#include <Tree/MappedFile.hpp>
+#include <Tree/NodeSearch.hpp>
+
+namespace Tree {
+    // 批量构建的标记：输入已按键严格递增排列
+    struct sorted_input_t {
+        explicit sorted_input_t() = default;
+    };
+    inline constexpr sorted_input_t sorted_input{};
+
+    namespace detail {
+        // 默认阶数：每个节点的键数组约占 4 个缓存行
+        template <typename K>
+        constexpr size_t bplus_default_order() {
+            return std::clamp<size_t>(256 / sizeof(K), 8, 64);
+        }
+
+        struct bplus_tree_stats_name {
+            static constexpr const char* value = "Tree::BPlusTree";
+        };
+    }
+
+    struct BPlusNode {
+        uint32_t count;
+        bool leaf;
+    };
+
+    // 键和值分别连续存放，节点内查找只触及键数组
+    template <typename K, typename V, size_t Order>
+    struct BPlusLeaf : BPlusNode {
+        K keys[Order];
+        V values[Order];
+        BPlusLeaf* prev;
+        BPlusLeaf* next;
+    };
+
+    // children[i] 中的键都小于 keys[i]，children[i + 1] 中的键都不小于 keys[i]
+    template <typename K, size_t Order>
+    struct BPlusInner : BPlusNode {
+        K keys[Order];
+        BPlusNode* children[Order + 1];
+    };
+
+    template <typename K, typename V, size_t Order, typename Compare, typename Alloc, typename Search, typename Stats>
+    class BPlusTree;
+
+    template <typename K, typename V, size_t Order>
+    class BPlusTreeIterator {
+    private:
+        using Leaf = BPlusLeaf<K, V, Order>;
+
+        Leaf* leaf_;
+        size_t index_;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<const K, V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const K&, V&>;
+        using pointer = void;
+
+        explicit BPlusTreeIterator(Leaf* leaf = nullptr, size_t index = 0) : leaf_(leaf), index_(index) {}
+
+        const K& key() const {
+            return leaf_->keys[index_];
+        }
+
+        V& value() const {
+            return leaf_->values[index_];
+        }
+
+        reference operator*() const {
+            return reference(key(), value());
+        }
+
+        // 叶子末尾只在最后一个叶子上出现，作为 end()
+        BPlusTreeIterator& operator++() {
+            if (++index_ == leaf_->count && leaf_->next != nullptr) {
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        BPlusTreeIterator& operator--() {
+            if (index_ == 0) {
+                leaf_ = leaf_->prev;
+                index_ = leaf_->count;
+            }
+            --index_;
+            return *this;
+        }
+
+        bool operator==(const BPlusTreeIterator& other) const {
+            return leaf_ == other.leaf_ && index_ == other.index_;
+        }
+
+        bool operator!=(const BPlusTreeIterator& other) const {
+            return !(*this == other);
+        }
+
+        template <typename, typename, size_t, typename, typename, typename, typename>
+        friend class BPlusTree;
+    };
+
+    // B+ 树：数据只存放在叶子中，叶子按键序双向链接，便于范围扫描。
+    // Order 为每个节点的最大键数；K 与 V 需要可默认构造，节点内的键连续存放，
+    // 由 Search 策略查找（见 Tree/NodeSearch.hpp）。
+    // Stats 为计数策略（见 Linear/Stats.hpp），计节点分配、分裂和删除时向兄弟借键（记为旋转），不计比较次数。
+    template <typename K, typename V, size_t Order = detail::bplus_default_order<K>(), typename Compare = std::less<K>,
+              typename Alloc = std::allocator<std::pair<const K, V>>, typename Search = search::default_policy<K>,
+              typename Stats = Linear::stats::default_policy>
+    class BPlusTree : private Linear::stats::Recorder<Stats, detail::bplus_tree_stats_name> {
+        static_assert(Order >= 4, "BPlusTree needs an order of at least 4");
+
+    private:
+        using Node = BPlusNode;
+        using Leaf = BPlusLeaf<K, V, Order>;
+        using Inner = BPlusInner<K, Order>;
+        using leaf_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Leaf>;
+        using inner_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Inner>;
+        using leaf_traits = std::allocator_traits<leaf_alloc_type>;
+        using inner_traits = std::allocator_traits<inner_alloc_type>;
+
+        // 非根节点至少保留的键数（顺序追加产生的叶子除外，见 insert）
+        static constexpr size_t kMinKeys = Order / 2;
+        // 最小扇出为 2 时 64 层足以容纳任意 size_t 个元素
+        static constexpr size_t kMaxHeight = 64;
+
+        // 从根到叶子经过的内部节点，以及在每个节点中选择的子节点下标
+        struct Path {
+            Inner* nodes[kMaxHeight];
+            size_t slots[kMaxHeight];
+            size_t depth;
+        };
+
+        Node* root_;
+        Leaf* first_;
+        Leaf* last_;
+        size_t size_;
+        size_t height_;
+        Compare comp_;
+        Alloc alloc_;
+
+    private:
+        Leaf* create_leaf() {
+            this->count_node_allocations(1);
+            leaf_alloc_type alloc(alloc_);
+            Leaf* leaf = leaf_traits::allocate(alloc, 1);
+            try {
+                new (leaf) Leaf();
+            } catch (...) {
+                leaf_traits::deallocate(alloc, leaf, 1);
+                throw;
+            }
+            leaf->count = 0;
+            leaf->leaf = true;
+            leaf->prev = nullptr;
+            leaf->next = nullptr;
+            return leaf;
+        }
+
+        Inner* create_inner() {
+            this->count_node_allocations(1);
+            inner_alloc_type alloc(alloc_);
+            Inner* inner = inner_traits::allocate(alloc, 1);
+            try {
+                new (inner) Inner();
+            } catch (...) {
+                inner_traits::deallocate(alloc, inner, 1);
+                throw;
+            }
+            inner->count = 0;
+            inner->leaf = false;
+            return inner;
+        }
+
+        void destroy_leaf(Leaf* leaf) {
+            leaf_alloc_type alloc(alloc_);
+            leaf->~Leaf();
+            leaf_traits::deallocate(alloc, leaf, 1);
+        }
+
+        void destroy_inner(Inner* inner) {
+            inner_alloc_type alloc(alloc_);
+            inner->~Inner();
+            inner_traits::deallocate(alloc, inner, 1);
+        }
+
+        void destroy_node(Node* node) {
+            if (node->leaf) {
+                destroy_leaf(static_cast<Leaf*>(node));
+            } else {
+                destroy_inner(static_cast<Inner*>(node));
+            }
+        }
+
+        void destroy_subtree(Node* node) {
+            if (!node->leaf) {
+                Inner* inner = static_cast<Inner*>(node);
+                for (size_t i = 0; i <= inner->count; i++) {
+                    destroy_subtree(inner->children[i]);
+                }
+            }
+            destroy_node(node);
+        }
+
+        Leaf* find_leaf(const K& key, Path* path) const {
+            Node* node = root_;
+            size_t depth = 0;
+            while (!node->leaf) {
+                Inner* inner = static_cast<Inner*>(node);
+                size_t slot = Search::upper_bound(inner->keys, inner->count, key, comp_);
+                if (path != nullptr) {
+                    path->nodes[depth] = inner;
+                    path->slots[depth] = slot;
+                }
+                depth++;
+                node = inner->children[slot];
+            }
+            if (path != nullptr) path->depth = depth;
+            return static_cast<Leaf*>(node);
+        }
+
+        // 叶子内下标为 index 的位置；落在叶子末尾时改为下一个叶子的开头，与迭代器的 end() 约定一致
+        BPlusTreeIterator<K, V, Order> make_iterator(Leaf* leaf, size_t index) const {
+            if (index == leaf->count && leaf->next != nullptr) return BPlusTreeIterator<K, V, Order>(leaf->next, 0);
+            return BPlusTreeIterator<K, V, Order>(leaf, index);
+        }
+
+        void link_after(Leaf* leaf, Leaf* right) {
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next != nullptr) {
+                leaf->next->prev = right;
+            } else {
+                last_ = right;
+            }
+            leaf->next = right;
+        }
+
+        void unlink(Leaf* leaf) {
+            if (leaf->prev != nullptr) {
+                leaf->prev->next = leaf->next;
+            } else {
+                first_ = leaf->next;
+            }
+            if (leaf->next != nullptr) {
+                leaf->next->prev = leaf->prev;
+            } else {
+                last_ = leaf->prev;
+            }
+        }
+
+        template <typename M>
+        static void leaf_insert(Leaf* leaf, size_t pos, const K& key, M&& value) {
+            std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            std::move_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+            leaf->keys[pos] = key;
+            leaf->values[pos] = std::forward<M>(value);
+            leaf->count++;
+        }
+
+        static void leaf_erase(Leaf* leaf, size_t pos) {
+            std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+            std::move(leaf->values + pos + 1, leaf->values + leaf->count, leaf->values + pos);
+            leaf->count--;
+        }
+
+        // 把 src[from, src.count) 移到 dst 末尾
+        static void leaf_move_tail(Leaf* src, size_t from, Leaf* dst) {
+            std::move(src->keys + from, src->keys + src->count, dst->keys + dst->count);
+            std::move(src->values + from, src->values + src->count, dst->values + dst->count);
+            dst->count += src->count - from;
+            src->count = static_cast<uint32_t>(from);
+        }
+
+        static void inner_insert(Inner* inner, size_t slot, const K& key, Node* right) {
+            std::move_backward(inner->keys + slot, inner->keys + inner->count, inner->keys + inner->count + 1);
+            std::move_backward(inner->children + slot + 1, inner->children + inner->count + 1,
+                               inner->children + inner->count + 2);
+            inner->keys[slot] = key;
+            inner->children[slot + 1] = right;
+            inner->count++;
+        }
+
+        // 删除 keys[slot] 以及它右侧的子节点 children[slot + 1]
+        static void inner_erase(Inner* inner, size_t slot) {
+            std::move(inner->keys + slot + 1, inner->keys + inner->count, inner->keys + slot);
+            std::move(inner->children + slot + 2, inner->children + inner->count + 1, inner->children + slot + 1);
+            inner->count--;
+        }
+
+        // 叶子分裂后把 (separator, right) 逐层插入父节点，满的父节点继续分裂。
+        // spares 中预先分配好了可能用到的全部内部节点，这一步不会因分配失败而中断
+        void insert_into_parent(Path& path, K separator, Node* right, Inner** spares) {
+            for (size_t d = path.depth; d-- > 0;) {
+                Inner* inner = path.nodes[d];
+                size_t slot = path.slots[d];
+                if (inner->count < Order) {
+                    inner_insert(inner, slot, separator, right);
+                    return;
+                }
+
+                // 把 Order + 1 个键和 Order + 2 个子节点分成两半，中间的键上移
+                K keys[Order + 1];
+                Node* children[Order + 2];
+                std::move(inner->keys, inner->keys + slot, keys);
+                keys[slot] = std::move(separator);
+                std::move(inner->keys + slot, inner->keys + Order, keys + slot + 1);
+                std::copy(inner->children, inner->children + slot + 1, children);
+                children[slot + 1] = right;
+                std::copy(inner->children + slot + 1, inner->children + Order + 1, children + slot + 2);
+
+                size_t mid = (Order + 1) / 2;
+                Inner* sibling = *spares++;
+                std::move(keys, keys + mid, inner->keys);
+                std::copy(children, children + mid + 1, inner->children);
+                inner->count = static_cast<uint32_t>(mid);
+                std::move(keys + mid + 1, keys + Order + 1, sibling->keys);
+                std::copy(children + mid + 1, children + Order + 2, sibling->children);
+                sibling->count = static_cast<uint32_t>(Order - mid);
+
+                separator = std::move(keys[mid]);
+                right = sibling;
+            }
+
+            Inner* root = *spares;
+            root->keys[0] = std::move(separator);
+            root->children[0] = root_;
+            root->children[1] = right;
+            root->count = 1;
+            root_ = root;
+            height_++;
+        }
+
+        template <typename M>
+        std::pair<BPlusTreeIterator<K, V, Order>, bool> insert_unique(const K& key, M&& value, bool assign) {
+            if (root_ == nullptr) {
+                root_ = first_ = last_ = create_leaf();
+                height_ = 1;
+            }
+
+            Path path;
+            Leaf* leaf = find_leaf(key, &path);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, key, comp_);
+            if (pos < leaf->count && !comp_(key, leaf->keys[pos])) {
+                if (assign) leaf->values[pos] = std::forward<M>(value);
+                return {BPlusTreeIterator<K, V, Order>(leaf, pos), false};
+            }
+
+            if (leaf->count < Order) {
+                leaf_insert(leaf, pos, key, std::forward<M>(value));
+                size_++;
+                return {BPlusTreeIterator<K, V, Order>(leaf, pos), true};
+            }
+
+            // 先分配好分裂需要的全部节点：新叶子、沿途满的内部节点的兄弟、可能的新根
+            size_t splits = 0;
+            while (splits < path.depth && path.nodes[path.depth - 1 - splits]->count == Order) splits++;
+            size_t needed = splits + (splits == path.depth ? 1 : 0);
+            Inner* spares[kMaxHeight + 1];
+            Leaf* right = create_leaf();
+            size_t allocated = 0;
+            try {
+                for (; allocated < needed; allocated++) {
+                    spares[allocated] = create_inner();
+                }
+            } catch (...) {
+                for (size_t i = 0; i < allocated; i++) {
+                    destroy_inner(spares[i]);
+                }
+                destroy_leaf(right);
+                throw;
+            }
+
+            // 在最后一个叶子末尾追加时只把新键放进新叶子，顺序写入能得到满的叶子
+            if (leaf == last_ && pos == Order) {
+                link_after(leaf, right);
+                leaf = right;
+                pos = 0;
+            } else {
+                leaf_move_tail(leaf, Order - Order / 2, right);
+                link_after(leaf, right);
+                if (pos > leaf->count) {
+                    pos -= leaf->count;
+                    leaf = right;
+                }
+            }
+            leaf_insert(leaf, pos, key, std::forward<M>(value));
+            size_++;
+            this->count_splits(1 + splits);
+            insert_into_parent(path, right->keys[0], right, spares);
+            return {BPlusTreeIterator<K, V, Order>(leaf, pos), true};
+        }
+
+        // 叶子删除后不足 kMinKeys 个键：先向左右兄弟借，借不到就与兄弟合并
+        void rebalance_leaf(Leaf* leaf, Path& path) {
+            size_t d = path.depth - 1;
+            Inner* parent = path.nodes[d];
+            size_t slot = path.slots[d];
+            Leaf* left = slot > 0 ? static_cast<Leaf*>(parent->children[slot - 1]) : nullptr;
+            Leaf* right = slot < parent->count ? static_cast<Leaf*>(parent->children[slot + 1]) : nullptr;
+
+            if (left != nullptr && left->count > kMinKeys) {
+                leaf_insert(leaf, 0, left->keys[left->count - 1], std::move(left->values[left->count - 1]));
+                left->count--;
+                parent->keys[slot - 1] = leaf->keys[0];
+                this->count_rotations(1);
+                return;
+            }
+            if (right != nullptr && right->count > kMinKeys) {
+                leaf->keys[leaf->count] = std::move(right->keys[0]);
+                leaf->values[leaf->count] = std::move(right->values[0]);
+                leaf->count++;
+                leaf_erase(right, 0);
+                parent->keys[slot] = right->keys[0];
+                this->count_rotations(1);
+                return;
+            }
+
+            if (left != nullptr) {
+                leaf_move_tail(leaf, 0, left);
+                unlink(leaf);
+                destroy_leaf(leaf);
+                inner_erase(parent, slot - 1);
+            } else {
+                leaf_move_tail(right, 0, leaf);
+                unlink(right);
+                destroy_leaf(right);
+                inner_erase(parent, slot);
+            }
+            rebalance_inner(path, d);
+        }
+
+        void rebalance_inner(Path& path, size_t d) {
+            for (;; d--) {
+                Inner* node = path.nodes[d];
+                if (d == 0) {
+                    if (node->count == 0) {
+                        root_ = node->children[0];
+                        destroy_inner(node);
+                        height_--;
+                    }
+                    return;
+                }
+                if (node->count >= kMinKeys) return;
+
+                Inner* parent = path.nodes[d - 1];
+                size_t slot = path.slots[d - 1];
+                Inner* left = slot > 0 ? static_cast<Inner*>(parent->children[slot - 1]) : nullptr;
+                Inner* right = slot < parent->count ? static_cast<Inner*>(parent->children[slot + 1]) : nullptr;
+
+                // 借用时经父节点旋转一个键
+                if (left != nullptr && left->count > kMinKeys) {
+                    std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+                    std::move_backward(node->children, node->children + node->count + 1,
+                                       node->children + node->count + 2);
+                    node->keys[0] = std::move(parent->keys[slot - 1]);
+                    node->children[0] = left->children[left->count];
+                    parent->keys[slot - 1] = std::move(left->keys[left->count - 1]);
+                    left->count--;
+                    node->count++;
+                    this->count_rotations(1);
+                    return;
+                }
+                if (right != nullptr && right->count > kMinKeys) {
+                    node->keys[node->count] = std::move(parent->keys[slot]);
+                    node->children[node->count + 1] = right->children[0];
+                    node->count++;
+                    parent->keys[slot] = std::move(right->keys[0]);
+                    std::move(right->keys + 1, right->keys + right->count, right->keys);
+                    std::move(right->children + 1, right->children + right->count + 1, right->children);
+                    right->count--;
+                    this->count_rotations(1);
+                    return;
+                }
+
+                // 合并时父节点中的分隔键下移到合并后的节点中间
+                Inner* dst = left != nullptr ? left : node;
+                Inner* src = left != nullptr ? node : right;
+                size_t key_slot = left != nullptr ? slot - 1 : slot;
+                dst->keys[dst->count] = std::move(parent->keys[key_slot]);
+                std::move(src->keys, src->keys + src->count, dst->keys + dst->count + 1);
+                std::copy(src->children, src->children + src->count + 1, dst->children + dst->count + 1);
+                dst->count += src->count + 1;
+                destroy_inner(src);
+                inner_erase(parent, key_slot);
+            }
+        }
+
+        // 批量构建：按顺序填满叶子，再逐层向上建立内部节点
+        template <typename M>
+        void bulk_append(const K& key, M&& value) {
+            if (last_ == nullptr) {
+                first_ = last_ = create_leaf();
+            } else if (!comp_(last_->keys[last_->count - 1], key)) {
+                throw std::invalid_argument("BPlusTree bulk load input must be strictly increasing");
+            }
+            if (last_->count == Order) {
+                Leaf* leaf = create_leaf();
+                link_after(last_, leaf);
+            }
+            last_->keys[last_->count] = key;
+            last_->values[last_->count] = std::forward<M>(value);
+            last_->count++;
+            size_++;
+        }
+
+        void bulk_finish() {
+            if (first_ == nullptr) return;
+
+            // 最后一个叶子不足时从前一个叶子匀过来
+            if (last_->prev != nullptr && last_->count < kMinKeys) {
+                Leaf* prev = last_->prev;
+                size_t moved = kMinKeys - last_->count;
+                std::move_backward(last_->keys, last_->keys + last_->count, last_->keys + last_->count + moved);
+                std::move_backward(last_->values, last_->values + last_->count, last_->values + last_->count + moved);
+                std::move(prev->keys + prev->count - moved, prev->keys + prev->count, last_->keys);
+                std::move(prev->values + prev->count - moved, prev->values + prev->count, last_->values);
+                prev->count -= static_cast<uint32_t>(moved);
+                last_->count += static_cast<uint32_t>(moved);
+            }
+
+            // level 中保存每个节点及其子树的最小键
+            std::vector<std::pair<Node*, const K*>> level;
+            for (Leaf* leaf = first_; leaf != nullptr; leaf = leaf->next) {
+                level.emplace_back(leaf, &leaf->keys[0]);
+            }
+            height_ = 1;
+
+            // 内部节点全部建好后才挂到 root_ 上，中途失败时在这里释放
+            std::vector<Inner*> created;
+            try {
+                build_levels(level, created);
+            } catch (...) {
+                for (Inner* inner : created) {
+                    destroy_inner(inner);
+                }
+                throw;
+            }
+            root_ = level[0].first;
+        }
+
+        void build_levels(std::vector<std::pair<Node*, const K*>>& level, std::vector<Inner*>& created) {
+            while (level.size() > 1) {
+                size_t groups = (level.size() + Order) / (Order + 1);
+                std::vector<std::pair<Node*, const K*>> parents;
+                parents.reserve(groups);
+                size_t begin = 0;
+                for (size_t g = 0; g < groups; g++) {
+                    // 最后两组平分剩余的子节点，避免最后一个节点过小
+                    size_t remaining = level.size() - begin;
+                    size_t take = std::min(remaining, Order + 1);
+                    if (g + 2 == groups && remaining < 2 * (Order + 1)) take = remaining - remaining / 2;
+
+                    created.reserve(created.size() + 1);
+                    Inner* inner = create_inner();
+                    created.push_back(inner);
+                    parents.emplace_back(inner, level[begin].second);
+                    for (size_t i = 0; i < take; i++) {
+                        inner->children[i] = level[begin + i].first;
+                        if (i > 0) inner->keys[i - 1] = *level[begin + i].second;
+                    }
+                    inner->count = static_cast<uint32_t>(take - 1);
+                    begin += take;
+                }
+                level.swap(parents);
+                height_++;
+            }
+        }
+
+        // 批量构建失败时释放已建好的叶子
+        void abandon_bulk() {
+            Leaf* leaf = first_;
+            while (leaf != nullptr) {
+                Leaf* next = leaf->next;
+                destroy_leaf(leaf);
+                leaf = next;
+            }
+            root_ = first_ = last_ = nullptr;
+            size_ = 0;
+            height_ = 0;
+        }
+
+        // 在空树上按顺序构建：fill 依次调用 bulk_append
+        template <typename Fill>
+        void rebuild(Fill fill) {
+            try {
+                fill();
+                bulk_finish();
+            } catch (...) {
+                abandon_bulk();
+                throw;
+            }
+        }
+
+        void copy_from(const BPlusTree& other) {
+            rebuild([&] {
+                for (const Leaf* leaf = other.first_; leaf != nullptr; leaf = leaf->next) {
+                    for (size_t i = 0; i < leaf->count; i++) {
+                        bulk_append(leaf->keys[i], leaf->values[i]);
+                    }
+                }
+            });
+        }
+
+        void steal(BPlusTree& other) {
+            root_ = other.root_;
+            first_ = other.first_;
+            last_ = other.last_;
+            size_ = other.size_;
+            height_ = other.height_;
+            other.root_ = other.first_ = other.last_ = nullptr;
+            other.size_ = 0;
+            other.height_ = 0;
+        }
+
+        bool validate_node(const Node* node, size_t depth, const K* lower, const K* upper, const Leaf*& expected_leaf) const {
+            bool is_root = node == root_;
+            if (node->count > Order) return false;
+            const K* keys = node->leaf ? static_cast<const Leaf*>(node)->keys : static_cast<const Inner*>(node)->keys;
+            for (size_t i = 0; i < node->count; i++) {
+                if (i > 0 && !comp_(keys[i - 1], keys[i])) return false;
+                if (lower != nullptr && comp_(keys[i], *lower)) return false;
+                if (upper != nullptr && !comp_(keys[i], *upper)) return false;
+            }
+
+            if (node->leaf) {
+                const Leaf* leaf = static_cast<const Leaf*>(node);
+                if (depth + 1 != height_ || leaf != expected_leaf) return false;
+                if (!is_root && leaf->count == 0) return false;
+                expected_leaf = leaf->next;
+                return true;
+            }
+
+            const Inner* inner = static_cast<const Inner*>(node);
+            if (!is_root && inner->count < kMinKeys) return false;
+            if (is_root && inner->count == 0) return false;
+            for (size_t i = 0; i <= inner->count; i++) {
+                const K* child_lower = i == 0 ? lower : &inner->keys[i - 1];
+                const K* child_upper = i == inner->count ? upper : &inner->keys[i];
+                if (!validate_node(inner->children[i], depth + 1, child_lower, child_upper, expected_leaf)) return false;
+            }
+            return true;
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using iterator = BPlusTreeIterator<K, V, Order>;
+
+        explicit BPlusTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : root_(nullptr), first_(nullptr), last_(nullptr), size_(0), height_(0), comp_(comp), alloc_(alloc) {}
+
+        // 由严格递增的 (key, value) 序列在 O(n) 内构建，叶子基本填满；输入无序时抛出 std::invalid_argument
+        template <typename InputIt>
+        BPlusTree(sorted_input_t, InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : BPlusTree(comp, alloc) {
+            rebuild([&] {
+                for (; first != last; ++first) {
+                    auto&& entry = *first;
+                    bulk_append(entry.first, entry.second);
+                }
+            });
+        }
+
+        BPlusTree(const BPlusTree& other)
+            : BPlusTree(other.comp_, std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc_)) {
+            copy_from(other);
+        }
+
+        BPlusTree(BPlusTree&& other) noexcept : comp_(other.comp_), alloc_(std::move(other.alloc_)) {
+            steal(other);
+        }
+
+        ~BPlusTree() {
+            clear();
+        }
+
+        BPlusTree& operator=(const BPlusTree& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            copy_from(other);
+            return *this;
+        }
+
+        BPlusTree& operator=(BPlusTree&& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if constexpr (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+                alloc_ = std::move(other.alloc_);
+                steal(other);
+            } else {
+                if (alloc_ == other.alloc_) {
+                    steal(other);
+                } else {
+                    // 分配器不相等时不能接管对方的节点，按顺序重建
+                    rebuild([&] {
+                        for (Leaf* leaf = other.first_; leaf != nullptr; leaf = leaf->next) {
+                            for (size_t i = 0; i < leaf->count; i++) {
+                                bulk_append(leaf->keys[i], std::move(leaf->values[i]));
+                            }
+                        }
+                    });
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return alloc_;
+        }
+
+        // 键已存在时不修改，返回已有元素
+        std::pair<iterator, bool> insert(const K& key, const V& value) {
+            return insert_unique(key, value, false);
+        }
+
+        std::pair<iterator, bool> insert(const K& key, V&& value) {
+            return insert_unique(key, std::move(value), false);
+        }
+
+        std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+            return insert_unique(key, value, true);
+        }
+
+        V& operator[](const K& key) {
+            return insert_unique(key, V(), false).first.value();
+        }
+
+        V& at(const K& key) {
+            iterator it = find(key);
+            if (it == end()) throw std::out_of_range("Key not found");
+            return it.value();
+        }
+
+        iterator find(const K& key) {
+            if (root_ == nullptr) return end();
+            Leaf* leaf = find_leaf(key, nullptr);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, key, comp_);
+            if (pos < leaf->count && !comp_(key, leaf->keys[pos])) return iterator(leaf, pos);
+            return end();
+        }
+
+        bool contains(const K& key) {
+            return find(key) != end();
+        }
+
+        // 第一个不小于 key 的元素
+        iterator lower_bound(const K& key) {
+            if (root_ == nullptr) return end();
+            Leaf* leaf = find_leaf(key, nullptr);
+            return make_iterator(leaf, Search::lower_bound(leaf->keys, leaf->count, key, comp_));
+        }
+
+        // 第一个大于 key 的元素
+        iterator upper_bound(const K& key) {
+            if (root_ == nullptr) return end();
+            Leaf* leaf = find_leaf(key, nullptr);
+            return make_iterator(leaf, Search::upper_bound(leaf->keys, leaf->count, key, comp_));
+        }
+
+        // 按键序对 [lo, hi) 中的每个元素调用 fn(key, value)，沿叶子链表顺序扫描
+        template <typename Fn>
+        void scan(const K& lo, const K& hi, Fn fn) {
+            if (root_ == nullptr || !comp_(lo, hi)) return;
+            Leaf* leaf = find_leaf(lo, nullptr);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, lo, comp_);
+            for (; leaf != nullptr; leaf = leaf->next, pos = 0) {
+                // 整个叶子都在范围内时省去逐个与 hi 比较
+                bool whole = leaf->count > 0 && comp_(leaf->keys[leaf->count - 1], hi);
+                size_t end = whole ? leaf->count : Search::lower_bound(leaf->keys, leaf->count, hi, comp_);
+                for (size_t i = pos; i < end; i++) {
+                    fn(leaf->keys[i], leaf->values[i]);
+                }
+                if (!whole) return;
+            }
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(const K& key) {
+            if (root_ == nullptr) return 0;
+
+            Path path;
+            Leaf* leaf = find_leaf(key, &path);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, key, comp_);
+            if (pos == leaf->count || comp_(key, leaf->keys[pos])) return 0;
+
+            leaf_erase(leaf, pos);
+            size_--;
+            if (path.depth > 0 && leaf->count < kMinKeys) rebalance_leaf(leaf, path);
+            return 1;
+        }
+
+        void clear() {
+            if (root_ != nullptr) destroy_subtree(root_);
+            root_ = first_ = last_ = nullptr;
+            size_ = 0;
+            height_ = 0;
+        }
+
+        size_t size() {
+            return size_;
+        }
+
+        bool empty() {
+            return size_ == 0;
+        }
+
+        // 根到叶子的层数，空树为 0
+        size_t height() {
+            return height_;
+        }
+
+        // 检查结构不变量：键有序、分隔键约束子树、叶子同层且链表完整、节点键数在范围内
+        bool validate() const {
+            if (root_ == nullptr) return size_ == 0 && first_ == nullptr && last_ == nullptr;
+            const Leaf* expected_leaf = first_;
+            if (!validate_node(root_, 0, nullptr, nullptr, expected_leaf) || expected_leaf != nullptr) return false;
+
+            size_t count = 0;
+            for (const Leaf* leaf = first_; leaf != nullptr; leaf = leaf->next) {
+                count += leaf->count;
+                if (leaf->next == nullptr && leaf != last_) return false;
+            }
+            return count == size_;
+        }
+
+        // Stats 为 Linear::stats::none 时全为零
+        Linear::stats::Counters stats() const {
+            return this->counters();
+        }
+
+        iterator begin() {
+            return root_ == nullptr ? iterator() : make_iterator(first_, 0);
+        }
+
+        iterator end() {
+            return root_ == nullptr ? iterator() : iterator(last_, last_->count);
+        }
+    };
+
+    // ------------------------- 页文件 -------------------------
+
+    // 页文件中的节点是固定大小的页，以页号（文件偏移 / PageSize）互相引用，页号 0 是文件头。
+    // 文件按本机字节序和类型布局写出，只能由相同 K、V、PageSize 的程序打开
+    struct MappedPageHeader {
+        uint64_t checksum;
+        uint32_t count;
+        uint32_t leaf;
+        uint64_t prev;  // 叶子的前后兄弟页号，0 表示没有
+        uint64_t next;
+    };
+
+    template <typename K, typename V, size_t PageSize>
+    struct MappedLeafPage : MappedPageHeader {
+        static constexpr size_t kCapacity = (PageSize - sizeof(MappedPageHeader) - alignof(V)) / (sizeof(K) + sizeof(V));
+        K keys[kCapacity];
+        V values[kCapacity];
+    };
+
+    template <typename K, size_t PageSize>
+    struct MappedInnerPage : MappedPageHeader {
+        static constexpr size_t kCapacity =
+            (PageSize - sizeof(MappedPageHeader) - 2 * sizeof(uint64_t)) / (sizeof(K) + sizeof(uint64_t));
+        K keys[kCapacity];
+        uint64_t children[kCapacity + 1];
+    };
+
+    struct MappedFileHeader {
+        uint64_t checksum;
+        uint64_t magic;
+        uint32_t version;
+        uint32_t page_size;
+        uint32_t key_size;
+        uint32_t value_size;
+        uint32_t leaf_capacity;
+        uint32_t inner_capacity;
+        uint64_t size;
+        uint64_t page_count;
+        uint64_t root;  // 空树为 0
+        uint64_t first_leaf;
+        uint64_t last_leaf;
+        uint64_t height;
+    };
+
+    // 打开页文件时的校验方式：不校验、每页首次访问时校验、打开时校验全部页
+    enum class PageCheck { none, on_access, eager };
+
+    namespace detail {
+        // 页校验和：4 路独立的乘法混合，页首的校验和字段按 0 计入
+        inline uint64_t page_checksum(const unsigned char* page, size_t size) {
+            const uint64_t prime = 0x100000001B3ull;
+            uint64_t lanes[4] = {0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0x27D4EB2F165667C5ull};
+            for (size_t i = 0; i < size; i += 4 * sizeof(uint64_t)) {
+                for (size_t j = 0; j < 4; j++) {
+                    uint64_t word = 0;
+                    if (i + j != 0) std::memcpy(&word, page + i + j * sizeof(uint64_t), sizeof(uint64_t));
+                    lanes[j] = (lanes[j] ^ word) * prime;
+                    lanes[j] ^= lanes[j] >> 32;
+                }
+            }
+            uint64_t hash = size;
+            for (uint64_t lane : lanes) {
+                hash = (hash ^ lane) * prime;
+                hash ^= hash >> 29;
+            }
+            return hash;
+        }
+    }
+
+    // 只读的 B+ 树页文件：build_to_file 把有序序列写成页文件，open 只映射文件、校验文件头，
+    // 节点在查询触及时才由操作系统读入，打开预先构建好的索引几乎没有启动开销。
+    // K 与 V 必须可平凡复制；写入新内容需要重新 build_to_file。
+    // 打开后的只读查询可以在多个线程中同时进行，on_access 模式下各页的校验标记是原子的
+    template <typename K, typename V, typename Compare = std::less<K>, typename Search = search::default_policy<K>,
+              size_t PageSize = 4096>
+    class MappedBPlusTree {
+        static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,
+                      "MappedBPlusTree stores keys and values as raw bytes");
+        static_assert(PageSize % 64 == 0 && PageSize >= 256, "PageSize must be a multiple of 64, at least 256");
+
+    private:
+        using Leaf = MappedLeafPage<K, V, PageSize>;
+        using Inner = MappedInnerPage<K, PageSize>;
+
+        static_assert(sizeof(Leaf) <= PageSize && sizeof(Inner) <= PageSize, "node layout exceeds PageSize");
+        static_assert(Leaf::kCapacity >= 2 && Inner::kCapacity >= 2, "PageSize is too small for K and V");
+
+        // 小端序下为 "BPTREE1\0"
+        static constexpr uint64_t kMagic = 0x0031454552545042ull;
+        static constexpr uint32_t kVersion = 1;
+
+        MappedFile file_;
+        MappedFileHeader header_;
+        PageCheck check_;
+        // on_access 模式下各页是否已校验。两个线程同时首次访问同一页时都会校验一次，结果相同
+        std::unique_ptr<std::atomic<uint8_t>[]> checked_;
+        Compare comp_;
+
+        [[noreturn]] static void corrupt(uint64_t page) {
+            throw std::runtime_error("MappedBPlusTree: corrupt page " + std::to_string(page));
+        }
+
+        const unsigned char* page_data(uint64_t page) const {
+            if (page == 0 || page >= header_.page_count) corrupt(page);
+            const unsigned char* data = file_.data() + page * PageSize;
+            if (check_ == PageCheck::on_access && !checked_[page].load(std::memory_order_relaxed)) {
+                if (detail::page_checksum(data, PageSize) != reinterpret_cast<const MappedPageHeader*>(data)->checksum) {
+                    corrupt(page);
+                }
+                checked_[page].store(1, std::memory_order_relaxed);
+            }
+            return data;
+        }
+
+        const Leaf* leaf_at(uint64_t page) const {
+            const Leaf* leaf = reinterpret_cast<const Leaf*>(page_data(page));
+            if (!leaf->leaf || leaf->count > Leaf::kCapacity) corrupt(page);
+            return leaf;
+        }
+
+        const Inner* inner_at(uint64_t page) const {
+            const Inner* inner = reinterpret_cast<const Inner*>(page_data(page));
+            if (inner->leaf || inner->count > Inner::kCapacity) corrupt(page);
+            return inner;
+        }
+
+        const Leaf* find_leaf(const K& key) const {
+            uint64_t page = header_.root;
+            for (uint64_t level = header_.height; level > 1; level--) {
+                const Inner* inner = inner_at(page);
+                page = inner->children[Search::upper_bound(inner->keys, inner->count, key, comp_)];
+            }
+            return leaf_at(page);
+        }
+
+        void steal(MappedBPlusTree& other) {
+            file_ = std::move(other.file_);
+            header_ = other.header_;
+            check_ = other.check_;
+            checked_ = std::move(other.checked_);
+            other.header_ = MappedFileHeader();
+        }
+
+        bool validate_node(uint64_t page, size_t depth, const K* lower, const K* upper, uint64_t& expected_leaf,
+                           uint64_t& count) const {
+            if (page == 0 || page >= header_.page_count || depth >= header_.height) return false;
+            const MappedPageHeader* node = reinterpret_cast<const MappedPageHeader*>(file_.data() + page * PageSize);
+            bool is_leaf = depth + 1 == header_.height;
+            if ((node->leaf != 0) != is_leaf) return false;
+            if (node->count > (is_leaf ? Leaf::kCapacity : Inner::kCapacity)) return false;
+
+            const K* keys = is_leaf ? static_cast<const Leaf*>(node)->keys : static_cast<const Inner*>(node)->keys;
+            for (size_t i = 0; i < node->count; i++) {
+                if (i > 0 && !comp_(keys[i - 1], keys[i])) return false;
+                if (lower != nullptr && comp_(keys[i], *lower)) return false;
+                if (upper != nullptr && !comp_(keys[i], *upper)) return false;
+            }
+
+            if (is_leaf) {
+                if (page != expected_leaf || node->count == 0) return false;
+                count += node->count;
+                expected_leaf = node->next;
+                return true;
+            }
+
+            const Inner* inner = static_cast<const Inner*>(node);
+            for (size_t i = 0; i <= inner->count; i++) {
+                const K* child_lower = i == 0 ? lower : &inner->keys[i - 1];
+                const K* child_upper = i == inner->count ? upper : &inner->keys[i];
+                if (!validate_node(inner->children[i], depth + 1, child_lower, child_upper, expected_leaf, count)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static void write_page(std::ofstream& out, unsigned char* page) {
+            reinterpret_cast<MappedPageHeader*>(page)->checksum = detail::page_checksum(page, PageSize);
+            out.write(reinterpret_cast<const char*>(page), PageSize);
+        }
+
+        // 叶子占用页 1..L，之后逐层写内部节点，页号即写入次序；文件头最后回填到页 0
+        template <typename InputIt>
+        static void write_pages(std::ofstream& out, InputIt first, InputIt last, const Compare& comp) {
+            std::unique_ptr<unsigned char[]> buffer(new unsigned char[PageSize]);
+            unsigned char* page = buffer.get();
+            std::memset(page, 0, PageSize);
+            out.write(reinterpret_cast<const char*>(page), PageSize);
+
+            MappedFileHeader header = MappedFileHeader();
+            uint64_t next_page = 1;
+            // level 中保存每个节点的页号及其子树的最小键
+            std::vector<std::pair<uint64_t, K>> level;
+
+            Leaf* leaf = nullptr;
+            for (; first != last; ++first) {
+                auto&& entry = *first;
+                if (leaf != nullptr && !comp(leaf->keys[leaf->count - 1], entry.first)) {
+                    throw std::invalid_argument("MappedBPlusTree input must be strictly increasing");
+                }
+                if (leaf != nullptr && leaf->count == Leaf::kCapacity) {
+                    leaf->next = next_page + 1;
+                    write_page(out, page);
+                    next_page++;
+                    leaf = nullptr;
+                }
+                if (leaf == nullptr) {
+                    leaf = new (page) Leaf();
+                    leaf->leaf = 1;
+                    leaf->prev = next_page > 1 ? next_page - 1 : 0;
+                    level.emplace_back(next_page, entry.first);
+                }
+                leaf->keys[leaf->count] = entry.first;
+                leaf->values[leaf->count] = entry.second;
+                leaf->count++;
+                header.size++;
+            }
+            if (leaf != nullptr) {
+                write_page(out, page);
+                header.first_leaf = 1;
+                header.last_leaf = next_page;
+                header.height = 1;
+                next_page++;
+            }
+
+            while (level.size() > 1) {
+                size_t groups = (level.size() + Inner::kCapacity) / (Inner::kCapacity + 1);
+                std::vector<std::pair<uint64_t, K>> parents;
+                parents.reserve(groups);
+                size_t begin = 0;
+                for (size_t g = 0; g < groups; g++) {
+                    // 最后两组平分剩余的子节点，避免最后一个节点过小
+                    size_t remaining = level.size() - begin;
+                    size_t take = std::min(remaining, Inner::kCapacity + 1);
+                    if (g + 2 == groups && remaining < 2 * (Inner::kCapacity + 1)) take = remaining - remaining / 2;
+
+                    Inner* inner = new (page) Inner();
+                    for (size_t i = 0; i < take; i++) {
+                        inner->children[i] = level[begin + i].first;
+                        if (i > 0) inner->keys[i - 1] = level[begin + i].second;
+                    }
+                    inner->count = static_cast<uint32_t>(take - 1);
+                    write_page(out, page);
+                    parents.emplace_back(next_page++, level[begin].second);
+                    begin += take;
+                }
+                level.swap(parents);
+                header.height++;
+            }
+
+            header.magic = kMagic;
+            header.version = kVersion;
+            header.page_size = static_cast<uint32_t>(PageSize);
+            header.key_size = static_cast<uint32_t>(sizeof(K));
+            header.value_size = static_cast<uint32_t>(sizeof(V));
+            header.leaf_capacity = static_cast<uint32_t>(Leaf::kCapacity);
+            header.inner_capacity = static_cast<uint32_t>(Inner::kCapacity);
+            header.page_count = next_page;
+            header.root = level.empty() ? 0 : level[0].first;
+            std::memset(page, 0, PageSize);
+            std::memcpy(page, &header, sizeof(header));
+            out.seekp(0);
+            write_page(out, page);
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = size_t;
+        using key_compare = Compare;
+
+        static constexpr size_t leaf_capacity = Leaf::kCapacity;
+        static constexpr size_t inner_capacity = Inner::kCapacity;
+
+        explicit MappedBPlusTree(const Compare& comp = Compare())
+            : header_(), check_(PageCheck::none), comp_(comp) {}
+
+        explicit MappedBPlusTree(const std::string& path, PageCheck check = PageCheck::on_access,
+                                 const Compare& comp = Compare())
+            : MappedBPlusTree(comp) {
+            open(path, check);
+        }
+
+        MappedBPlusTree(MappedBPlusTree&& other) noexcept : comp_(other.comp_) {
+            steal(other);
+        }
+
+        MappedBPlusTree& operator=(MappedBPlusTree&& other) noexcept {
+            if (this != &other) {
+                comp_ = other.comp_;
+                steal(other);
+            }
+            return *this;
+        }
+
+        // 把严格递增的 (key, value) 序列写成页文件。先写到 path + ".tmp"，完成后替换 path，
+        // 失败时原文件保持不变；输入无序时抛出 std::invalid_argument，写文件失败时抛出 std::runtime_error
+        template <typename InputIt>
+        static void build_to_file(const std::string& path, InputIt first, InputIt last, const Compare& comp = Compare()) {
+            std::string temp = path + ".tmp";
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("MappedBPlusTree: cannot create '" + temp + "'");
+            try {
+                write_pages(out, first, last, comp);
+                out.close();
+                if (!out) throw std::runtime_error("MappedBPlusTree: cannot write '" + temp + "'");
+                std::filesystem::rename(temp, path);
+            } catch (...) {
+                out.close();
+                std::error_code ignored;
+                std::filesystem::remove(temp, ignored);
+                throw;
+            }
+        }
+
+        // 以只读方式打开页文件。文件头总会校验；文件不是页文件、布局与模板参数不符、
+        // 或 eager 模式下有页校验失败时抛出 std::runtime_error
+        void open(const std::string& path, PageCheck check = PageCheck::on_access) {
+            close();
+            MappedFile file(path);
+            auto fail = [&](const char* what) {
+                throw std::runtime_error("MappedBPlusTree: '" + path + "' " + what);
+            };
+            if (file.size() < PageSize || file.size() % PageSize != 0) fail("is not a page file");
+
+            MappedFileHeader header;
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (header.magic != kMagic || header.version != kVersion) fail("is not a page file");
+            if (detail::page_checksum(file.data(), PageSize) != header.checksum) fail("has a corrupt header");
+            if (header.page_size != PageSize || header.key_size != sizeof(K) || header.value_size != sizeof(V) ||
+                header.leaf_capacity != Leaf::kCapacity || header.inner_capacity != Inner::kCapacity) {
+                fail("was written with a different key, value or page layout");
+            }
+            if (header.page_count != file.size() / PageSize || header.root >= header.page_count ||
+                (header.root == 0) != (header.size == 0)) {
+                fail("is truncated or has a corrupt header");
+            }
+
+            file_ = std::move(file);
+            header_ = header;
+            check_ = check;
+            checked_.reset(check == PageCheck::on_access ? new std::atomic<uint8_t>[header.page_count]() : nullptr);
+            if (check == PageCheck::eager && !validate()) {
+                close();
+                fail("failed page verification");
+            }
+        }
+
+        void close() {
+            file_.close();
+            header_ = MappedFileHeader();
+            checked_.reset();
+        }
+
+        bool is_open() const {
+            return file_.is_open();
+        }
+
+        // 提示操作系统按随机访问处理映射，适合以点查询为主的负载
+        void advise_random() const {
+            file_.advise_random();
+        }
+
+        // 查询触及的页在 on_access 模式下首次访问时校验，失败时抛出 std::runtime_error
+        const V* find(const K& key) const {
+            if (header_.root == 0) return nullptr;
+            const Leaf* leaf = find_leaf(key);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, key, comp_);
+            if (pos < leaf->count && !comp_(key, leaf->keys[pos])) return &leaf->values[pos];
+            return nullptr;
+        }
+
+        bool contains(const K& key) const {
+            return find(key) != nullptr;
+        }
+
+        const V& at(const K& key) const {
+            const V* value = find(key);
+            if (value == nullptr) throw std::out_of_range("Key not found");
+            return *value;
+        }
+
+        // 按键序对 [lo, hi) 中的每个元素调用 fn(key, value)
+        template <typename Fn>
+        void scan(const K& lo, const K& hi, Fn fn) const {
+            if (header_.root == 0 || !comp_(lo, hi)) return;
+            const Leaf* leaf = find_leaf(lo);
+            size_t pos = Search::lower_bound(leaf->keys, leaf->count, lo, comp_);
+            for (;;) {
+                bool whole = leaf->count > 0 && comp_(leaf->keys[leaf->count - 1], hi);
+                size_t end = whole ? leaf->count : Search::lower_bound(leaf->keys, leaf->count, hi, comp_);
+                for (size_t i = pos; i < end; i++) {
+                    fn(leaf->keys[i], leaf->values[i]);
+                }
+                if (!whole || leaf->next == 0) return;
+                leaf = leaf_at(leaf->next);
+                pos = 0;
+            }
+        }
+
+        // 按键序对全部元素调用 fn(key, value)
+        template <typename Fn>
+        void for_each(Fn fn) const {
+            for (uint64_t page = header_.first_leaf; page != 0;) {
+                const Leaf* leaf = leaf_at(page);
+                for (size_t i = 0; i < leaf->count; i++) {
+                    fn(leaf->keys[i], leaf->values[i]);
+                }
+                page = leaf->next;
+            }
+        }
+
+        size_t size() const {
+            return static_cast<size_t>(header_.size);
+        }
+
+        bool empty() const {
+            return header_.size == 0;
+        }
+
+        // 根到叶子的层数，空树为 0
+        size_t height() const {
+            return static_cast<size_t>(header_.height);
+        }
+
+        // 读入并校验每一页的校验和，再检查结构不变量：键有序、分隔键约束子树、叶子同层且链表完整。
+        // 会触及整个文件
+        bool validate() const {
+            if (!is_open()) return header_.size == 0;
+            for (uint64_t page = 1; page < header_.page_count; page++) {
+                const unsigned char* data = file_.data() + page * PageSize;
+                if (detail::page_checksum(data, PageSize) != reinterpret_cast<const MappedPageHeader*>(data)->checksum) {
+                    return false;
+                }
+            }
+            if (header_.root == 0) return header_.size == 0 && header_.first_leaf == 0;
+
+            uint64_t expected_leaf = header_.first_leaf;
+            uint64_t count = 0;
+            if (!validate_node(header_.root, 0, nullptr, nullptr, expected_leaf, count)) return false;
+            return expected_leaf == 0 && count == header_.size;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,615 @@
+#ifndef B_TREE_HPP
+#define B_TREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <Linear/Stats.hpp>
+#include <Tree/NodeSearch.hpp>
+
+namespace Tree {
+    namespace detail {
+        // 默认阶数：每个节点的键数组约占 4 个缓存行，整块向量比较 16~64 个键
+        template <typename K>
+        constexpr size_t btree_default_order() {
+            return std::clamp<size_t>(256 / sizeof(K), 16, 64);
+        }
+
+        struct btree_stats_name {
+            static constexpr const char* value = "Tree::BTree";
+        };
+    }
+
+    // 键与值都存放在节点中；叶子没有子节点数组
+    template <typename K, typename V, size_t Order>
+    struct BTreeNode {
+        uint32_t count;
+        bool leaf;
+        K keys[Order];
+        V values[Order];
+    };
+
+    // children[i] 中的键都小于 keys[i]，children[i + 1] 中的键都大于 keys[i]
+    template <typename K, typename V, size_t Order>
+    struct BTreeInner : BTreeNode<K, V, Order> {
+        BTreeNode<K, V, Order>* children[Order + 1];
+    };
+
+    // B 树：Order 为每个节点的最大键数，K 与 V 需要可默认构造。
+    // 查找以节点内搜索为主，Search 为节点内查找策略（见 Tree/NodeSearch.hpp），
+    // 默认（search::default_policy）对 32 位整数与浮点键使用 AVX2/SSE4.2 向量比较，其余情况使用无分支二分查找。
+    // Stats 为计数策略（见 Linear/Stats.hpp），计节点分配、分裂和删除时向兄弟借键（记为旋转）；
+    // 节点内的查找由 Search 完成，不计比较次数
+    template <typename K, typename V, size_t Order = detail::btree_default_order<K>(), typename Compare = std::less<K>,
+              typename Alloc = std::allocator<std::pair<const K, V>>, typename Search = search::default_policy<K>,
+              typename Stats = Linear::stats::default_policy>
+    class BTree : private Linear::stats::Recorder<Stats, detail::btree_stats_name> {
+        static_assert(Order >= 3, "BTree needs an order of at least 3");
+
+    private:
+        using Node = BTreeNode<K, V, Order>;
+        using Inner = BTreeInner<K, V, Order>;
+        using leaf_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using inner_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Inner>;
+        using leaf_traits = std::allocator_traits<leaf_alloc_type>;
+        using inner_traits = std::allocator_traits<inner_alloc_type>;
+
+        // 非根节点至少保留的键数
+        static constexpr size_t kMinKeys = Order / 2;
+        static constexpr size_t kMaxHeight = 64;
+
+        // 从根到当前节点经过的内部节点，以及在每个节点中选择的子节点下标
+        struct Path {
+            Inner* nodes[kMaxHeight];
+            size_t slots[kMaxHeight];
+            size_t depth;
+        };
+
+        Node* root_;
+        size_t size_;
+        size_t height_;
+        Compare comp_;
+        Alloc alloc_;
+
+    private:
+        Node* create_leaf() {
+            this->count_node_allocations(1);
+            leaf_alloc_type alloc(alloc_);
+            Node* node = leaf_traits::allocate(alloc, 1);
+            try {
+                new (node) Node();
+            } catch (...) {
+                leaf_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            node->count = 0;
+            node->leaf = true;
+            return node;
+        }
+
+        Inner* create_inner() {
+            this->count_node_allocations(1);
+            inner_alloc_type alloc(alloc_);
+            Inner* inner = inner_traits::allocate(alloc, 1);
+            try {
+                new (inner) Inner();
+            } catch (...) {
+                inner_traits::deallocate(alloc, inner, 1);
+                throw;
+            }
+            inner->count = 0;
+            inner->leaf = false;
+            return inner;
+        }
+
+        void destroy_leaf(Node* leaf) {
+            leaf_alloc_type alloc(alloc_);
+            leaf->~Node();
+            leaf_traits::deallocate(alloc, leaf, 1);
+        }
+
+        void destroy_inner(Inner* inner) {
+            inner_alloc_type alloc(alloc_);
+            inner->~Inner();
+            inner_traits::deallocate(alloc, inner, 1);
+        }
+
+        void destroy_node(Node* node) {
+            if (node->leaf) {
+                destroy_leaf(node);
+            } else {
+                destroy_inner(static_cast<Inner*>(node));
+            }
+        }
+
+        void destroy_subtree(Node* node) {
+            if (!node->leaf) {
+                Inner* inner = static_cast<Inner*>(node);
+                for (size_t i = 0; i <= inner->count; i++) {
+                    destroy_subtree(inner->children[i]);
+                }
+            }
+            destroy_node(node);
+        }
+
+        Node* copy_subtree(const Node* node) {
+            Node* copy = node->leaf ? create_leaf() : create_inner();
+            size_t copied = 0;
+            try {
+                std::copy(node->keys, node->keys + node->count, copy->keys);
+                std::copy(node->values, node->values + node->count, copy->values);
+                if (!node->leaf) {
+                    for (; copied <= node->count; copied++) {
+                        static_cast<Inner*>(copy)->children[copied] =
+                            copy_subtree(static_cast<const Inner*>(node)->children[copied]);
+                    }
+                }
+            } catch (...) {
+                for (size_t i = 0; i < copied; i++) {
+                    destroy_subtree(static_cast<Inner*>(copy)->children[i]);
+                }
+                destroy_node(copy);
+                throw;
+            }
+            copy->count = node->count;
+            return copy;
+        }
+
+        // 查找 key 所在的节点与下标；找不到时返回 nullptr，path 记录到最后访问的叶子为止
+        Node* locate(const K& key, size_t& pos, Path* path) const {
+            Node* node = root_;
+            size_t depth = 0;
+            while (true) {
+                pos = Search::lower_bound(node->keys, node->count, key, comp_);
+                if (pos < node->count && !comp_(key, node->keys[pos])) break;
+                if (node->leaf) {
+                    node = nullptr;
+                    break;
+                }
+                Inner* inner = static_cast<Inner*>(node);
+                if (path != nullptr) {
+                    path->nodes[depth] = inner;
+                    path->slots[depth] = pos;
+                }
+                depth++;
+                node = inner->children[pos];
+            }
+            if (path != nullptr) path->depth = depth;
+            return node;
+        }
+
+        template <typename M>
+        static void node_insert(Node* node, size_t pos, const K& key, M&& value) {
+            std::move_backward(node->keys + pos, node->keys + node->count, node->keys + node->count + 1);
+            std::move_backward(node->values + pos, node->values + node->count, node->values + node->count + 1);
+            node->keys[pos] = key;
+            node->values[pos] = std::forward<M>(value);
+            node->count++;
+        }
+
+        // 删除 keys[pos]；内部节点同时删除它右侧的子节点 children[pos + 1]
+        static void node_erase(Node* node, size_t pos) {
+            std::move(node->keys + pos + 1, node->keys + node->count, node->keys + pos);
+            std::move(node->values + pos + 1, node->values + node->count, node->values + pos);
+            if (!node->leaf) {
+                Inner* inner = static_cast<Inner*>(node);
+                std::move(inner->children + pos + 2, inner->children + inner->count + 1, inner->children + pos + 1);
+            }
+            node->count--;
+        }
+
+        // 向满节点 node 的 pos 处插入 (key, value)，键值分成两半放入 node 与 sibling，中间的键值放入 key/value 上移
+        void split_entries(Node* node, size_t pos, K& key, V& value, Node* sibling) {
+            this->count_splits(1);
+            K keys[Order + 1];
+            V values[Order + 1];
+            std::move(node->keys, node->keys + pos, keys);
+            std::move(node->values, node->values + pos, values);
+            keys[pos] = std::move(key);
+            values[pos] = std::move(value);
+            std::move(node->keys + pos, node->keys + Order, keys + pos + 1);
+            std::move(node->values + pos, node->values + Order, values + pos + 1);
+
+            size_t mid = (Order + 1) / 2;
+            std::move(keys, keys + mid, node->keys);
+            std::move(values, values + mid, node->values);
+            std::move(keys + mid + 1, keys + Order + 1, sibling->keys);
+            std::move(values + mid + 1, values + Order + 1, sibling->values);
+            node->count = static_cast<uint32_t>(mid);
+            sibling->count = static_cast<uint32_t>(Order - mid);
+
+            key = std::move(keys[mid]);
+            value = std::move(values[mid]);
+        }
+
+        // 满叶子分裂，right 置为新的兄弟叶子
+        void split_leaf(Node* leaf, size_t pos, K& key, V& value, Node*& right, Node* sibling) {
+            split_entries(leaf, pos, key, value, sibling);
+            right = sibling;
+        }
+
+        // 满内部节点分裂：right 为插入键右侧的子节点，分裂后置为新的兄弟节点
+        void split_inner(Inner* node, size_t pos, K& key, V& value, Node*& right, Inner* sibling) {
+            size_t mid = (Order + 1) / 2;
+            Node* children[Order + 2];
+            std::copy(node->children, node->children + pos + 1, children);
+            children[pos + 1] = right;
+            std::copy(node->children + pos + 1, node->children + Order + 1, children + pos + 2);
+            std::copy(children, children + mid + 1, node->children);
+            std::copy(children + mid + 1, children + Order + 2, sibling->children);
+
+            split_entries(node, pos, key, value, sibling);
+            right = sibling;
+        }
+
+        template <typename M>
+        std::pair<V*, bool> insert_unique(const K& key, M&& value, bool assign) {
+            if (root_ == nullptr) {
+                root_ = create_leaf();
+                height_ = 1;
+            }
+
+            Path path;
+            size_t pos;
+            Node* found = locate(key, pos, &path);
+            if (found != nullptr) {
+                if (assign) found->values[pos] = std::forward<M>(value);
+                return {&found->values[pos], false};
+            }
+
+            Node* leaf = path.depth == 0 ? root_ : path.nodes[path.depth - 1]->children[path.slots[path.depth - 1]];
+            if (leaf->count < Order) {
+                node_insert(leaf, pos, key, std::forward<M>(value));
+                size_++;
+                return {&leaf->values[pos], true};
+            }
+
+            // 先分配好分裂需要的全部节点：叶子的兄弟、沿途满的内部节点的兄弟、可能的新根
+            size_t splits = 0;
+            while (splits < path.depth && path.nodes[path.depth - 1 - splits]->count == Order) splits++;
+            Node* leaf_sibling = create_leaf();
+            Inner* spares[kMaxHeight + 1];
+            size_t needed = splits + (splits == path.depth ? 1 : 0);
+            size_t allocated = 0;
+            try {
+                for (; allocated < needed; allocated++) {
+                    spares[allocated] = create_inner();
+                }
+            } catch (...) {
+                for (size_t i = 0; i < allocated; i++) {
+                    destroy_inner(spares[i]);
+                }
+                destroy_leaf(leaf_sibling);
+                throw;
+            }
+
+            // 分裂后新键可能上移，插入完成后再查找一次它的位置
+            K up_key = key;
+            V up_value(std::forward<M>(value));
+            Node* right = nullptr;
+            Inner** spare = spares;
+            split_leaf(leaf, pos, up_key, up_value, right, leaf_sibling);
+            bool new_root = true;
+            for (size_t d = path.depth; d-- > 0;) {
+                Inner* inner = path.nodes[d];
+                size_t slot = path.slots[d];
+                if (inner->count < Order) {
+                    node_insert(inner, slot, up_key, std::move(up_value));
+                    std::move_backward(inner->children + slot + 1, inner->children + inner->count,
+                                       inner->children + inner->count + 1);
+                    inner->children[slot + 1] = right;
+                    new_root = false;
+                    break;
+                }
+                split_inner(inner, slot, up_key, up_value, right, *spare++);
+            }
+            if (new_root) {
+                Inner* root = *spare;
+                root->keys[0] = std::move(up_key);
+                root->values[0] = std::move(up_value);
+                root->children[0] = root_;
+                root->children[1] = right;
+                root->count = 1;
+                root_ = root;
+                height_++;
+            }
+            size_++;
+
+            Node* node = locate(key, pos, nullptr);
+            return {&node->values[pos], true};
+        }
+
+        // 节点删除后不足 kMinKeys 个键：经父节点向兄弟借一个键，借不到就与兄弟合并，合并可能继续向上传递
+        void rebalance(Path& path, size_t d) {
+            for (;; d--) {
+                Node* node = d == path.depth ? nullptr : path.nodes[d];
+                if (node == nullptr) {
+                    node = path.depth == 0 ? root_ : path.nodes[path.depth - 1]->children[path.slots[path.depth - 1]];
+                }
+                if (d == 0) {
+                    if (node->count == 0 && !node->leaf) {
+                        root_ = static_cast<Inner*>(node)->children[0];
+                        destroy_inner(static_cast<Inner*>(node));
+                        height_--;
+                    }
+                    return;
+                }
+                if (node->count >= kMinKeys) return;
+
+                Inner* parent = path.nodes[d - 1];
+                size_t slot = path.slots[d - 1];
+                Node* left = slot > 0 ? parent->children[slot - 1] : nullptr;
+                Node* right = slot < parent->count ? parent->children[slot + 1] : nullptr;
+
+                if (left != nullptr && left->count > kMinKeys) {
+                    size_t last = left->count - 1;
+                    node_insert(node, 0, parent->keys[slot - 1], std::move(parent->values[slot - 1]));
+                    parent->keys[slot - 1] = std::move(left->keys[last]);
+                    parent->values[slot - 1] = std::move(left->values[last]);
+                    if (!node->leaf) {
+                        Inner* inner = static_cast<Inner*>(node);
+                        std::move_backward(inner->children, inner->children + inner->count, inner->children + inner->count + 1);
+                        inner->children[0] = static_cast<Inner*>(left)->children[last + 1];
+                    }
+                    left->count--;
+                    this->count_rotations(1);
+                    return;
+                }
+                if (right != nullptr && right->count > kMinKeys) {
+                    node->keys[node->count] = std::move(parent->keys[slot]);
+                    node->values[node->count] = std::move(parent->values[slot]);
+                    parent->keys[slot] = std::move(right->keys[0]);
+                    parent->values[slot] = std::move(right->values[0]);
+                    if (!node->leaf) {
+                        Inner* inner = static_cast<Inner*>(node);
+                        Inner* right_inner = static_cast<Inner*>(right);
+                        inner->children[node->count + 1] = right_inner->children[0];
+                        std::move(right_inner->children + 1, right_inner->children + right->count + 1, right_inner->children);
+                    }
+                    node->count++;
+                    std::move(right->keys + 1, right->keys + right->count, right->keys);
+                    std::move(right->values + 1, right->values + right->count, right->values);
+                    right->count--;
+                    this->count_rotations(1);
+                    return;
+                }
+
+                // 合并时父节点中的分隔键值下移到合并后的节点中间
+                Node* dst = left != nullptr ? left : node;
+                Node* src = left != nullptr ? node : right;
+                size_t key_slot = left != nullptr ? slot - 1 : slot;
+                dst->keys[dst->count] = std::move(parent->keys[key_slot]);
+                dst->values[dst->count] = std::move(parent->values[key_slot]);
+                std::move(src->keys, src->keys + src->count, dst->keys + dst->count + 1);
+                std::move(src->values, src->values + src->count, dst->values + dst->count + 1);
+                if (!dst->leaf) {
+                    std::copy(static_cast<Inner*>(src)->children, static_cast<Inner*>(src)->children + src->count + 1,
+                              static_cast<Inner*>(dst)->children + dst->count + 1);
+                }
+                dst->count += src->count + 1;
+                destroy_node(src);
+                node_erase(parent, key_slot);
+            }
+        }
+
+        void steal(BTree& other) {
+            root_ = other.root_;
+            size_ = other.size_;
+            height_ = other.height_;
+            other.root_ = nullptr;
+            other.size_ = 0;
+            other.height_ = 0;
+        }
+
+        template <typename Fn>
+        static void visit(Node* node, Fn& fn) {
+            if (node->leaf) {
+                for (size_t i = 0; i < node->count; i++) {
+                    fn(node->keys[i], node->values[i]);
+                }
+                return;
+            }
+            Inner* inner = static_cast<Inner*>(node);
+            for (size_t i = 0; i < node->count; i++) {
+                visit(inner->children[i], fn);
+                fn(node->keys[i], node->values[i]);
+            }
+            visit(inner->children[node->count], fn);
+        }
+
+        bool validate_node(const Node* node, size_t depth, const K* lower, const K* upper, size_t& count) const {
+            if (node->count > Order || (node != root_ && node->count < kMinKeys)) return false;
+            for (size_t i = 0; i < node->count; i++) {
+                if (i > 0 && !comp_(node->keys[i - 1], node->keys[i])) return false;
+                if (lower != nullptr && !comp_(*lower, node->keys[i])) return false;
+                if (upper != nullptr && !comp_(node->keys[i], *upper)) return false;
+            }
+            count += node->count;
+            if (node->leaf) return depth + 1 == height_;
+
+            const Inner* inner = static_cast<const Inner*>(node);
+            if (node->count == 0) return false;
+            for (size_t i = 0; i <= node->count; i++) {
+                const K* child_lower = i == 0 ? lower : &node->keys[i - 1];
+                const K* child_upper = i == node->count ? upper : &node->keys[i];
+                if (!validate_node(inner->children[i], depth + 1, child_lower, child_upper, count)) return false;
+            }
+            return true;
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+
+        explicit BTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : root_(nullptr), size_(0), height_(0), comp_(comp), alloc_(alloc) {}
+
+        BTree(const BTree& other)
+            : BTree(other.comp_, std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc_)) {
+            if (other.root_ != nullptr) root_ = copy_subtree(other.root_);
+            size_ = other.size_;
+            height_ = other.height_;
+        }
+
+        BTree(BTree&& other) noexcept : comp_(other.comp_), alloc_(std::move(other.alloc_)) {
+            steal(other);
+        }
+
+        ~BTree() {
+            clear();
+        }
+
+        BTree& operator=(const BTree& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if (other.root_ != nullptr) root_ = copy_subtree(other.root_);
+            size_ = other.size_;
+            height_ = other.height_;
+            return *this;
+        }
+
+        BTree& operator=(BTree&& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if constexpr (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+                alloc_ = std::move(other.alloc_);
+                steal(other);
+            } else {
+                if (alloc_ == other.alloc_) {
+                    steal(other);
+                } else {
+                    // 分配器不相等时不能接管对方的节点，只能复制结构
+                    if (other.root_ != nullptr) root_ = copy_subtree(other.root_);
+                    size_ = other.size_;
+                    height_ = other.height_;
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return alloc_;
+        }
+
+        // 键已存在时不修改；返回指向值的指针以及是否插入了新元素
+        std::pair<V*, bool> insert(const K& key, const V& value) {
+            return insert_unique(key, value, false);
+        }
+
+        std::pair<V*, bool> insert(const K& key, V&& value) {
+            return insert_unique(key, std::move(value), false);
+        }
+
+        std::pair<V*, bool> insert_or_assign(const K& key, const V& value) {
+            return insert_unique(key, value, true);
+        }
+
+        V& operator[](const K& key) {
+            return *insert_unique(key, V(), false).first;
+        }
+
+        V& at(const K& key) {
+            V* value = find(key);
+            if (value == nullptr) throw std::out_of_range("Key not found");
+            return *value;
+        }
+
+        // 返回指向值的指针，键不存在时返回 nullptr
+        V* find(const K& key) {
+            if (root_ == nullptr) return nullptr;
+            size_t pos;
+            Node* node = locate(key, pos, nullptr);
+            return node == nullptr ? nullptr : &node->values[pos];
+        }
+
+        bool contains(const K& key) {
+            return find(key) != nullptr;
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(const K& key) {
+            if (root_ == nullptr) return 0;
+
+            Path path;
+            size_t pos;
+            Node* node = locate(key, pos, &path);
+            if (node == nullptr) return 0;
+
+            if (node->leaf) {
+                node_erase(node, pos);
+            } else {
+                // 内部节点中的键用左子树中的最大键值替换，再从那个叶子中删除
+                Inner* inner = static_cast<Inner*>(node);
+                size_t depth = path.depth;
+                path.nodes[depth] = inner;
+                path.slots[depth] = pos;
+                depth++;
+                Node* leaf = inner->children[pos];
+                while (!leaf->leaf) {
+                    Inner* child = static_cast<Inner*>(leaf);
+                    path.nodes[depth] = child;
+                    path.slots[depth] = child->count;
+                    depth++;
+                    leaf = child->children[child->count];
+                }
+                path.depth = depth;
+                inner->keys[pos] = std::move(leaf->keys[leaf->count - 1]);
+                inner->values[pos] = std::move(leaf->values[leaf->count - 1]);
+                leaf->count--;
+            }
+            size_--;
+            rebalance(path, path.depth);
+            return 1;
+        }
+
+        // 按键序对每个元素调用 fn(key, value)
+        template <typename Fn>
+        void for_each(Fn fn) {
+            if (root_ != nullptr) visit(root_, fn);
+        }
+
+        void clear() {
+            if (root_ != nullptr) destroy_subtree(root_);
+            root_ = nullptr;
+            size_ = 0;
+            height_ = 0;
+        }
+
+        size_t size() {
+            return size_;
+        }
+
+        bool empty() {
+            return size_ == 0;
+        }
+
+        // 根到叶子的层数，空树为 0
+        size_t height() {
+            return height_;
+        }
+
+        // 检查结构不变量：键有序、分隔键约束子树、叶子同层、节点键数在范围内
+        bool validate() const {
+            if (root_ == nullptr) return size_ == 0;
+            size_t count = 0;
+            return validate_node(root_, 0, nullptr, nullptr, count) && count == size_;
+        }
+
+        // Stats 为 Linear::stats::none 时全为零
+        Linear::stats::Counters stats() const {
+            return this->counters();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,705 @@
+#ifndef BINARY_SEARCH_TREE_HPP
+#define BINARY_SEARCH_TREE_HPP
+
+#include <Linear/NodePool.hpp>
+#include <Linear/Stats.hpp>
+#include <Linear/Vector.hpp>
+#include <Tree/BinaryTree.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace Tree {
+    template <typename K, typename V>
+    struct BinarySearchNode : BinaryLink {
+        std::pair<const K, V> value;
+
+        template <typename... Args>
+        explicit BinarySearchNode(Args&&... args) : BinaryLink(), value(std::forward<Args>(args)...) {}
+    };
+
+    // 冻结后的数组布局。eytzinger 按层序（BFS）存放，下标 k 的子节点为 2k、2k+1，同一节点往下
+    // 几层的后代在内存中连续，可以提前预取；van_emde_boas 递归地把树切成上半棵和若干下半棵分别连续存放，
+    // 任意缓存行大小下一次查找都只触及 O(log_B n) 个缓存行，不需要知道缓存参数
+    enum class SearchLayout { eytzinger, van_emde_boas };
+
+    namespace detail {
+        inline unsigned search_ctz(uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+        }
+
+        struct binary_search_tree_stats_name {
+            static constexpr const char* value = "Tree::BinarySearchTree";
+        };
+    }
+
+    // 只读的有序映射：键按 Layout 排成没有指针的数组，查找时每层只做一次比较和条件赋值，没有分支预测失败。
+    // 元素另按键序存放，lower_bound 等返回指向它的指针，ranks_ 把布局位置映射到键序下标。
+    // 由有序区间或 BinarySearchTree::freeze() 构造，构造后不能修改
+    template <typename K, typename V, typename Compare = std::less<K>,
+              SearchLayout Layout = SearchLayout::eytzinger>
+    class FrozenSearchTree {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<K, V>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using const_iterator = const value_type*;
+
+    private:
+        // 一个缓存行能装下的键数（取 2 的幂，至少为 2）。eytzinger 中节点 k 往下 log2(kLineKeys) 层的
+        // 后代正好是 [k*kLineKeys, (k+1)*kLineKeys)，查找时提前预取这一组
+        static constexpr size_t line_keys() {
+            size_t keys = 2;
+            while (keys * 2 * sizeof(K) <= 64) keys *= 2;
+            return keys;
+        }
+        static constexpr size_t kLineKeys = line_keys();
+        static constexpr size_t kMaxLevels = 64;
+
+        Linear::Vector<K> keys_;
+        Linear::Vector<size_t> ranks_;
+        Linear::Vector<value_type> items_;
+        // keys_ 中布局第 0 个位置的偏移，使 eytzinger 中同一组后代与缓存行对齐
+        size_t offset_;
+        size_t levels_;
+        // van_emde_boas：深度 d 的节点是某棵下半树的根，top_[d] 为对应上半树的大小，bottom_[d] 为每棵
+        // 下半树的大小，split_[d] 为上半树根的深度
+        size_t top_[kMaxLevels];
+        size_t bottom_[kMaxLevels];
+        unsigned char split_[kMaxLevels];
+        Compare comp_;
+
+    private:
+        const K* layout() const {
+            return keys_.data() + offset_;
+        }
+
+        // 按缓存行对齐布局起点，使 eytzinger 中每组后代落在同一个缓存行里
+        void align_layout(size_t slots) {
+            size_t slack = 64 % sizeof(K) == 0 ? 64 / sizeof(K) : 0;
+            keys_.reserve(slots + slack);
+            offset_ = 0;
+            if (slack != 0) {
+                uintptr_t address = reinterpret_cast<uintptr_t>(keys_.data());
+                offset_ = (64 - address % 64) % 64 / sizeof(K);
+            }
+            for (size_t i = 0; i < offset_ + slots; i++) keys_.push_back(items_[0].first);
+        }
+
+        void build_eytzinger() {
+            size_t n = items_.size();
+            align_layout(n + 1);
+            ranks_ = Linear::Vector<size_t>(n + 1, n);
+            K* keys = keys_.data() + offset_;
+            // 沿隐式树的中序逐个填入，后继的求法与有父指针的树相同
+            size_t k = 1;
+            while (2 * k <= n) k *= 2;
+            for (size_t rank = 0; rank < n; rank++) {
+                keys[k] = items_[rank].first;
+                ranks_[k] = rank;
+                if (2 * k + 1 <= n) {
+                    k = 2 * k + 1;
+                    while (2 * k <= n) k *= 2;
+                } else {
+                    while (k & 1) k >>= 1;
+                    k >>= 1;
+                }
+            }
+        }
+
+        void split_levels(size_t start, size_t height) {
+            if (height <= 1) return;
+            size_t top = height / 2;
+            size_t bottom = height - top;
+            top_[start + top] = (size_t(1) << top) - 1;
+            bottom_[start + top] = (size_t(1) << bottom) - 1;
+            split_[start + top] = static_cast<unsigned char>(start);
+            split_levels(start, top);
+            split_levels(start + top, bottom);
+        }
+
+        // 层序下标为 index、深度为 depth 的节点在 van_emde_boas 布局中的位置，与查找时的递推相同
+        size_t veb_position(size_t index, size_t depth) const {
+            size_t position[kMaxLevels];
+            position[0] = 0;
+            for (size_t d = 1; d <= depth; d++) {
+                size_t i = index >> (depth - d);
+                position[d] = position[split_[d]] + top_[d] + (i & top_[d]) * bottom_[d];
+            }
+            return position[depth];
+        }
+
+        // 补齐成满二叉树，补上的位置复制最大键并映射到 size()，只会在所有真实键都小于目标时被选中
+        void build_van_emde_boas() {
+            size_t n = items_.size();
+            while ((size_t(1) << levels_) - 1 < n) levels_++;
+            size_t slots = (size_t(1) << levels_) - 1;
+            split_levels(0, levels_);
+            align_layout(slots);
+            ranks_ = Linear::Vector<size_t>(slots + 1, n);
+            K* keys = keys_.data() + offset_;
+            // 满二叉树中序第 r 个节点：高度为 r+1 的末尾 0 的个数，层序下标由其余位得到
+            for (size_t rank = 0; rank < slots; rank++) {
+                unsigned low = detail::search_ctz(rank + 1);
+                size_t depth = levels_ - 1 - low;
+                size_t index = (size_t(1) << depth) | ((rank + 1) >> (low + 1));
+                size_t position = veb_position(index, depth);
+                keys[position] = items_[rank < n ? rank : n - 1].first;
+                ranks_[position] = rank < n ? rank : n;
+            }
+        }
+
+        void build() {
+            for (size_t i = 1; i < items_.size(); i++) {
+                if (!comp_(items_[i - 1].first, items_[i].first)) {
+                    throw std::invalid_argument("FrozenSearchTree keys must be strictly increasing");
+                }
+            }
+            if (items_.empty()) return;
+            if (Layout == SearchLayout::eytzinger) {
+                while ((size_t(1) << levels_) <= items_.size()) levels_++;
+                build_eytzinger();
+            } else {
+                build_van_emde_boas();
+            }
+        }
+
+        // less(a) 为真时向右走；lower_bound 用 a < key，upper_bound 用 !(key < a)
+        template <typename Less>
+        size_t search(Less less) const {
+            size_t n = items_.size();
+            if (n == 0) return 0;
+            const K* keys = layout();
+            if constexpr (Layout == SearchLayout::eytzinger) {
+                size_t k = 1;
+                while (k <= n) {
+                    // 地址按整数计算，越过末尾时也不构成越界指针
+                    detail::binary_prefetch(reinterpret_cast<const void*>(
+                        reinterpret_cast<uintptr_t>(keys) + k * kLineKeys * sizeof(K)));
+                    k = 2 * k + static_cast<size_t>(less(keys[k]));
+                }
+                // 最后一次向左走的位置就是结果：去掉末尾连续的向右步再去掉那一次向左
+                k >>= detail::search_ctz(~static_cast<uint64_t>(k)) + 1;
+                return ranks_[k];
+            } else {
+                size_t position[kMaxLevels];
+                position[0] = 0;
+                size_t index = 1;
+                size_t best = ranks_.size() - 1;
+                for (size_t d = 0; d < levels_; d++) {
+                    if (d != 0) position[d] = position[split_[d]] + top_[d] + (index & top_[d]) * bottom_[d];
+                    size_t right = static_cast<size_t>(less(keys[position[d]]));
+                    best = right ? best : position[d];
+                    index = 2 * index + right;
+                }
+                return ranks_[best];
+            }
+        }
+
+    public:
+        explicit FrozenSearchTree(const Compare& comp = Compare()) : offset_(0), levels_(0), comp_(comp) {}
+
+        // [first, last) 必须按 comp 严格递增，否则抛出 std::invalid_argument
+        template <typename InputIt>
+        FrozenSearchTree(InputIt first, InputIt last, const Compare& comp = Compare())
+            : FrozenSearchTree(comp) {
+            for (; first != last; ++first) items_.emplace_back(first->first, first->second);
+            items_.shrink_to_fit();
+            build();
+        }
+
+        FrozenSearchTree(const FrozenSearchTree& other)
+            : ranks_(other.ranks_), items_(other.items_), offset_(0), levels_(other.levels_), comp_(other.comp_) {
+            std::copy(other.top_, other.top_ + kMaxLevels, top_);
+            std::copy(other.bottom_, other.bottom_ + kMaxLevels, bottom_);
+            std::copy(other.split_, other.split_ + kMaxLevels, split_);
+            // 对齐偏移取决于地址，需要重新计算
+            if (!items_.empty()) {
+                size_t slots = other.keys_.size() - other.offset_;
+                align_layout(slots);
+                std::copy(other.layout(), other.layout() + slots, keys_.data() + offset_);
+            }
+        }
+
+        FrozenSearchTree(FrozenSearchTree&&) = default;
+
+        FrozenSearchTree& operator=(const FrozenSearchTree& other) {
+            if (this != &other) *this = FrozenSearchTree(other);
+            return *this;
+        }
+
+        FrozenSearchTree& operator=(FrozenSearchTree&&) = default;
+
+        // 第一个不小于 key 的元素
+        const_iterator lower_bound(const K& key) const {
+            return items_.data() + search([&](const K& a) { return comp_(a, key); });
+        }
+
+        // 第一个大于 key 的元素
+        const_iterator upper_bound(const K& key) const {
+            return items_.data() + search([&](const K& a) { return !comp_(key, a); });
+        }
+
+        const_iterator find(const K& key) const {
+            const_iterator it = lower_bound(key);
+            return it != end() && !comp_(key, it->first) ? it : end();
+        }
+
+        bool contains(const K& key) const {
+            return find(key) != end();
+        }
+
+        const V& at(const K& key) const {
+            const_iterator it = find(key);
+            if (it == end()) throw std::out_of_range("Key not found");
+            return it->second;
+        }
+
+        // 小于 key 的元素个数
+        size_t rank(const K& key) const {
+            return static_cast<size_t>(lower_bound(key) - begin());
+        }
+
+        // 第 k 小的元素（从 0 开始）
+        const value_type& select(size_t k) const {
+            return items_[k];
+        }
+
+        size_t size() const {
+            return items_.size();
+        }
+
+        bool empty() const {
+            return items_.empty();
+        }
+
+        // 查找路径的层数
+        size_t height() const {
+            return levels_;
+        }
+
+        // 三个数组占用的字节数（按容量计）
+        size_t memory_usage() const {
+            return keys_.capacity() * sizeof(K) + ranks_.capacity() * sizeof(size_t) +
+                   items_.capacity() * sizeof(value_type);
+        }
+
+        const_iterator begin() const {
+            return items_.data();
+        }
+
+        const_iterator end() const {
+            return items_.data() + items_.size();
+        }
+    };
+
+    // 不做平衡的二叉搜索树，随机插入顺序下期望高度 O(log n)，有序插入会退化成链。
+    // 所有遍历（复制、析构、校验、求高度）都沿父指针或旋转进行，不递归，退化时也不会栈溢出。
+    // 建好后可以 freeze() 成只读的 FrozenSearchTree。节点由 Linear::NodePool 分配。
+    // Stats 为计数策略（见 Linear/Stats.hpp），计节点分配与键比较；析构时的旋转不计入
+    template <typename K, typename V, typename Compare = std::less<K>,
+              typename Alloc = std::allocator<std::pair<const K, V>>, typename Stats = Linear::stats::default_policy>
+    class BinarySearchTree : public BinaryTree<BinarySearchTree<K, V, Compare, Alloc, Stats>, BinaryLink>,
+                             private Linear::stats::Recorder<Stats, detail::binary_search_tree_stats_name> {
+    private:
+        using Node = BinarySearchNode<K, V>;
+
+        struct Access {
+            static std::pair<const K, V>& value(BinaryLink* link) {
+                return static_cast<Node*>(link)->value;
+            }
+        };
+
+        friend class BinaryTree<BinarySearchTree, BinaryLink>;
+
+        BinaryLink* root_;
+        size_t size_;
+        Compare comp_;
+        Linear::NodePool<Node, Alloc> pool_;
+
+    private:
+        BinaryLink* root_link() const {
+            return root_;
+        }
+
+        static Node* node_of(BinaryLink* link) {
+            return static_cast<Node*>(link);
+        }
+
+        static const K& key_of(const BinaryLink* link) {
+            return static_cast<const Node*>(link)->value.first;
+        }
+
+        bool less(const K& a, const K& b) const {
+            this->count_comparisons(1);
+            return comp_(a, b);
+        }
+
+        template <typename... Args>
+        Node* create_node(Args&&... args) {
+            this->count_node_allocations(1);
+            Node* node = pool_.allocate();
+            try {
+                new (node) Node(std::forward<Args>(args)...);
+            } catch (...) {
+                pool_.deallocate(node);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(BinaryLink* link) {
+            Node* node = node_of(link);
+            node->~Node();
+            pool_.deallocate(node);
+        }
+
+        // 把左子树不断右旋上来，使待释放的节点总没有左子节点
+        void destroy_subtree(BinaryLink* node) {
+            while (node != nullptr) {
+                if (node->left != nullptr) {
+                    BinaryLink* left = node->left;
+                    node->left = left->right;
+                    left->right = node;
+                    node = left;
+                } else {
+                    BinaryLink* right = node->right;
+                    destroy_node(node);
+                    node = right;
+                }
+            }
+        }
+
+        // 按先序复制：目标节点缺少源节点已有的子节点时向下，两侧都复制完后一起回到父节点
+        BinaryLink* clone(BinaryLink* src) {
+            if (src == nullptr) return nullptr;
+            BinaryLink* root = create_node(node_of(src)->value);
+            root->left = root->right = root->parent = nullptr;
+            BinaryLink* dst = root;
+            try {
+                while (true) {
+                    BinaryLink* from = nullptr;
+                    bool left = false;
+                    if (src->left != nullptr && dst->left == nullptr) {
+                        from = src->left;
+                        left = true;
+                    } else if (src->right != nullptr && dst->right == nullptr) {
+                        from = src->right;
+                    }
+                    if (from != nullptr) {
+                        BinaryLink* node = create_node(node_of(from)->value);
+                        node->left = node->right = nullptr;
+                        node->parent = dst;
+                        (left ? dst->left : dst->right) = node;
+                        src = from;
+                        dst = node;
+                    } else if (dst == root) {
+                        break;
+                    } else {
+                        src = src->parent;
+                        dst = dst->parent;
+                    }
+                }
+            } catch (...) {
+                destroy_subtree(root);
+                throw;
+            }
+            return root;
+        }
+
+        BinaryLink* lower_bound_link(const K& key) const {
+            BinaryLink* node = root_;
+            BinaryLink* result = nullptr;
+            while (node != nullptr) {
+                if (!less(key_of(node), key)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        BinaryLink* upper_bound_link(const K& key) const {
+            BinaryLink* node = root_;
+            BinaryLink* result = nullptr;
+            while (node != nullptr) {
+                if (less(key, key_of(node))) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        BinaryLink* find_link(const K& key) const {
+            BinaryLink* node = root_;
+            while (node != nullptr) {
+                if (less(key, key_of(node))) {
+                    node = node->left;
+                } else if (less(key_of(node), key)) {
+                    node = node->right;
+                } else {
+                    return node;
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename M>
+        std::pair<BinaryLink*, bool> insert_unique(const K& key, M&& value, bool assign) {
+            BinaryLink* parent = nullptr;
+            BinaryLink** slot = &root_;
+            while (*slot != nullptr) {
+                parent = *slot;
+                if (less(key, key_of(parent))) {
+                    slot = &parent->left;
+                } else if (less(key_of(parent), key)) {
+                    slot = &parent->right;
+                } else {
+                    if (assign) node_of(parent)->value.second = std::forward<M>(value);
+                    return {parent, false};
+                }
+            }
+            Node* node = create_node(key, std::forward<M>(value));
+            node->left = nullptr;
+            node->right = nullptr;
+            node->parent = parent;
+            *slot = node;
+            size_++;
+            return {node, true};
+        }
+
+        void replace_child(BinaryLink* old_child, BinaryLink* new_child, BinaryLink* parent) {
+            if (parent == nullptr) {
+                root_ = new_child;
+            } else if (parent->left == old_child) {
+                parent->left = new_child;
+            } else {
+                parent->right = new_child;
+            }
+            if (new_child != nullptr) new_child->parent = parent;
+        }
+
+        void erase_link(BinaryLink* node) {
+            if (node->left == nullptr) {
+                replace_child(node, node->right, node->parent);
+            } else if (node->right == nullptr) {
+                replace_child(node, node->left, node->parent);
+            } else {
+                // 有两个子节点时用后继顶替 node 的位置
+                BinaryLink* successor = detail::binary_leftmost(node->right);
+                if (successor->parent != node) {
+                    replace_child(successor, successor->right, successor->parent);
+                    successor->right = node->right;
+                    node->right->parent = successor;
+                }
+                successor->left = node->left;
+                node->left->parent = successor;
+                replace_child(node, successor, node->parent);
+            }
+            destroy_node(node);
+            size_--;
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using iterator = BinaryTreeIterator<value_type, Access>;
+
+        template <SearchLayout Layout = SearchLayout::eytzinger>
+        using frozen_type = FrozenSearchTree<K, V, Compare, Layout>;
+
+        explicit BinarySearchTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : root_(nullptr), size_(0), comp_(comp), pool_(alloc) {}
+
+        BinarySearchTree(const BinarySearchTree& other)
+            : BinarySearchTree(other.comp_,
+                               std::allocator_traits<Alloc>::select_on_container_copy_construction(
+                                   other.get_allocator())) {
+            root_ = clone(other.root_);
+            size_ = other.size_;
+        }
+
+        // 连同节点池一起接管，other 留下一个空池
+        BinarySearchTree(BinarySearchTree&& other) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
+            : root_(nullptr), size_(0), comp_(other.comp_), pool_(std::move(other.pool_)) {
+            root_ = other.root_;
+            size_ = other.size_;
+            other.root_ = nullptr;
+            other.size_ = 0;
+        }
+
+        ~BinarySearchTree() {
+            clear();
+        }
+
+        BinarySearchTree& operator=(const BinarySearchTree& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            root_ = clone(other.root_);
+            size_ = other.size_;
+            return *this;
+        }
+
+        // 不传播分配器；分配器不相等时复制节点
+        BinarySearchTree& operator=(BinarySearchTree&& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if (get_allocator() == other.get_allocator()) {
+                pool_.swap(other.pool_);
+                root_ = other.root_;
+                size_ = other.size_;
+                other.root_ = nullptr;
+                other.size_ = 0;
+            } else {
+                root_ = clone(other.root_);
+                size_ = other.size_;
+                other.clear();
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return Alloc(pool_.get_allocator());
+        }
+
+        // 键已存在时不修改，返回已有元素
+        std::pair<iterator, bool> insert(const K& key, const V& value) {
+            auto result = insert_unique(key, value, false);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        std::pair<iterator, bool> insert(const K& key, V&& value) {
+            auto result = insert_unique(key, std::move(value), false);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        // 键已存在时替换值
+        std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+            auto result = insert_unique(key, value, true);
+            return {iterator(result.first, &root_), result.second};
+        }
+
+        V& operator[](const K& key) {
+            return node_of(insert_unique(key, V(), false).first)->value.second;
+        }
+
+        const V& at(const K& key) const {
+            BinaryLink* node = find_link(key);
+            if (node == nullptr) throw std::out_of_range("Key not found");
+            return node_of(node)->value.second;
+        }
+
+        iterator find(const K& key) {
+            return iterator(find_link(key), &root_);
+        }
+
+        bool contains(const K& key) const {
+            return find_link(key) != nullptr;
+        }
+
+        // 第一个不小于 key 的元素
+        iterator lower_bound(const K& key) {
+            return iterator(lower_bound_link(key), &root_);
+        }
+
+        // 第一个大于 key 的元素
+        iterator upper_bound(const K& key) {
+            return iterator(upper_bound_link(key), &root_);
+        }
+
+        // 返回被删除元素的下一个元素
+        iterator erase(iterator pos) {
+            BinaryLink* next = detail::binary_next(pos.link());
+            erase_link(pos.link());
+            return iterator(next, &root_);
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(const K& key) {
+            BinaryLink* node = find_link(key);
+            if (node == nullptr) return 0;
+            erase_link(node);
+            return 1;
+        }
+
+        void clear() {
+            destroy_subtree(root_);
+            root_ = nullptr;
+            size_ = 0;
+        }
+
+        // 归还池中完全空闲的 slab
+        void shrink_to_fit() {
+            pool_.shrink_to_fit();
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        // 中序遍历一遍，检查键严格递增、父指针一致以及元素个数
+        bool validate() const {
+            if (root_ != nullptr && root_->parent != nullptr) return false;
+            size_t count = 0;
+            BinaryLink* prev = nullptr;
+            for (BinaryLink* node = root_ == nullptr ? nullptr : detail::binary_leftmost(root_); node != nullptr;
+                 node = detail::binary_next(node)) {
+                if (node->left != nullptr && node->left->parent != node) return false;
+                if (node->right != nullptr && node->right->parent != node) return false;
+                if (prev != nullptr && !less(key_of(prev), key_of(node))) return false;
+                prev = node;
+                count++;
+            }
+            return count == size_;
+        }
+
+        // 按键序复制出只读的数组布局，之后对本树的修改不会影响它
+        template <SearchLayout Layout = SearchLayout::eytzinger>
+        frozen_type<Layout> freeze() const {
+            BinaryLink* first = root_ == nullptr ? nullptr : detail::binary_leftmost(root_);
+            return frozen_type<Layout>(iterator(first, &root_), iterator(nullptr, &root_), comp_);
+        }
+
+        iterator begin() {
+            return iterator(root_ == nullptr ? nullptr : detail::binary_leftmost(root_), &root_);
+        }
+
+        iterator end() {
+            return iterator(nullptr, &root_);
+        }
+
+        // Stats 为 Linear::stats::none 时全为零
+        Linear::stats::Counters stats() const {
+            return this->counters();
+        }
+    };
+}
+
+#endif
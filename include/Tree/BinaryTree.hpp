@@ -1,17 +1,374 @@
 #ifndef BINARY_TREE_HPP
 #define BINARY_TREE_HPP
 
-#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
 
 namespace Tree {
-    template <typename T>
-    class BinaryTree;
-    template <typename T>
-    class BinaryTreeIterator;
+    // 带父指针的二叉链接，不做平衡的 BinarySearchTree 直接使用
+    struct BinaryLink {
+        BinaryLink* left;
+        BinaryLink* right;
+        BinaryLink* parent;
+    };
 
-    
-}
+    // 取父节点的方式。默认读 parent 成员，父指针另有编码的链接（如 RBLink）特化此模板
+    template <typename Link>
+    struct BinaryLinkTraits {
+        static Link* parent(const Link* link) {
+            return link->parent;
+        }
+    };
+
+    // 遍历顺序：先序（根、左、右）、中序（左、根、右）、后序（左、右、根）
+    enum class TraversalOrder { pre_order, in_order, post_order };
+
+    namespace detail {
+        // 只是提示，地址无效也不会出错
+        inline void binary_prefetch(const void* address) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+            __builtin_prefetch(address);
+#endif
+        }
+
+        template <typename Link>
+        Link* binary_parent(const Link* node) {
+            return BinaryLinkTraits<Link>::parent(node);
+        }
+
+        template <typename Link>
+        Link* binary_leftmost(Link* node) {
+            while (node->left != nullptr) node = node->left;
+            return node;
+        }
+
+        template <typename Link>
+        Link* binary_rightmost(Link* node) {
+            while (node->right != nullptr) node = node->right;
+            return node;
+        }
+
+        template <typename Link>
+        Link* binary_next(Link* node) {
+            if (node->right != nullptr) return binary_leftmost(node->right);
+            Link* parent = binary_parent(node);
+            while (parent != nullptr && node == parent->right) {
+                node = parent;
+                parent = binary_parent(parent);
+            }
+            return parent;
+        }
+
+        template <typename Link>
+        Link* binary_prev(Link* node) {
+            if (node->left != nullptr) return binary_rightmost(node->left);
+            Link* parent = binary_parent(node);
+            while (parent != nullptr && node == parent->left) {
+                node = parent;
+                parent = binary_parent(parent);
+            }
+            return parent;
+        }
+
+        // 先序后继：有子节点时进入第一个子节点，否则向上找到第一个从左侧回来且有右子树的祖先
+        template <typename Link>
+        Link* binary_preorder_next(Link* node) {
+            if (node->left != nullptr) return node->left;
+            if (node->right != nullptr) return node->right;
+            Link* parent = binary_parent(node);
+            while (parent != nullptr && (node == parent->right || parent->right == nullptr)) {
+                node = parent;
+                parent = binary_parent(parent);
+            }
+            return parent == nullptr ? nullptr : parent->right;
+        }
+
+        // 后序中子树的第一个节点：一直往下，能向左就向左，否则向右
+        template <typename Link>
+        Link* binary_postorder_first(Link* node) {
+            while (true) {
+                if (node->left != nullptr) {
+                    node = node->left;
+                } else if (node->right != nullptr) {
+                    node = node->right;
+                } else {
+                    return node;
+                }
+            }
+        }
+
+        template <typename Link>
+        Link* binary_postorder_next(Link* node) {
+            Link* parent = binary_parent(node);
+            if (parent != nullptr && node == parent->left && parent->right != nullptr) {
+                return binary_postorder_first(parent->right);
+            }
+            return parent;
+        }
+
+        template <TraversalOrder Order, typename Link>
+        Link* binary_first(Link* root) {
+            if (root == nullptr) return nullptr;
+            if constexpr (Order == TraversalOrder::pre_order) {
+                return root;
+            } else if constexpr (Order == TraversalOrder::in_order) {
+                return binary_leftmost(root);
+            } else {
+                return binary_postorder_first(root);
+            }
+        }
+
+        template <TraversalOrder Order, typename Link>
+        Link* binary_advance(Link* node) {
+            if constexpr (Order == TraversalOrder::pre_order) {
+                return binary_preorder_next(node);
+            } else if constexpr (Order == TraversalOrder::in_order) {
+                return binary_next(node);
+            } else {
+                return binary_postorder_next(node);
+            }
+        }
+    }
+
+    // 中序双向迭代器，沿父指针移动，不需要栈
+    template <typename Value, typename Access, typename Link = BinaryLink>
+    class BinaryTreeIterator {
+    private:
+        Link* node_;
+        Link* const* root_;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::remove_const_t<Value>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Value&;
+        using pointer = Value*;
+
+        BinaryTreeIterator(Link* node = nullptr, Link* const* root = nullptr) : node_(node), root_(root) {}
+
+        reference operator*() const {
+            return Access::value(node_);
+        }
+
+        pointer operator->() const {
+            return &Access::value(node_);
+        }
+
+        BinaryTreeIterator& operator++() {
+            node_ = detail::binary_next(node_);
+            return *this;
+        }
+
+        BinaryTreeIterator& operator--() {
+            node_ = node_ == nullptr ? detail::binary_rightmost(*root_) : detail::binary_prev(node_);
+            return *this;
+        }
+
+        bool operator==(const BinaryTreeIterator& other) const {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const BinaryTreeIterator& other) const {
+            return !(*this == other);
+        }
+
+        Link* link() const {
+            return node_;
+        }
+    };
 
+    // 按 Order 遍历的前向迭代器，沿父指针移动，每步均摊 O(1)，不需要栈也不修改树。
+    // 元素的可写性与所属树的 Access 一致
+    template <typename Access, typename Link, TraversalOrder Order>
+    class BinaryTraversalIterator {
+    private:
+        Link* node_;
 
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using reference = decltype(Access::value(std::declval<Link*>()));
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::remove_reference_t<reference>*;
+
+        explicit BinaryTraversalIterator(Link* node = nullptr) : node_(node) {}
+
+        reference operator*() const {
+            return Access::value(node_);
+        }
+
+        pointer operator->() const {
+            return &Access::value(node_);
+        }
+
+        BinaryTraversalIterator& operator++() {
+            node_ = detail::binary_advance<Order>(node_);
+            return *this;
+        }
+
+        BinaryTraversalIterator operator++(int) {
+            BinaryTraversalIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const BinaryTraversalIterator& other) const {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const BinaryTraversalIterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    // 一对迭代器，供范围 for 使用
+    template <typename Iterator>
+    class BinaryTreeRange {
+    private:
+        Iterator first_;
+        Iterator last_;
+
+    public:
+        BinaryTreeRange(Iterator first, Iterator last) : first_(first), last_(last) {}
+
+        Iterator begin() const {
+            return first_;
+        }
+
+        Iterator end() const {
+            return last_;
+        }
+    };
+
+    // 二叉树的公共部分（CRTP）：与平衡方式无关的结构查询、三种顺序的遍历和批量访问。
+    // Derived 需要提供 root_link()、把链接转换为元素的 Access::value(link)、key_of(link)、键比较 less(a, b)
+    // 以及 lower_bound_link(key)，私有时把本类声明为友元。所有遍历都不递归，不分配内存
+    template <typename Derived, typename Link>
+    class BinaryTree {
+    private:
+        // 批量访问时暂存的祖先个数，超出后丢弃最早的，之后靠父指针找回
+        static constexpr size_t kPending = 64;
+
+        Derived& derived() {
+            return static_cast<Derived&>(*this);
+        }
+
+        const Derived& derived() const {
+            return static_cast<const Derived&>(*this);
+        }
+
+        // 从 node 开始按中序访问，直到链接为空或 stop(link) 为真；descend 为真时先下降到 node 子树的最左节点。
+        // 像递归一样把左子树还没走完的祖先记在定长的环形数组里，回溯时直接取出，不必沿父指针重读早已
+        // 换出缓存的祖先；数组为空时（被覆盖过或从树中间开始）才沿父指针向上找。下降时预取每个祖先的
+        // 右子节点，它会在左子树走完后访问
+        template <typename Stop, typename Fn>
+        static void visit_from(Link* node, bool descend, Stop stop, Fn& fn) {
+            using Access = typename Derived::Access;
+            Link* pending[kPending];
+            size_t top = 0;
+            size_t count = 0;
+            auto push_left_spine = [&](Link* link) {
+                while (link->left != nullptr) {
+                    if (link->right != nullptr) detail::binary_prefetch(link->right);
+                    pending[top] = link;
+                    top = (top + 1) % kPending;
+                    if (count < kPending) count++;
+                    link = link->left;
+                }
+                return link;
+            };
+            if (node != nullptr && descend) node = push_left_spine(node);
+            while (node != nullptr && !stop(node)) {
+                fn(Access::value(node));
+                if (node->right != nullptr) {
+                    node = push_left_spine(node->right);
+                } else if (count > 0) {
+                    top = (top + kPending - 1) % kPending;
+                    count--;
+                    node = pending[top];
+                } else {
+                    Link* parent = detail::binary_parent(node);
+                    while (parent != nullptr && node == parent->right) {
+                        node = parent;
+                        parent = detail::binary_parent(parent);
+                    }
+                    node = parent;
+                }
+            }
+        }
+
+    protected:
+        BinaryTree() = default;
+
+    public:
+        // 根到最深叶子的层数，空树为 0。用上一步所在的节点判断方向，沿父指针走一遍
+        size_t height() const {
+            size_t result = 0;
+            size_t depth = 1;
+            const Link* prev = nullptr;
+            const Link* node = derived().root_link();
+            while (node != nullptr) {
+                const Link* next = nullptr;
+                if (prev == detail::binary_parent(node)) {
+                    if (depth > result) result = depth;
+                    next = node->left != nullptr ? node->left : node->right;
+                } else if (prev == node->left) {
+                    next = node->right;
+                }
+                prev = node;
+                if (next != nullptr) {
+                    node = next;
+                    depth++;
+                } else {
+                    node = detail::binary_parent(node);
+                    depth--;
+                }
+            }
+            return result;
+        }
+
+        template <TraversalOrder Order>
+        auto traverse() {
+            using Iterator = BinaryTraversalIterator<typename Derived::Access, Link, Order>;
+            return BinaryTreeRange<Iterator>(Iterator(detail::binary_first<Order>(derived().root_link())), Iterator());
+        }
+
+        // 先序：复制或序列化树的形状时使用
+        auto pre_order() {
+            return traverse<TraversalOrder::pre_order>();
+        }
+
+        auto in_order() {
+            return traverse<TraversalOrder::in_order>();
+        }
+
+        // 后序：子节点总在父节点之前，适合自底向上的计算
+        auto post_order() {
+            return traverse<TraversalOrder::post_order>();
+        }
+
+        // 按键序对每个元素调用 fn
+        template <typename Fn>
+        void for_each(Fn fn) {
+            visit_from(derived().root_link(), true, [](Link*) { return false; }, fn);
+        }
+
+        // 按键序对键在 [lo, hi) 中的元素调用 fn
+        template <typename Key, typename Fn>
+        void range_for_each(const Key& lo, const Key& hi, Fn fn) {
+            const Derived& tree = derived();
+            auto past_end = [&](Link* link) { return !tree.less(tree.key_of(link), hi); };
+            visit_from(tree.lower_bound_link(lo), false, past_end, fn);
+        }
+    };
+}
 
-#endif
\ No newline at end of file
+#endif
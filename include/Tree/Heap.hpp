@@ -0,0 +1,387 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+
+#include <Linear/Vector.hpp>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Tree {
+    namespace detail {
+        // d 叉堆的下标：i 的子节点为 D * i + 1 .. D * i + D，同一节点的子节点连续存放，
+        // 下沉时每层只比较一段相邻元素。place(i, value) 把元素写入下标 i（索引堆在此更新位置表）
+
+        template <size_t D, typename T, typename Less, typename Place>
+        size_t heap_sift_up(T* data, size_t hole, const T& value, Less& less, Place& place) {
+            while (hole > 0) {
+                size_t parent = (hole - 1) / D;
+                if (!less(data[parent], value)) break;
+                place(hole, std::move(data[parent]));
+                hole = parent;
+            }
+            return hole;
+        }
+
+        // 在 [0, size) 中选出 hole 的子节点里优先级最高的一个；没有子节点时返回 size
+        template <size_t D, typename T, typename Less>
+        size_t heap_best_child(const T* data, size_t size, size_t hole, Less& less) {
+            size_t first = D * hole + 1;
+            if (first >= size) return size;
+            size_t best = first;
+            if (first + D <= size) {
+                // 完整的一组子节点：循环次数为常量，编译器可以展开
+                for (size_t offset = 1; offset < D; offset++) {
+                    if (less(data[best], data[first + offset])) best = first + offset;
+                }
+            } else {
+                for (size_t child = first + 1; child < size; child++) {
+                    if (less(data[best], data[child])) best = child;
+                }
+            }
+            return best;
+        }
+
+        template <size_t D, typename T, typename Less, typename Place>
+        size_t heap_sift_down(T* data, size_t size, size_t hole, const T& value, Less& less, Place& place) {
+            for (;;) {
+                size_t child = heap_best_child<D>(data, size, hole, less);
+                if (child == size || !less(value, data[child])) break;
+                place(hole, std::move(data[child]));
+                hole = child;
+            }
+            return hole;
+        }
+
+        // 删除堆顶时先把空位沿优先级最高的子节点一路移到叶子，再让末尾元素上浮：
+        // 末尾元素通常属于底层，比逐层与它比较少一半比较次数
+        template <size_t D, typename T, typename Less, typename Place>
+        size_t heap_sift_to_leaf(T* data, size_t size, size_t hole, const T& value, Less& less, Place& place) {
+            for (;;) {
+                size_t child = heap_best_child<D>(data, size, hole, less);
+                if (child == size) break;
+                place(hole, std::move(data[child]));
+                hole = child;
+            }
+            return heap_sift_up<D>(data, hole, value, less, place);
+        }
+    }
+
+    // 隐式数组上的 d 叉堆，元素连续存放在 Linear::Vector 中。与 std::priority_queue 相同，
+    // top() 是按 Compare 最大的元素，传入 std::greater 得到最小堆。D 取 4 或 8 时一个节点的
+    // 子节点通常落在同一条缓存行内，树高也只有二叉堆的 1/2 或 1/3
+    template <typename T, typename Compare = std::less<T>, size_t D = 4, typename Alloc = std::allocator<T>>
+    class Heap {
+        static_assert(D >= 2, "Heap arity must be at least 2");
+
+    private:
+        Linear::Vector<T, Alloc> data_;
+        Compare comp_;
+
+    private:
+        struct Place {
+            T* data;
+            void operator()(size_t index, T&& value) {
+                data[index] = std::move(value);
+            }
+        };
+
+        // Floyd 建堆：从最后一个非叶子节点起逐个下沉，O(n)
+        void make_heap() {
+            size_t size = data_.size();
+            if (size < 2) return;
+            Place place{data_.data()};
+            for (size_t i = (size - 2) / D + 1; i-- > 0;) {
+                T value = std::move(data_[i]);
+                size_t hole = detail::heap_sift_down<D>(data_.data(), size, i, value, comp_, place);
+                data_[hole] = std::move(value);
+            }
+        }
+
+        void sift_up_back() {
+            Place place{data_.data()};
+            size_t last = data_.size() - 1;
+            T value = std::move(data_[last]);
+            size_t hole = detail::heap_sift_up<D>(data_.data(), last, value, comp_, place);
+            data_[hole] = std::move(value);
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using value_compare = Compare;
+        using allocator_type = Alloc;
+
+        explicit Heap(const Compare& comp = Compare(), const Alloc& alloc = Alloc()) : data_(alloc), comp_(comp) {}
+
+        // 由 [first, last) 在 O(n) 内建堆
+        template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        Heap(InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : data_(alloc), comp_(comp) {
+            data_.append(first, last);
+            make_heap();
+        }
+
+        // 用 [first, last) 替换全部元素，O(n)
+        template <typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            data_.assign(first, last);
+            make_heap();
+        }
+
+        const T& top() const {
+            return data_[0];
+        }
+
+        void push(const T& value) {
+            data_.push_back(value);
+            sift_up_back();
+        }
+
+        void push(T&& value) {
+            data_.push_back(std::move(value));
+            sift_up_back();
+        }
+
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            data_.emplace_back(std::forward<Args>(args)...);
+            sift_up_back();
+        }
+
+        // 删除堆顶，空堆上调用的行为未定义
+        void pop() {
+            size_t size = data_.size() - 1;
+            if (size > 0) {
+                Place place{data_.data()};
+                T value = std::move(data_[size]);
+                size_t hole = detail::heap_sift_to_leaf<D>(data_.data(), size, 0, value, comp_, place);
+                data_[hole] = std::move(value);
+            }
+            data_.pop_back();
+        }
+
+        // 移出堆顶元素并删除它，只能移动的元素也可以取出
+        T extract_top() {
+            T top = std::move(data_[0]);
+            pop();
+            return top;
+        }
+
+        void reserve(size_t capacity) {
+            data_.reserve(capacity);
+        }
+
+        void clear() {
+            data_.clear();
+        }
+
+        size_t size() const {
+            return data_.size();
+        }
+
+        bool empty() const {
+            return data_.empty();
+        }
+
+        // 检查堆序：没有子节点比父节点优先级高
+        bool validate() const {
+            for (size_t i = 1; i < data_.size(); i++) {
+                if (comp_(data_[(i - 1) / D], data_[i])) return false;
+            }
+            return true;
+        }
+    };
+
+    // 带句柄的 d 叉堆：push 返回句柄，位置表记录每个句柄在数组中的下标，
+    // 可以按句柄修改优先级或删除元素。句柄在元素出堆后失效，之后可能被复用
+    template <typename T, typename Compare = std::less<T>, size_t D = 4, typename Alloc = std::allocator<T>>
+    class IndexedHeap {
+        static_assert(D >= 2, "Heap arity must be at least 2");
+
+    public:
+        using handle_type = size_t;
+
+    private:
+        struct Entry {
+            T value;
+            handle_type handle;
+        };
+
+        using entry_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<Entry>;
+        using index_alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<size_t>;
+
+        static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+        Linear::Vector<Entry, entry_alloc_type> data_;
+        // positions_[handle] 为元素的下标，空闲句柄为 kNone
+        Linear::Vector<size_t, index_alloc_type> positions_;
+        Linear::Vector<handle_type, index_alloc_type> free_;
+        Compare comp_;
+
+    private:
+        struct Less {
+            Compare& comp;
+            bool operator()(const Entry& left, const Entry& right) const {
+                return comp(left.value, right.value);
+            }
+        };
+
+        struct Place {
+            Entry* data;
+            size_t* positions;
+            void operator()(size_t index, Entry&& entry) {
+                positions[entry.handle] = index;
+                data[index] = std::move(entry);
+            }
+        };
+
+        Place place() {
+            return Place{data_.data(), positions_.data()};
+        }
+
+        // 把 entry 放回空位 hole，按需要上浮或下沉
+        void restore(size_t hole, Entry&& entry) {
+            Less less{comp_};
+            Place put = place();
+            size_t up = detail::heap_sift_up<D>(data_.data(), hole, entry, less, put);
+            if (up == hole) hole = detail::heap_sift_down<D>(data_.data(), data_.size(), hole, entry, less, put);
+            else hole = up;
+            put(hole, std::move(entry));
+        }
+
+        // 删除下标 index 处的元素，末尾元素填入空位
+        void remove_at(size_t index) {
+            handle_type handle = data_[index].handle;
+            size_t last = data_.size() - 1;
+            if (index != last) {
+                Entry entry = std::move(data_[last]);
+                data_.pop_back();
+                restore(index, std::move(entry));
+            } else {
+                data_.pop_back();
+            }
+            positions_[handle] = kNone;
+            free_.push_back(handle);
+        }
+
+        size_t position_of(handle_type handle) const {
+            if (!contains(handle)) throw std::out_of_range("Heap handle is not in the heap");
+            return positions_[handle];
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using value_compare = Compare;
+        using allocator_type = Alloc;
+
+        explicit IndexedHeap(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : data_(entry_alloc_type(alloc)), positions_(index_alloc_type(alloc)), free_(index_alloc_type(alloc)),
+              comp_(comp) {}
+
+        const T& top() const {
+            return data_[0].value;
+        }
+
+        handle_type top_handle() const {
+            return data_[0].handle;
+        }
+
+        // 插入元素并返回它的句柄
+        handle_type push(const T& value) {
+            // 先预留空间（按扩容策略增长），之后的步骤不再分配，失败时句柄表保持不变
+            data_.reserve_amortized(data_.size() + 1);
+            handle_type handle;
+            if (!free_.empty()) {
+                handle = free_.back();
+                free_.pop_back();
+            } else {
+                handle = positions_.size();
+                positions_.push_back(kNone);
+            }
+            try {
+                data_.push_back(Entry{value, handle});
+            } catch (...) {
+                free_.push_back(handle);
+                throw;
+            }
+            Entry entry = std::move(data_.back());
+            restore(data_.size() - 1, std::move(entry));
+            return handle;
+        }
+
+        // 删除堆顶，空堆上调用的行为未定义
+        void pop() {
+            remove_at(0);
+        }
+
+        bool contains(handle_type handle) const {
+            return handle < positions_.size() && positions_[handle] != kNone;
+        }
+
+        const T& value(handle_type handle) const {
+            return data_[position_of(handle)].value;
+        }
+
+        // 提高元素的优先级（最小堆中即把键改小）；新值的优先级低于原值时抛出 std::invalid_argument
+        void decrease_key(handle_type handle, const T& value) {
+            size_t index = position_of(handle);
+            if (comp_(value, data_[index].value)) throw std::invalid_argument("decrease_key would lower the priority");
+            Entry entry{value, handle};
+            Less less{comp_};
+            Place put = place();
+            put(detail::heap_sift_up<D>(data_.data(), index, entry, less, put), std::move(entry));
+        }
+
+        // 任意修改元素的值
+        void update(handle_type handle, const T& value) {
+            size_t index = position_of(handle);
+            restore(index, Entry{value, handle});
+        }
+
+        void erase(handle_type handle) {
+            remove_at(position_of(handle));
+        }
+
+        void reserve(size_t capacity) {
+            data_.reserve(capacity);
+            positions_.reserve(capacity);
+        }
+
+        // 清空后全部句柄失效，句柄从 0 重新编号
+        void clear() {
+            data_.clear();
+            positions_.clear();
+            free_.clear();
+        }
+
+        size_t size() const {
+            return data_.size();
+        }
+
+        bool empty() const {
+            return data_.empty();
+        }
+
+        // 检查堆序以及位置表与数组一致
+        bool validate() const {
+            size_t live = 0;
+            for (size_t handle = 0; handle < positions_.size(); handle++) {
+                if (positions_[handle] == kNone) continue;
+                if (positions_[handle] >= data_.size() || data_[positions_[handle]].handle != handle) return false;
+                live++;
+            }
+            if (live != data_.size() || live + free_.size() != positions_.size()) return false;
+            for (size_t i = 1; i < data_.size(); i++) {
+                if (comp_(data_[(i - 1) / D].value, data_[i].value)) return false;
+            }
+            return true;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,633 @@
+#ifndef HUFFMAN_TREE_HPP
+#define HUFFMAN_TREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Tree {
+    namespace detail {
+        // 码流与块头一律按小端序存放
+        inline uint64_t huffman_load64(const unsigned char* data) {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap64(value);
+#endif
+            return value;
+        }
+
+        inline void huffman_store64(unsigned char* data, uint64_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap64(value);
+#endif
+            std::memcpy(data, &value, sizeof(value));
+        }
+
+        inline uint32_t huffman_load32(const unsigned char* data) {
+            return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+                   static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+        }
+
+        inline void huffman_store32(unsigned char* data, uint32_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap32(value);
+#endif
+            std::memcpy(data, &value, sizeof(value));
+        }
+
+        // 低位先出的位读取器：peek 一次给出至少 57 个有效位
+        struct HuffmanBitReader {
+            const unsigned char* data;
+            size_t size;
+            size_t position;  // 已消耗的位数
+
+            bool fast() const {
+                return (position >> 3) + 8 <= size;
+            }
+
+            uint64_t peek() const {
+                return huffman_load64(data + (position >> 3)) >> (position & 7);
+            }
+
+            // 靠近末尾时逐字节拼装，超出部分按 0 补齐
+            uint64_t peek_safe() const {
+                if (fast()) return peek();
+                uint64_t value = 0;
+                for (size_t i = position >> 3, shift = 0; i < size; i++, shift += 8) {
+                    value |= static_cast<uint64_t>(data[i]) << shift;
+                }
+                return value >> (position & 7);
+            }
+        };
+    }
+
+    // 长度受限的 Huffman 码长（package-merge）：frequencies 中为 0 的符号码长为 0，其余码长不超过
+    // max_length，且在此限制下编码总位数最小。排序 O(n log n)，合并 O(n * max_length)。
+    // 只有一个符号时码长为 1；max_length 为 0、不小于 64 或符号数超过 2^max_length 时抛出 std::invalid_argument
+    inline std::vector<unsigned char> huffman_code_lengths(const uint64_t* frequencies, size_t count,
+                                                           unsigned max_length) {
+        std::vector<unsigned char> lengths(count, 0);
+        std::vector<size_t> symbols;
+        for (size_t i = 0; i < count; i++) {
+            if (frequencies[i] != 0) symbols.push_back(i);
+        }
+        if (symbols.empty()) return lengths;
+        if (symbols.size() == 1) {
+            lengths[symbols[0]] = 1;
+            return lengths;
+        }
+        if (max_length == 0 || max_length >= 64 || (uint64_t(1) << max_length) < symbols.size()) {
+            throw std::invalid_argument("huffman_code_lengths: max_length too small for the alphabet");
+        }
+        std::stable_sort(symbols.begin(), symbols.end(),
+                         [&](size_t left, size_t right) { return frequencies[left] < frequencies[right]; });
+
+        // 不受限的 Huffman 码长不超过 n - 1，层数取两者较小者
+        size_t n = symbols.size();
+        size_t levels = std::min<size_t>(max_length, n - 1);
+        // leaf[j] 记录第 j 层（码长 j + 1）合并后的列表中各项是否为叶子；最深层只有叶子
+        std::vector<std::vector<unsigned char>> leaf(levels);
+        std::vector<uint64_t> current(n), next;
+        for (size_t i = 0; i < n; i++) current[i] = frequencies[symbols[i]];
+        leaf[levels - 1].assign(n, 1);
+        for (size_t j = levels - 1; j-- > 0;) {
+            // 上一层两两打包，再与叶子按权重归并，权重相同时叶子在前
+            next.clear();
+            leaf[j].clear();
+            size_t packages = current.size() / 2;
+            size_t i = 0, k = 0;
+            while (i < n || k < packages) {
+                uint64_t package = k < packages ? current[2 * k] + current[2 * k + 1] : 0;
+                if (k == packages || (i < n && frequencies[symbols[i]] <= package)) {
+                    next.push_back(frequencies[symbols[i++]]);
+                    leaf[j].push_back(1);
+                } else {
+                    next.push_back(package);
+                    leaf[j].push_back(0);
+                    k++;
+                }
+            }
+            current.swap(next);
+        }
+
+        // 顶层取前 2n - 2 项；其中每个叶子使对应符号码长加一，每个包展开为下一层的两项
+        size_t take = 2 * n - 2;
+        for (size_t j = 0; j < levels; j++) {
+            size_t leaves = 0;
+            for (size_t i = 0; i < take; i++) leaves += leaf[j][i];
+            for (size_t i = 0; i < leaves; i++) lengths[symbols[i]]++;
+            take = 2 * (take - leaves);
+        }
+        return lengths;
+    }
+
+    // 字节符号的规范 Huffman 码表。编码表按符号存放位反转后的码字，码流低位先出；
+    // 解码表以接下来的 table_bits 位为下标，一次查表解出至多 3 个符号——只要它们的码长之和
+    // 不超过 table_bits。码长上限为 12，任何码字都能一次查出，解码不需要回退到逐位走树
+    class HuffmanTable {
+    public:
+        static constexpr size_t kSymbols = 256;
+        static constexpr unsigned kMaxCodeLength = 12;
+        static constexpr unsigned kDefaultMaxLength = 11;
+
+    private:
+        // 解码表项：0-23 位依次是至多 3 个符号，24-27 位是消耗的位数，28-29 位是符号个数
+        static constexpr unsigned kBitsShift = 24;
+        static constexpr unsigned kCountShift = 28;
+        // 一次 peek 至少有 57 个有效位，够连续查表 4 次
+        static constexpr size_t kProbes = 4;
+
+        unsigned char lengths_[kSymbols];
+        uint16_t codes_[kSymbols];
+        unsigned table_bits_;
+        std::vector<uint32_t> table_;
+
+        [[noreturn]] static void corrupt() {
+            throw std::runtime_error("HuffmanTable: corrupt bitstream");
+        }
+
+        static uint16_t reverse(uint32_t code, unsigned length) {
+            uint32_t reversed = 0;
+            for (unsigned i = 0; i < length; i++) reversed |= ((code >> i) & 1) << (length - 1 - i);
+            return static_cast<uint16_t>(reversed);
+        }
+
+        // 码长已通过检查：按 (码长, 符号) 顺序分配规范码，再生成解码表
+        void assign_codes() {
+            unsigned counts[kMaxCodeLength + 1] = {};
+            table_bits_ = 0;
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) {
+                counts[lengths_[symbol]]++;
+                table_bits_ = std::max<unsigned>(table_bits_, lengths_[symbol]);
+            }
+            uint32_t next[kMaxCodeLength + 1] = {};
+            uint32_t code = 0;
+            counts[0] = 0;
+            for (unsigned length = 1; length <= kMaxCodeLength; length++) {
+                code = (code + counts[length - 1]) << 1;
+                next[length] = code;
+            }
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) {
+                unsigned length = lengths_[symbol];
+                codes_[symbol] = length == 0 ? 0 : reverse(next[length]++, length);
+            }
+
+            // 先填单符号表（低 8 位符号、高 8 位码长），再在其上拼出多符号表项
+            size_t entries = size_t(1) << table_bits_;
+            size_t mask = entries - 1;
+            std::vector<uint16_t> single(entries);
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) {
+                unsigned length = lengths_[symbol];
+                if (length == 0) continue;
+                for (size_t index = codes_[symbol]; index < entries; index += size_t(1) << length) {
+                    single[index] = static_cast<uint16_t>(symbol | length << 8);
+                }
+            }
+            table_.resize(entries);
+            for (size_t index = 0; index < entries; index++) {
+                uint32_t entry = 0;
+                unsigned used = 0, count = 0;
+                while (count < 3) {
+                    // 移出已用的位后只剩 table_bits_ - used 个有效位，码长不超过它才能确定下一个符号
+                    uint16_t next_symbol = single[(index >> used) & mask];
+                    unsigned length = next_symbol >> 8;
+                    if (used + length > table_bits_) break;
+                    entry |= static_cast<uint32_t>(next_symbol & 0xFF) << (8 * count);
+                    used += length;
+                    count++;
+                }
+                table_[index] = entry | used << kBitsShift | count << kCountShift;
+            }
+        }
+
+        // 逐个符号解码，直到写满 [out, end)，用于各段码流的末尾
+        void decode_tail(detail::HuffmanBitReader& reader, unsigned char* out, unsigned char* end) const {
+            uint64_t mask = (uint64_t(1) << table_bits_) - 1;
+            for (; out < end; out++) {
+                unsigned char symbol = static_cast<unsigned char>(table_[reader.peek_safe() & mask]);
+                *out = symbol;
+                reader.position += lengths_[symbol];
+            }
+        }
+
+        // 各段码流交错解码，让相互独立的查表在流水线中重叠
+        template <size_t Streams>
+        void decode_streams(detail::HuffmanBitReader* readers, unsigned char** outs, unsigned char** ends) const {
+            const uint32_t* table = table_.data();
+            uint64_t mask = (uint64_t(1) << table_bits_) - 1;
+            for (;;) {
+                bool fast = true;
+                for (size_t s = 0; s < Streams; s++) {
+                    fast &= readers[s].fast() && static_cast<size_t>(ends[s] - outs[s]) > 3 * kProbes + 1;
+                }
+                if (!fast) break;
+                uint64_t bits[Streams];
+                for (size_t s = 0; s < Streams; s++) bits[s] = readers[s].peek();
+                for (size_t probe = 0; probe < kProbes; probe++) {
+                    for (size_t s = 0; s < Streams; s++) {
+                        uint32_t entry = table[bits[s] & mask];
+                        unsigned used = (entry >> kBitsShift) & 0xF;
+                        detail::huffman_store32(outs[s], entry);
+                        outs[s] += entry >> kCountShift;
+                        bits[s] >>= used;
+                        readers[s].position += used;
+                    }
+                }
+            }
+            for (size_t s = 0; s < Streams; s++) {
+                decode_tail(readers[s], outs[s], ends[s]);
+                // 码流末尾只允许不足一个字节的填充
+                if ((readers[s].position + 7) / 8 != readers[s].size) corrupt();
+            }
+        }
+
+        size_t encode_stream(const unsigned char* in, size_t count, unsigned char* out) const {
+            unsigned char* start = out;
+            uint64_t buffer = 0;
+            unsigned bits = 0;
+            size_t i = 0;
+            // 每次累积 4 个码字（至多 48 位）再整字节写出，缓冲区中最多剩 7 位
+            auto flush = [&] {
+                detail::huffman_store64(out, buffer);
+                out += bits >> 3;
+                buffer >>= bits & ~7u;
+                bits &= 7;
+            };
+            for (; i + 4 <= count; i += 4) {
+                for (size_t k = 0; k < 4; k++) {
+                    buffer |= static_cast<uint64_t>(codes_[in[i + k]]) << bits;
+                    bits += lengths_[in[i + k]];
+                }
+                flush();
+            }
+            for (; i < count; i++) {
+                buffer |= static_cast<uint64_t>(codes_[in[i]]) << bits;
+                bits += lengths_[in[i]];
+                flush();
+            }
+            if (bits > 0) *out++ = static_cast<unsigned char>(buffer);
+            return static_cast<size_t>(out - start);
+        }
+
+        static size_t segment_size(size_t count, size_t streams) {
+            return (count + streams - 1) / streams;
+        }
+
+    public:
+        static constexpr size_t kMaxStreams = 4;
+
+        HuffmanTable() : table_bits_(0) {
+            std::memset(lengths_, 0, sizeof(lengths_));
+            std::memset(codes_, 0, sizeof(codes_));
+        }
+
+        // 由 256 个符号的频数建表。使用的符号不足两个时补一个频数为 0 的符号，使码表总是完整的；
+        // max_length 须在 [8, 12] 之间，否则抛出 std::invalid_argument
+        void build(const uint64_t* frequencies, unsigned max_length = kDefaultMaxLength) {
+            if (max_length < 8 || max_length > kMaxCodeLength) {
+                throw std::invalid_argument("HuffmanTable: max_length must be in [8, 12]");
+            }
+            uint64_t adjusted[kSymbols];
+            size_t used = 0;
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) {
+                adjusted[symbol] = frequencies[symbol];
+                used += frequencies[symbol] != 0;
+            }
+            for (size_t symbol = 0; used < 2; symbol++) {
+                if (adjusted[symbol] == 0) {
+                    adjusted[symbol] = 1;
+                    used++;
+                }
+            }
+            std::vector<unsigned char> lengths = huffman_code_lengths(adjusted, kSymbols, max_length);
+            std::copy(lengths.begin(), lengths.end(), lengths_);
+            assign_codes();
+        }
+
+        // 直接给定 256 个码长（例如从块头读出）。码长超过 12 或不构成完整前缀码时抛出 std::invalid_argument
+        void assign_lengths(const unsigned char* lengths) {
+            uint64_t kraft = 0;
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) {
+                if (lengths[symbol] > kMaxCodeLength) {
+                    throw std::invalid_argument("HuffmanTable: code length exceeds 12");
+                }
+                if (lengths[symbol] != 0) kraft += uint64_t(1) << (kMaxCodeLength - lengths[symbol]);
+            }
+            if (kraft != uint64_t(1) << kMaxCodeLength) {
+                throw std::invalid_argument("HuffmanTable: incomplete prefix code");
+            }
+            std::memcpy(lengths_, lengths, kSymbols);
+            assign_codes();
+        }
+
+        unsigned length(unsigned char symbol) const {
+            return lengths_[symbol];
+        }
+
+        // 规范码字，按从高位到低位的习惯顺序给出
+        uint32_t code(unsigned char symbol) const {
+            return reverse(codes_[symbol], lengths_[symbol]);
+        }
+
+        const unsigned char* lengths() const {
+            return lengths_;
+        }
+
+        // 最长码长，也是解码表下标的位数；未建表时为 0
+        unsigned table_bits() const {
+            return table_bits_;
+        }
+
+        // 按 frequencies 编码的总位数
+        uint64_t encoded_bits(const uint64_t* frequencies) const {
+            uint64_t bits = 0;
+            for (size_t symbol = 0; symbol < kSymbols; symbol++) bits += frequencies[symbol] * lengths_[symbol];
+            return bits;
+        }
+
+        // 编码 count 个字节：切成 streams 段（每段 ceil(count / streams) 个，最后一段可能更短），
+        // 各段独立成流、依次写到 out，段长写入 sizes。out 至少要有 encoded_bits / 8 + streams + 8 字节，
+        // 末尾 8 字节只作写出时的余量。返回写出的总字节数
+        size_t encode(const unsigned char* in, size_t count, unsigned char* out, size_t streams, size_t* sizes) const {
+            if (streams == 0 || streams > kMaxStreams) throw std::invalid_argument("HuffmanTable: 1 to 4 streams");
+            if (table_bits_ == 0) throw std::logic_error("HuffmanTable: table not built");
+            size_t segment = segment_size(count, streams), total = 0;
+            for (size_t s = 0; s < streams; s++) {
+                size_t begin = std::min(count, s * segment), end = std::min(count, begin + segment);
+                sizes[s] = encode_stream(in + begin, end - begin, out + total);
+                total += sizes[s];
+            }
+            return total;
+        }
+
+        // encode 的逆过程：in 中依次存放 streams 段码流，段长为 sizes[s]，共解出 count 个字节。
+        // 码流与码表或 count 不符时抛出 std::runtime_error
+        void decode(const unsigned char* in, const size_t* sizes, size_t streams, unsigned char* out,
+                    size_t count) const {
+            if (streams == 0 || streams > kMaxStreams) throw std::invalid_argument("HuffmanTable: 1 to 4 streams");
+            if (table_bits_ == 0) throw std::logic_error("HuffmanTable: table not built");
+            detail::HuffmanBitReader readers[kMaxStreams];
+            unsigned char* outs[kMaxStreams];
+            unsigned char* ends[kMaxStreams];
+            size_t segment = segment_size(count, streams), offset = 0;
+            for (size_t s = 0; s < streams; s++) {
+                size_t begin = std::min(count, s * segment), end = std::min(count, begin + segment);
+                readers[s] = detail::HuffmanBitReader{in + offset, sizes[s], 0};
+                outs[s] = out + begin;
+                ends[s] = out + end;
+                offset += sizes[s];
+            }
+            switch (streams) {
+                case 1: decode_streams<1>(readers, outs, ends); break;
+                case 2: decode_streams<2>(readers, outs, ends); break;
+                case 3: decode_streams<3>(readers, outs, ends); break;
+                default: decode_streams<4>(readers, outs, ends); break;
+            }
+        }
+    };
+
+    // 块格式（小端序）：模式 1 字节、原始长度 4 字节、负载长度 4 字节，随后是负载。
+    // 模式 raw 直接存放原始字节；rle 是单个重复字节；huffman 依次是 256 个 4 位码长、
+    // 前 3 段码流的长度（各 4 字节）和 4 段码流
+    namespace detail {
+        enum class HuffmanBlock : unsigned char { raw = 0, rle = 1, huffman = 2 };
+
+        inline constexpr size_t kHuffmanHeader = 9;
+        inline constexpr size_t kHuffmanStreams = 4;
+        inline constexpr size_t kHuffmanTableBytes = HuffmanTable::kSymbols / 2;
+        inline constexpr size_t kHuffmanPrefix = kHuffmanTableBytes + 4 * (kHuffmanStreams - 1);
+        inline constexpr size_t kHuffmanMaxBlock = size_t(1) << 30;
+    }
+
+    // 流式编码：输入按块切分，每块单独统计频数、建表，并在 raw、rle、huffman 中选最短的写出，
+    // 块之间互不依赖。write 可以传入任意大小的片段，攒满一块就写出一块，finish 写出剩余部分
+    class HuffmanEncoder {
+    public:
+        static constexpr size_t kDefaultBlockSize = 128 * 1024;
+
+    private:
+        size_t block_size_;
+        unsigned max_length_;
+        std::vector<unsigned char> pending_;
+        HuffmanTable table_;
+
+        void encode_block(const unsigned char* in, size_t size, std::vector<unsigned char>& out) {
+            using detail::HuffmanBlock;
+            // 4 张子直方图轮流计数，避免相邻的相同字节争用同一个计数器
+            uint32_t counts[4][HuffmanTable::kSymbols] = {};
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4) {
+                counts[0][in[i]]++;
+                counts[1][in[i + 1]]++;
+                counts[2][in[i + 2]]++;
+                counts[3][in[i + 3]]++;
+            }
+            for (; i < size; i++) counts[0][in[i]]++;
+            uint64_t frequencies[HuffmanTable::kSymbols];
+            size_t used = 0;
+            for (size_t symbol = 0; symbol < HuffmanTable::kSymbols; symbol++) {
+                frequencies[symbol] =
+                    uint64_t(counts[0][symbol]) + counts[1][symbol] + counts[2][symbol] + counts[3][symbol];
+                used += frequencies[symbol] != 0;
+            }
+
+            size_t start = out.size();
+            auto header = [&](HuffmanBlock mode, size_t payload) {
+                out.resize(start + detail::kHuffmanHeader + payload);
+                out[start] = static_cast<unsigned char>(mode);
+                detail::huffman_store32(&out[start + 1], static_cast<uint32_t>(size));
+                detail::huffman_store32(&out[start + 5], static_cast<uint32_t>(payload));
+                return &out[start + detail::kHuffmanHeader];
+            };
+            if (used == 1) {
+                *header(HuffmanBlock::rle, 1) = in[0];
+                return;
+            }
+
+            size_t bound = 0;
+            if (used > 1) {
+                table_.build(frequencies, max_length_);
+                bound = detail::kHuffmanPrefix + static_cast<size_t>(table_.encoded_bits(frequencies) / 8) +
+                        detail::kHuffmanStreams;
+            }
+            if (used == 0 || bound >= size) {
+                unsigned char* payload = header(HuffmanBlock::raw, size);
+                if (size > 0) std::memcpy(payload, in, size);
+                return;
+            }
+
+            // 先按上界（另加 8 字节写出余量）分配，编码后截到实际长度
+            unsigned char* payload = header(HuffmanBlock::huffman, bound + 8);
+            const unsigned char* lengths = table_.lengths();
+            for (size_t k = 0; k < detail::kHuffmanTableBytes; k++) {
+                payload[k] = static_cast<unsigned char>(lengths[2 * k] | lengths[2 * k + 1] << 4);
+            }
+            size_t sizes[detail::kHuffmanStreams];
+            size_t written = table_.encode(in, size, payload + detail::kHuffmanPrefix, detail::kHuffmanStreams, sizes);
+            for (size_t s = 0; s + 1 < detail::kHuffmanStreams; s++) {
+                detail::huffman_store32(payload + detail::kHuffmanTableBytes + 4 * s, static_cast<uint32_t>(sizes[s]));
+            }
+            size_t total = detail::kHuffmanPrefix + written;
+            detail::huffman_store32(&out[start + 5], static_cast<uint32_t>(total));
+            out.resize(start + detail::kHuffmanHeader + total);
+        }
+
+    public:
+        // block_size 须在 [1, 2^30] 之间，max_length 须在 [8, 12] 之间，否则抛出 std::invalid_argument
+        explicit HuffmanEncoder(size_t block_size = kDefaultBlockSize,
+                                unsigned max_length = HuffmanTable::kDefaultMaxLength)
+            : block_size_(block_size), max_length_(max_length) {
+            if (block_size == 0 || block_size > detail::kHuffmanMaxBlock) {
+                throw std::invalid_argument("HuffmanEncoder: block_size must be in [1, 2^30]");
+            }
+            if (max_length < 8 || max_length > HuffmanTable::kMaxCodeLength) {
+                throw std::invalid_argument("HuffmanEncoder: max_length must be in [8, 12]");
+            }
+        }
+
+        // 追加输入，每攒满一块就把编码后的块追加到 out；整块的输入不经缓冲直接编码
+        void write(const void* data, size_t size, std::vector<unsigned char>& out) {
+            const unsigned char* in = static_cast<const unsigned char*>(data);
+            if (!pending_.empty()) {
+                size_t take = std::min(size, block_size_ - pending_.size());
+                pending_.insert(pending_.end(), in, in + take);
+                in += take;
+                size -= take;
+                if (pending_.size() < block_size_) return;
+                encode_block(pending_.data(), pending_.size(), out);
+                pending_.clear();
+            }
+            for (; size >= block_size_; in += block_size_, size -= block_size_) encode_block(in, block_size_, out);
+            pending_.assign(in, in + size);
+        }
+
+        // 把不足一块的剩余输入编码为最后一块；之后可以继续 write 新的数据
+        void finish(std::vector<unsigned char>& out) {
+            if (pending_.empty()) return;
+            encode_block(pending_.data(), pending_.size(), out);
+            pending_.clear();
+        }
+
+        size_t block_size() const {
+            return block_size_;
+        }
+    };
+
+    // 流式解码：压缩数据可以按任意边界切成片段传入，跨片段的块先缓冲，凑齐后解码
+    class HuffmanDecoder {
+    private:
+        std::vector<unsigned char> pending_;
+        HuffmanTable table_;
+
+        [[noreturn]] static void corrupt(const char* what) {
+            throw std::runtime_error(std::string("HuffmanDecoder: ") + what);
+        }
+
+        // 块头不完整时返回 0；否则检查块头并返回整块的字节数
+        static size_t block_bytes(const unsigned char* in, size_t size) {
+            using detail::HuffmanBlock;
+            if (size < detail::kHuffmanHeader) return 0;
+            size_t raw = detail::huffman_load32(in + 1), payload = detail::huffman_load32(in + 5);
+            bool valid = raw <= detail::kHuffmanMaxBlock;
+            switch (static_cast<HuffmanBlock>(in[0])) {
+                case HuffmanBlock::raw: valid &= payload == raw; break;
+                case HuffmanBlock::rle: valid &= payload == 1; break;
+                case HuffmanBlock::huffman:
+                    valid &= payload >= detail::kHuffmanPrefix && payload < raw + detail::kHuffmanPrefix + 8;
+                    break;
+                default: valid = false;
+            }
+            if (!valid) corrupt("corrupt block header");
+            return detail::kHuffmanHeader + payload;
+        }
+
+        // in 中至少有一个完整的块
+        void decode_block(const unsigned char* in, std::vector<unsigned char>& out) {
+            using detail::HuffmanBlock;
+            size_t raw = detail::huffman_load32(in + 1), payload = detail::huffman_load32(in + 5);
+            const unsigned char* data = in + detail::kHuffmanHeader;
+            size_t start = out.size();
+            switch (static_cast<HuffmanBlock>(in[0])) {
+                case HuffmanBlock::raw:
+                    out.insert(out.end(), data, data + raw);
+                    return;
+                case HuffmanBlock::rle:
+                    out.insert(out.end(), raw, data[0]);
+                    return;
+                default: break;
+            }
+
+            unsigned char lengths[HuffmanTable::kSymbols];
+            for (size_t k = 0; k < detail::kHuffmanTableBytes; k++) {
+                lengths[2 * k] = data[k] & 0xF;
+                lengths[2 * k + 1] = data[k] >> 4;
+            }
+            try {
+                table_.assign_lengths(lengths);
+            } catch (const std::invalid_argument&) {
+                corrupt("corrupt code lengths");
+            }
+            size_t sizes[detail::kHuffmanStreams];
+            size_t streams = payload - detail::kHuffmanPrefix, last = streams;
+            for (size_t s = 0; s + 1 < detail::kHuffmanStreams; s++) {
+                sizes[s] = detail::huffman_load32(data + detail::kHuffmanTableBytes + 4 * s);
+                if (sizes[s] > last) corrupt("corrupt stream sizes");
+                last -= sizes[s];
+            }
+            sizes[detail::kHuffmanStreams - 1] = last;
+            out.resize(start + raw);
+            try {
+                table_.decode(data + detail::kHuffmanPrefix, sizes, detail::kHuffmanStreams, out.data() + start, raw);
+            } catch (...) {
+                out.resize(start);
+                throw;
+            }
+        }
+
+    public:
+        // 解出的字节追加到 out。数据损坏时抛出 std::runtime_error，已解出的完整块保留在 out 中
+        void write(const void* data, size_t size, std::vector<unsigned char>& out) {
+            const unsigned char* in = static_cast<const unsigned char*>(data);
+            // 先用新数据补齐上次剩下的半个块：块头不完整时先补齐块头，再补齐负载
+            while (!pending_.empty() && size > 0) {
+                size_t need = block_bytes(pending_.data(), pending_.size());
+                if (need == 0) need = detail::kHuffmanHeader;
+                size_t take = std::min(size, need - pending_.size());
+                pending_.insert(pending_.end(), in, in + take);
+                in += take;
+                size -= take;
+                size_t total = block_bytes(pending_.data(), pending_.size());
+                if (total != 0 && pending_.size() == total) {
+                    decode_block(pending_.data(), out);
+                    pending_.clear();
+                }
+            }
+            while (size > 0) {
+                size_t total = block_bytes(in, size);
+                if (total == 0 || total > size) {
+                    pending_.assign(in, in + size);
+                    return;
+                }
+                decode_block(in, out);
+                in += total;
+                size -= total;
+            }
+        }
+
+        // 没有缓冲着的半个块，即到目前为止的输入恰好由完整的块组成
+        bool finished() const {
+            return pending_.empty();
+        }
+
+        void reset() {
+            pending_.clear();
+        }
+    };
+}
+
+#endif
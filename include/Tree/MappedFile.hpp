@@ -0,0 +1,155 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Tree {
+    // 只读内存映射文件：打开时只建立映射，内容在首次访问时由操作系统按页读入
+    class MappedFile {
+    private:
+        const unsigned char* data_;
+        size_t size_;
+#ifdef _WIN32
+        HANDLE file_;
+        HANDLE mapping_;
+#else
+        int fd_;
+#endif
+
+        void reset() {
+            data_ = nullptr;
+            size_ = 0;
+#ifdef _WIN32
+            file_ = INVALID_HANDLE_VALUE;
+            mapping_ = nullptr;
+#else
+            fd_ = -1;
+#endif
+        }
+
+        void steal(MappedFile& other) {
+            data_ = other.data_;
+            size_ = other.size_;
+#ifdef _WIN32
+            file_ = other.file_;
+            mapping_ = other.mapping_;
+#else
+            fd_ = other.fd_;
+#endif
+            other.reset();
+        }
+
+        [[noreturn]] void fail(const std::string& path, const char* what) {
+            close();
+            throw std::runtime_error("MappedFile: cannot " + std::string(what) + " '" + path + "'");
+        }
+
+    public:
+        MappedFile() {
+            reset();
+        }
+
+        explicit MappedFile(const std::string& path) {
+            reset();
+            open(path);
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept {
+            steal(other);
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                close();
+                steal(other);
+            }
+            return *this;
+        }
+
+        ~MappedFile() {
+            close();
+        }
+
+        // 空文件可以打开，此时 data() 为 nullptr；失败时抛出 std::runtime_error
+        void open(const std::string& path) {
+            close();
+#ifdef _WIN32
+            file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE) fail(path, "open");
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file_, &size)) fail(path, "stat");
+            size_ = static_cast<size_t>(size.QuadPart);
+            if (size_ == 0) return;
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_ == nullptr) fail(path, "map");
+            data_ = static_cast<const unsigned char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (data_ == nullptr) fail(path, "map");
+#else
+            fd_ = ::open(path.c_str(), O_RDONLY);
+            if (fd_ < 0) fail(path, "open");
+            struct stat st;
+            if (::fstat(fd_, &st) != 0) fail(path, "stat");
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ == 0) return;
+            void* data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+            if (data == MAP_FAILED) fail(path, "map");
+            data_ = static_cast<const unsigned char*>(data);
+#endif
+        }
+
+        void close() {
+#ifdef _WIN32
+            if (data_ != nullptr) UnmapViewOfFile(data_);
+            if (mapping_ != nullptr) CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+            if (data_ != nullptr) ::munmap(const_cast<unsigned char*>(data_), size_);
+            if (fd_ >= 0) ::close(fd_);
+#endif
+            reset();
+        }
+
+        // 提示访问模式为随机读，避免点查询触发大段预读；不支持时忽略
+        void advise_random() const {
+#ifndef _WIN32
+            if (data_ != nullptr) ::madvise(const_cast<unsigned char*>(data_), size_, MADV_RANDOM);
+#endif
+        }
+
+        bool is_open() const {
+#ifdef _WIN32
+            return file_ != INVALID_HANDLE_VALUE;
+#else
+            return fd_ >= 0;
+#endif
+        }
+
+        const unsigned char* data() const {
+            return data_;
+        }
+
+        size_t size() const {
+            return size_;
+        }
+    };
+}
+
+#endif
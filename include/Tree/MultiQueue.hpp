@@ -0,0 +1,178 @@
+#ifndef MULTIQUEUE_HPP
+#define MULTIQUEUE_HPP
+
+#include <Tree/Heap.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Tree {
+    // threads 为 0 时使用 std::thread::hardware_concurrency()；分片数为 factor * threads。
+    // strict 为 true 时只用一个分片，出队严格按优先级，代价是所有线程争用同一把锁
+    struct MultiQueueOptions {
+        size_t threads = 0;
+        size_t factor = 2;
+        bool strict = false;
+    };
+
+    namespace detail {
+        // 每个线程一个 xorshift 状态，选分片只需要便宜的随机数
+        inline uint64_t multiqueue_random() {
+            thread_local uint64_t state = [] {
+                static std::atomic<uint64_t> seed{0x9E3779B97F4A7C15ull};
+                uint64_t value = seed.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) ^
+                                 std::hash<std::thread::id>()(std::this_thread::get_id());
+                return value != 0 ? value : 1;
+            }();
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+    }
+
+    // 并发优先队列（MultiQueue）：元素分散在多个各自加锁的 d 叉堆中。push 放入一个随机分片，
+    // try_pop 随机选两个分片、取两者堆顶中更优的一个。出队顺序是松弛的——弹出的元素未必是全局
+    // 最优，但排名误差的期望只与分片数成正比，而线程之间几乎不再争用同一把锁。
+    // 加锁一律先 try_lock，失败就换一个分片，只有多次失败后才阻塞等待
+    template <typename T, typename Compare = std::less<T>, size_t D = 4, typename Alloc = std::allocator<T>>
+    class MultiQueue {
+    private:
+        // 每个分片独占缓存行，避免不同分片的锁互相伪共享
+        struct alignas(64) Shard {
+            std::mutex mutex;
+            Heap<T, Compare, D, Alloc> heap;
+
+            Shard(const Compare& comp, const Alloc& alloc) : heap(comp, alloc) {}
+        };
+
+        static constexpr size_t kAttempts = 8;
+
+        std::vector<std::unique_ptr<Shard>> shards_;
+        Compare comp_;
+        alignas(64) std::atomic<size_t> size_;
+
+    private:
+        Shard& random_shard() {
+            // 把 32 位随机数线性映射到 [0, n)，省去取模
+            uint64_t random = detail::multiqueue_random() >> 32;
+            return *shards_[static_cast<size_t>((random * shards_.size()) >> 32)];
+        }
+
+        // 调用方持有 shard.mutex 且分片非空
+        void take(Shard& shard, T& out) {
+            out = shard.heap.extract_top();
+            size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        bool try_pop_locked(Shard& shard, T& out) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.heap.empty()) return false;
+            take(shard, out);
+            return true;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using value_compare = Compare;
+        using allocator_type = Alloc;
+
+        explicit MultiQueue(const MultiQueueOptions& options = MultiQueueOptions(), const Compare& comp = Compare(),
+                            const Alloc& alloc = Alloc())
+            : comp_(comp), size_(0) {
+            size_t count = 1;
+            if (!options.strict) {
+                size_t threads = options.threads;
+                if (threads == 0) threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+                count = std::max<size_t>(1, threads * options.factor);
+            }
+            shards_.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                shards_.push_back(std::make_unique<Shard>(comp, alloc));
+            }
+        }
+
+        MultiQueue(const MultiQueue&) = delete;
+        MultiQueue& operator=(const MultiQueue&) = delete;
+
+        void push(const T& value) {
+            emplace(value);
+        }
+
+        void push(T&& value) {
+            emplace(std::move(value));
+        }
+
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            if (shards_.size() > 1) {
+                for (size_t attempt = 0; attempt < kAttempts; attempt++) {
+                    Shard& shard = random_shard();
+                    std::unique_lock<std::mutex> lock(shard.mutex, std::try_to_lock);
+                    if (!lock) continue;
+                    shard.heap.emplace(std::forward<Args>(args)...);
+                    size_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            Shard& shard = random_shard();
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.heap.emplace(std::forward<Args>(args)...);
+            size_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 取出一个元素写入 out；队列为空时返回 false
+        bool try_pop(T& out) {
+            if (shards_.size() == 1) return try_pop_locked(*shards_[0], out);
+
+            for (size_t attempt = 0; attempt < kAttempts; attempt++) {
+                if (size_.load(std::memory_order_relaxed) == 0) return false;
+                Shard& first = random_shard();
+                Shard& second = random_shard();
+                std::unique_lock<std::mutex> first_lock(first.mutex, std::try_to_lock);
+                if (!first_lock) continue;
+                Shard* best = first.heap.empty() ? nullptr : &first;
+                std::unique_lock<std::mutex> second_lock;
+                if (&second != &first) {
+                    second_lock = std::unique_lock<std::mutex>(second.mutex, std::try_to_lock);
+                    if (second_lock && !second.heap.empty() &&
+                        (best == nullptr || comp_(best->heap.top(), second.heap.top()))) {
+                        best = &second;
+                    }
+                }
+                if (best != nullptr) {
+                    take(*best, out);
+                    return true;
+                }
+            }
+
+            // 随机选到的分片都空或都忙：依次加锁扫描全部分片，没有并发 push 时返回 false 即说明队列为空
+            for (auto& shard : shards_) {
+                if (try_pop_locked(*shard, out)) return true;
+            }
+            return false;
+        }
+
+        // 并发修改时只是近似值
+        size_t size() const {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        size_t shard_count() const {
+            return shards_.size();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,320 @@
+#ifndef NODE_SEARCH_HPP
+#define NODE_SEARCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define TREE_NODE_SEARCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang 需要按函数开启指令集，MSVC 可以直接使用内建函数
+#if defined(TREE_NODE_SEARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TREE_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define TREE_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#else
+#define TREE_TARGET_AVX2
+#define TREE_TARGET_SSE42
+#endif
+
+namespace Tree {
+    namespace detail {
+        enum class SimdLevel { none, sse42, avx2 };
+
+        inline SimdLevel detect_simd_level() {
+#if defined(TREE_NODE_SEARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return SimdLevel::avx2;
+            if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) return SimdLevel::sse42;
+#elif defined(TREE_NODE_SEARCH_X86) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            bool sse42 = (info[2] & (1 << 20)) != 0 && (info[2] & (1 << 23)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            __cpuidex(info, 7, 0);
+            bool avx2 = (info[1] & (1 << 5)) != 0 && osxsave && (_xgetbv(0) & 6) == 6;
+            if (avx2 && sse42) return SimdLevel::avx2;
+            if (sse42) return SimdLevel::sse42;
+#endif
+            return SimdLevel::none;
+        }
+
+        // 程序启动时检测一次，查找时只读
+        inline const SimdLevel kSimdLevel = detect_simd_level();
+
+        // 可以向量化比较的键：32/64 位有符号整数、float、double，且按 std::less 排序
+        template <typename K, typename Compare>
+        struct simd_searchable
+            : std::integral_constant<bool,
+                                     ((std::is_integral<K>::value && std::is_signed<K>::value &&
+                                       (sizeof(K) == 4 || sizeof(K) == 8)) ||
+                                      std::is_same<K, float>::value || std::is_same<K, double>::value) &&
+                                         (std::is_same<Compare, std::less<K>>::value ||
+                                          std::is_same<Compare, std::less<>>::value)> {};
+
+        template <typename K>
+        using simd_key_t = std::conditional_t<std::is_floating_point<K>::value, K,
+                                              std::conditional_t<sizeof(K) == 4, int32_t, int64_t>>;
+
+#if defined(TREE_NODE_SEARCH_X86)
+        // 每种键类型的向量比较：less_mask/greater_mask 返回 keys[i] < key / keys[i] > key 的位掩码
+        template <typename K>
+        struct Avx2Ops;
+        template <typename K>
+        struct Sse42Ops;
+
+        template <>
+        struct Avx2Ops<int32_t> {
+            static constexpr size_t kLanes = 8;
+            TREE_TARGET_AVX2 static int less_mask(const int32_t* keys, int32_t key) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(key), block)));
+            }
+            TREE_TARGET_AVX2 static int greater_mask(const int32_t* keys, int32_t key) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(block, _mm256_set1_epi32(key))));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<int64_t> {
+            static constexpr size_t kLanes = 4;
+            TREE_TARGET_AVX2 static int less_mask(const int64_t* keys, int64_t key) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_set1_epi64x(key), block)));
+            }
+            TREE_TARGET_AVX2 static int greater_mask(const int64_t* keys, int64_t key) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(block, _mm256_set1_epi64x(key))));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<float> {
+            static constexpr size_t kLanes = 8;
+            TREE_TARGET_AVX2 static int less_mask(const float* keys, float key) {
+                return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(keys), _mm256_set1_ps(key), _CMP_LT_OQ));
+            }
+            TREE_TARGET_AVX2 static int greater_mask(const float* keys, float key) {
+                return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(keys), _mm256_set1_ps(key), _CMP_GT_OQ));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<double> {
+            static constexpr size_t kLanes = 4;
+            TREE_TARGET_AVX2 static int less_mask(const double* keys, double key) {
+                return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(keys), _mm256_set1_pd(key), _CMP_LT_OQ));
+            }
+            TREE_TARGET_AVX2 static int greater_mask(const double* keys, double key) {
+                return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(keys), _mm256_set1_pd(key), _CMP_GT_OQ));
+            }
+        };
+
+        template <>
+        struct Sse42Ops<int32_t> {
+            static constexpr size_t kLanes = 4;
+            TREE_TARGET_SSE42 static int less_mask(const int32_t* keys, int32_t key) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, _mm_set1_epi32(key))));
+            }
+            TREE_TARGET_SSE42 static int greater_mask(const int32_t* keys, int32_t key) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, _mm_set1_epi32(key))));
+            }
+        };
+
+        template <>
+        struct Sse42Ops<int64_t> {
+            static constexpr size_t kLanes = 2;
+            TREE_TARGET_SSE42 static int less_mask(const int64_t* keys, int64_t key) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(_mm_set1_epi64x(key), block)));
+            }
+            TREE_TARGET_SSE42 static int greater_mask(const int64_t* keys, int64_t key) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(block, _mm_set1_epi64x(key))));
+            }
+        };
+
+        template <>
+        struct Sse42Ops<float> {
+            static constexpr size_t kLanes = 4;
+            TREE_TARGET_SSE42 static int less_mask(const float* keys, float key) {
+                return _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(keys), _mm_set1_ps(key)));
+            }
+            TREE_TARGET_SSE42 static int greater_mask(const float* keys, float key) {
+                return _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(keys), _mm_set1_ps(key)));
+            }
+        };
+
+        template <>
+        struct Sse42Ops<double> {
+            static constexpr size_t kLanes = 2;
+            TREE_TARGET_SSE42 static int less_mask(const double* keys, double key) {
+                return _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(keys), _mm_set1_pd(key)));
+            }
+            TREE_TARGET_SSE42 static int greater_mask(const double* keys, double key) {
+                return _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(keys), _mm_set1_pd(key)));
+            }
+        };
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TREE_POPCOUNT(x) __builtin_popcount(static_cast<unsigned>(x))
+#else
+#define TREE_POPCOUNT(x) __popcnt(static_cast<unsigned>(x))
+#endif
+
+        // 有序键数组中小于 key 的个数即 lower_bound 的位置；整块比较没有分支，不足一块的尾部逐个比较。
+        // 向量比较只通过内建函数读取内存，long 与 long long 等同宽整数可以共用一组实现
+        template <typename K>
+        TREE_TARGET_AVX2 size_t count_less_avx2(const K* keys, size_t count, K key) {
+            using S = simd_key_t<K>;
+            using Ops = Avx2Ops<S>;
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+                result += TREE_POPCOUNT(Ops::less_mask(reinterpret_cast<const S*>(keys + i), static_cast<S>(key)));
+            }
+            for (; i < count; i++) {
+                result += keys[i] < key;
+            }
+            return result;
+        }
+
+        template <typename K>
+        TREE_TARGET_AVX2 size_t count_greater_avx2(const K* keys, size_t count, K key) {
+            using S = simd_key_t<K>;
+            using Ops = Avx2Ops<S>;
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+                result += TREE_POPCOUNT(Ops::greater_mask(reinterpret_cast<const S*>(keys + i), static_cast<S>(key)));
+            }
+            for (; i < count; i++) {
+                result += key < keys[i];
+            }
+            return result;
+        }
+
+        template <typename K>
+        TREE_TARGET_SSE42 size_t count_less_sse42(const K* keys, size_t count, K key) {
+            using S = simd_key_t<K>;
+            using Ops = Sse42Ops<S>;
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+                result += TREE_POPCOUNT(Ops::less_mask(reinterpret_cast<const S*>(keys + i), static_cast<S>(key)));
+            }
+            for (; i < count; i++) {
+                result += keys[i] < key;
+            }
+            return result;
+        }
+
+        template <typename K>
+        TREE_TARGET_SSE42 size_t count_greater_sse42(const K* keys, size_t count, K key) {
+            using S = simd_key_t<K>;
+            using Ops = Sse42Ops<S>;
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+                result += TREE_POPCOUNT(Ops::greater_mask(reinterpret_cast<const S*>(keys + i), static_cast<S>(key)));
+            }
+            for (; i < count; i++) {
+                result += key < keys[i];
+            }
+            return result;
+        }
+
+#undef TREE_POPCOUNT
+#endif
+    }
+
+    // 节点内查找策略：lower_bound/upper_bound 在长度为 count 的有序键数组中查找
+    namespace search {
+        // 无分支二分查找，适用于任意键类型和比较器
+        struct binary {
+            template <typename K, typename Compare>
+            static size_t lower_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+                if (count == 0) return 0;
+                const K* base = keys;
+                while (count > 1) {
+                    size_t half = count / 2;
+                    base = comp(base[half], key) ? base + half : base;
+                    count -= half;
+                }
+                return static_cast<size_t>(base - keys) + comp(*base, key);
+            }
+
+            template <typename K, typename Compare>
+            static size_t upper_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+                if (count == 0) return 0;
+                const K* base = keys;
+                while (count > 1) {
+                    size_t half = count / 2;
+                    base = comp(key, base[half]) ? base : base + half;
+                    count -= half;
+                }
+                return static_cast<size_t>(base - keys) + !comp(key, *base);
+            }
+        };
+
+        // 逐个比较的线性查找，节点很小时可以比二分更快
+        struct linear {
+            template <typename K, typename Compare>
+            static size_t lower_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+                size_t i = 0;
+                while (i < count && comp(keys[i], key)) i++;
+                return i;
+            }
+
+            template <typename K, typename Compare>
+            static size_t upper_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+                size_t i = 0;
+                while (i < count && !comp(key, keys[i])) i++;
+                return i;
+            }
+        };
+
+        // 算术键按 AVX2 或 SSE4.2 整块比较并统计个数，运行时按 CPU 支持情况选择；
+        // 其他键类型、比较器或不支持的 CPU 退回 binary
+        struct simd {
+            template <typename K, typename Compare>
+            static size_t lower_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+#if defined(TREE_NODE_SEARCH_X86)
+                if constexpr (detail::simd_searchable<K, Compare>::value) {
+                    if (detail::kSimdLevel == detail::SimdLevel::avx2) return detail::count_less_avx2(keys, count, key);
+                    if (detail::kSimdLevel == detail::SimdLevel::sse42) return detail::count_less_sse42(keys, count, key);
+                }
+#endif
+                return binary::lower_bound(keys, count, key, comp);
+            }
+
+            template <typename K, typename Compare>
+            static size_t upper_bound(const K* keys, size_t count, const K& key, const Compare& comp) {
+#if defined(TREE_NODE_SEARCH_X86)
+                if constexpr (detail::simd_searchable<K, Compare>::value) {
+                    if (detail::kSimdLevel == detail::SimdLevel::avx2) return count - detail::count_greater_avx2(keys, count, key);
+                    if (detail::kSimdLevel == detail::SimdLevel::sse42) return count - detail::count_greater_sse42(keys, count, key);
+                }
+#endif
+                return binary::upper_bound(keys, count, key, comp);
+            }
+        };
+
+        // 树的默认查找策略。64 位整数键在 16/32 个键的节点上 simd 比无分支二分慢约 20%~40%
+        // （AVX2 下 x16：8.9 vs 7.4 ns，x32：13.3 vs 10.1 ns），改用 binary；
+        // float/double 与 32 位整数键 simd 更快，保持 simd
+        template <typename K>
+        using default_policy = std::conditional_t<std::is_integral<K>::value && sizeof(K) == 8, binary, simd>;
+    }
+}
+
+#endif
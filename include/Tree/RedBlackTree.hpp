@@ -0,0 +1,999 @@
+#ifndef RED_BLACK_TREE_HPP
+#define RED_BLACK_TREE_HPP
+
+#include <Linear/NodePool.hpp>
+#include <Linear/Stats.hpp>
+#include <Tree/BinaryTree.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Tree {
+    // 红黑树的链接：颜色存放在父指针的最低位（0 为红，1 为黑），一个链接只占三个指针。
+    // 根节点的父指针为空；未链接时 parent_color 为 0（有父节点的才可能是红色，根总是黑色）
+    struct RBLink {
+        RBLink* left;
+        RBLink* right;
+        uintptr_t parent_color;
+
+        RBLink* parent() const {
+            return reinterpret_cast<RBLink*>(parent_color & ~static_cast<uintptr_t>(1));
+        }
+        bool red() const {
+            return (parent_color & 1) == 0;
+        }
+        void set_parent(RBLink* parent) {
+            parent_color = reinterpret_cast<uintptr_t>(parent) | (parent_color & 1);
+        }
+        void set_red() {
+            parent_color &= ~static_cast<uintptr_t>(1);
+        }
+        void set_black() {
+            parent_color |= 1;
+        }
+    };
+
+    static_assert(alignof(RBLink) >= 2, "the colour bit needs pointer alignment of at least 2");
+
+    template <>
+    struct BinaryLinkTraits<RBLink> {
+        static RBLink* parent(const RBLink* link) {
+            return link->parent();
+        }
+    };
+
+    // 一棵树的根以及最左、最右节点；最左、最右节点使 begin() 与 --end() 为 O(1)
+    struct RBRoot {
+        RBLink* root;
+        RBLink* leftmost;
+        RBLink* rightmost;
+    };
+
+    namespace detail {
+        inline bool rb_is_red(const RBLink* node) {
+            return node != nullptr && node->red();
+        }
+
+        inline RBLink* rb_next(RBLink* node) {
+            if (node->right != nullptr) {
+                node = node->right;
+                while (node->left != nullptr) node = node->left;
+                return node;
+            }
+            RBLink* parent = node->parent();
+            while (parent != nullptr && node == parent->right) {
+                node = parent;
+                parent = parent->parent();
+            }
+            return parent;
+        }
+
+        inline RBLink* rb_prev(RBLink* node) {
+            if (node->left != nullptr) {
+                node = node->left;
+                while (node->right != nullptr) node = node->right;
+                return node;
+            }
+            RBLink* parent = node->parent();
+            while (parent != nullptr && node == parent->left) {
+                node = parent;
+                parent = parent->parent();
+            }
+            return parent;
+        }
+
+        // 把 parent 指向 old_child 的链接改为指向 new_child，parent 为空时改根
+        inline void rb_replace_child(RBLink* old_child, RBLink* new_child, RBLink* parent, RBLink*& root) {
+            if (parent == nullptr) {
+                root = new_child;
+            } else if (parent->left == old_child) {
+                parent->left = new_child;
+            } else {
+                parent->right = new_child;
+            }
+        }
+
+        inline void rb_rotate_left(RBLink* node, RBLink*& root) {
+            RBLink* pivot = node->right;
+            RBLink* parent = node->parent();
+            node->right = pivot->left;
+            if (pivot->left != nullptr) pivot->left->set_parent(node);
+            pivot->set_parent(parent);
+            rb_replace_child(node, pivot, parent, root);
+            pivot->left = node;
+            node->set_parent(pivot);
+        }
+
+        inline void rb_rotate_right(RBLink* node, RBLink*& root) {
+            RBLink* pivot = node->left;
+            RBLink* parent = node->parent();
+            node->left = pivot->right;
+            if (pivot->right != nullptr) pivot->right->set_parent(node);
+            pivot->set_parent(parent);
+            rb_replace_child(node, pivot, parent, root);
+            pivot->right = node;
+            node->set_parent(pivot);
+        }
+
+        // 返回旋转的次数
+        inline size_t rb_insert_fixup(RBLink* node, RBLink*& root) {
+            size_t rotations = 0;
+            while (node != root && node->parent()->red()) {
+                RBLink* parent = node->parent();
+                RBLink* grandparent = parent->parent();
+                if (parent == grandparent->left) {
+                    RBLink* uncle = grandparent->right;
+                    if (rb_is_red(uncle)) {
+                        parent->set_black();
+                        uncle->set_black();
+                        grandparent->set_red();
+                        node = grandparent;
+                        continue;
+                    }
+                    if (node == parent->right) {
+                        rb_rotate_left(parent, root);
+                        rotations++;
+                        parent = node;
+                    }
+                    parent->set_black();
+                    grandparent->set_red();
+                    rb_rotate_right(grandparent, root);
+                    rotations++;
+                } else {
+                    RBLink* uncle = grandparent->left;
+                    if (rb_is_red(uncle)) {
+                        parent->set_black();
+                        uncle->set_black();
+                        grandparent->set_red();
+                        node = grandparent;
+                        continue;
+                    }
+                    if (node == parent->left) {
+                        rb_rotate_right(parent, root);
+                        rotations++;
+                        parent = node;
+                    }
+                    parent->set_black();
+                    grandparent->set_red();
+                    rb_rotate_left(grandparent, root);
+                    rotations++;
+                }
+                break;
+            }
+            root->set_black();
+            return rotations;
+        }
+
+        // 删除了一个黑色节点后修复：node 是顶替它的节点（可能为空），parent 是 node 的父节点。返回旋转的次数
+        inline size_t rb_erase_fixup(RBLink* node, RBLink* parent, RBLink*& root) {
+            size_t rotations = 0;
+            while (node != root && !rb_is_red(node)) {
+                if (node == parent->left) {
+                    RBLink* sibling = parent->right;
+                    if (sibling->red()) {
+                        sibling->set_black();
+                        parent->set_red();
+                        rb_rotate_left(parent, root);
+                        rotations++;
+                        sibling = parent->right;
+                    }
+                    if (!rb_is_red(sibling->left) && !rb_is_red(sibling->right)) {
+                        sibling->set_red();
+                        node = parent;
+                        parent = node->parent();
+                        continue;
+                    }
+                    if (!rb_is_red(sibling->right)) {
+                        sibling->left->set_black();
+                        sibling->set_red();
+                        rb_rotate_right(sibling, root);
+                        rotations++;
+                        sibling = parent->right;
+                    }
+                    sibling->parent_color = reinterpret_cast<uintptr_t>(sibling->parent()) | (parent->parent_color & 1);
+                    parent->set_black();
+                    sibling->right->set_black();
+                    rb_rotate_left(parent, root);
+                    rotations++;
+                } else {
+                    RBLink* sibling = parent->left;
+                    if (sibling->red()) {
+                        sibling->set_black();
+                        parent->set_red();
+                        rb_rotate_right(parent, root);
+                        rotations++;
+                        sibling = parent->left;
+                    }
+                    if (!rb_is_red(sibling->left) && !rb_is_red(sibling->right)) {
+                        sibling->set_red();
+                        node = parent;
+                        parent = node->parent();
+                        continue;
+                    }
+                    if (!rb_is_red(sibling->left)) {
+                        sibling->right->set_black();
+                        sibling->set_red();
+                        rb_rotate_left(sibling, root);
+                        rotations++;
+                        sibling = parent->left;
+                    }
+                    sibling->parent_color = reinterpret_cast<uintptr_t>(sibling->parent()) | (parent->parent_color & 1);
+                    parent->set_black();
+                    sibling->left->set_black();
+                    rb_rotate_right(parent, root);
+                    rotations++;
+                }
+                node = root;
+                break;
+            }
+            if (node != nullptr) node->set_black();
+            return rotations;
+        }
+
+        // 把 node 链接为 parent 的左（left 为真）或右子节点并重新平衡；parent 为空时 node 成为根。返回旋转的次数
+        inline size_t rb_insert(RBRoot& tree, RBLink* node, RBLink* parent, bool left) {
+            node->left = nullptr;
+            node->right = nullptr;
+            node->parent_color = reinterpret_cast<uintptr_t>(parent);
+            if (parent == nullptr) {
+                tree.root = tree.leftmost = tree.rightmost = node;
+            } else if (left) {
+                parent->left = node;
+                if (parent == tree.leftmost) tree.leftmost = node;
+            } else {
+                parent->right = node;
+                if (parent == tree.rightmost) tree.rightmost = node;
+            }
+            return rb_insert_fixup(node, tree.root);
+        }
+
+        // 从树中摘下 node 并重新平衡，node 的链接被置为未链接状态。返回旋转的次数
+        inline size_t rb_erase(RBRoot& tree, RBLink* node) {
+            if (node == tree.leftmost) tree.leftmost = rb_next(node);
+            if (node == tree.rightmost) tree.rightmost = rb_prev(node);
+
+            RBLink* child;
+            RBLink* child_parent;
+            bool removed_black;
+            if (node->left == nullptr || node->right == nullptr) {
+                child = node->left != nullptr ? node->left : node->right;
+                child_parent = node->parent();
+                removed_black = !node->red();
+                rb_replace_child(node, child, child_parent, tree.root);
+                if (child != nullptr) child->set_parent(child_parent);
+            } else {
+                // 有两个子节点时用后继顶替 node 的位置和颜色
+                RBLink* successor = node->right;
+                while (successor->left != nullptr) successor = successor->left;
+                removed_black = !successor->red();
+                child = successor->right;
+                if (successor->parent() == node) {
+                    child_parent = successor;
+                } else {
+                    child_parent = successor->parent();
+                    child_parent->left = child;
+                    if (child != nullptr) child->set_parent(child_parent);
+                    successor->right = node->right;
+                    node->right->set_parent(successor);
+                }
+                successor->left = node->left;
+                node->left->set_parent(successor);
+                rb_replace_child(node, successor, node->parent(), tree.root);
+                successor->parent_color = node->parent_color;
+            }
+            size_t rotations = removed_black ? rb_erase_fixup(child, child_parent, tree.root) : 0;
+
+            node->left = nullptr;
+            node->right = nullptr;
+            node->parent_color = 0;
+            return rotations;
+        }
+
+        // 检查父指针、红节点的子节点为黑、各路径黑高相同；返回黑高，不满足时返回 -1
+        inline int rb_black_height(const RBLink* node, const RBLink* parent) {
+            if (node == nullptr) return 1;
+            if (node->parent() != parent) return -1;
+            if (node->red() && (rb_is_red(node->left) || rb_is_red(node->right))) return -1;
+            int left = rb_black_height(node->left, node);
+            int right = rb_black_height(node->right, node);
+            if (left < 0 || left != right) return -1;
+            return left + (node->red() ? 0 : 1);
+        }
+
+        inline bool rb_validate(const RBRoot& tree) {
+            if (tree.root == nullptr) return tree.leftmost == nullptr && tree.rightmost == nullptr;
+            if (tree.root->red() || rb_black_height(tree.root, nullptr) < 0) return false;
+            const RBLink* leftmost = tree.root;
+            while (leftmost->left != nullptr) leftmost = leftmost->left;
+            const RBLink* rightmost = tree.root;
+            while (rightmost->right != nullptr) rightmost = rightmost->right;
+            return leftmost == tree.leftmost && rightmost == tree.rightmost;
+        }
+
+        struct red_black_tree_stats_name {
+            static constexpr const char* value = "Tree::RedBlackTree";
+        };
+    }
+
+    // 双向迭代器；Access::value 把链接转换为元素。end() 为空链接，--end() 通过所属树的最右节点得到
+    template <typename Value, typename Access>
+    class RedBlackTreeIterator {
+    private:
+        RBLink* node_;
+        const RBRoot* tree_;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::remove_const_t<Value>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Value&;
+        using pointer = Value*;
+
+        RedBlackTreeIterator(RBLink* node = nullptr, const RBRoot* tree = nullptr) : node_(node), tree_(tree) {}
+
+        reference operator*() const {
+            return Access::value(node_);
+        }
+
+        pointer operator->() const {
+            return &Access::value(node_);
+        }
+
+        RedBlackTreeIterator& operator++() {
+            node_ = detail::rb_next(node_);
+            return *this;
+        }
+
+        RedBlackTreeIterator& operator--() {
+            node_ = node_ == nullptr ? tree_->rightmost : detail::rb_prev(node_);
+            return *this;
+        }
+
+        bool operator==(const RedBlackTreeIterator& other) const {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const RedBlackTreeIterator& other) const {
+            return !(*this == other);
+        }
+
+        template <typename, typename, typename, typename, typename>
+        friend class RedBlackTree;
+        template <typename, typename, typename, typename>
+        friend class IntrusiveRedBlackTree;
+    };
+
+    template <typename K, typename V>
+    struct RBNode : RBLink {
+        std::pair<const K, V> value;
+
+        template <typename... Args>
+        explicit RBNode(Args&&... args) : RBLink(), value(std::forward<Args>(args)...) {}
+    };
+
+    // 红黑树有序映射：节点由 Linear::NodePool 按 slab 连续分配，节点为三个指针加上键值对。
+    // 键唯一；插入、删除、查找为 O(log n)，insert_hint 在提示位置正确时为均摊 O(1)。
+    // Stats 为计数策略（见 Linear/Stats.hpp），计节点分配、键比较与旋转
+    template <typename K, typename V, typename Compare = std::less<K>,
+              typename Alloc = std::allocator<std::pair<const K, V>>, typename Stats = Linear::stats::default_policy>
+    class RedBlackTree : public BinaryTree<RedBlackTree<K, V, Compare, Alloc, Stats>, RBLink>,
+                         private Linear::stats::Recorder<Stats, detail::red_black_tree_stats_name> {
+    private:
+        using Node = RBNode<K, V>;
+
+        struct Access {
+            static std::pair<const K, V>& value(RBLink* link) {
+                return static_cast<Node*>(link)->value;
+            }
+        };
+
+        friend class BinaryTree<RedBlackTree, RBLink>;
+
+        RBRoot tree_;
+        size_t size_;
+        Compare comp_;
+        Linear::NodePool<Node, Alloc> pool_;
+
+    private:
+        RBLink* root_link() const {
+            return tree_.root;
+        }
+
+        static const K& key_of(const RBLink* link) {
+            return static_cast<const Node*>(link)->value.first;
+        }
+
+        bool less(const K& a, const K& b) const {
+            this->count_comparisons(1);
+            return comp_(a, b);
+        }
+
+        template <typename... Args>
+        Node* create_node(Args&&... args) {
+            this->count_node_allocations(1);
+            Node* node = pool_.allocate();
+            try {
+                new (node) Node(std::forward<Args>(args)...);
+            } catch (...) {
+                pool_.deallocate(node);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(RBLink* link) {
+            Node* node = static_cast<Node*>(link);
+            node->~Node();
+            pool_.deallocate(node);
+        }
+
+        // 后序释放，不需要栈：每次下降到叶子，释放后回到父节点
+        void destroy_all() {
+            RBLink* node = tree_.root;
+            while (node != nullptr) {
+                if (node->left != nullptr) {
+                    node = node->left;
+                } else if (node->right != nullptr) {
+                    node = node->right;
+                } else {
+                    RBLink* parent = node->parent();
+                    if (parent != nullptr) {
+                        if (parent->left == node) {
+                            parent->left = nullptr;
+                        } else {
+                            parent->right = nullptr;
+                        }
+                    }
+                    destroy_node(node);
+                    node = parent;
+                }
+            }
+            tree_ = RBRoot{nullptr, nullptr, nullptr};
+            size_ = 0;
+        }
+
+        RBLink* lower_bound_link(const K& key) const {
+            RBLink* node = tree_.root;
+            RBLink* result = nullptr;
+            while (node != nullptr) {
+                if (!less(key_of(node), key)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        RBLink* upper_bound_link(const K& key) const {
+            RBLink* node = tree_.root;
+            RBLink* result = nullptr;
+            while (node != nullptr) {
+                if (less(key, key_of(node))) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        // 从根查找插入位置，每层只比较一次；键已存在时返回已有节点
+        template <typename M>
+        std::pair<RBLink*, bool> insert_unique(const K& key, M&& value, bool assign) {
+            RBLink* parent = nullptr;
+            RBLink* candidate = nullptr;
+            bool left = false;
+            for (RBLink* node = tree_.root; node != nullptr;) {
+                parent = node;
+                left = less(key, key_of(node));
+                if (left) {
+                    node = node->left;
+                } else {
+                    candidate = node;
+                    node = node->right;
+                }
+            }
+            if (candidate != nullptr && !less(key_of(candidate), key)) {
+                if (assign) static_cast<Node*>(candidate)->value.second = std::forward<M>(value);
+                return {candidate, false};
+            }
+            return {link_new(parent, left, key, std::forward<M>(value)), true};
+        }
+
+        template <typename M>
+        RBLink* link_new(RBLink* parent, bool left, const K& key, M&& value) {
+            Node* node = create_node(key, std::forward<M>(value));
+            this->count_rotations(detail::rb_insert(tree_, node, parent, left));
+            size_++;
+            return node;
+        }
+
+        void steal(RedBlackTree& other) {
+            tree_ = other.tree_;
+            size_ = other.size_;
+            other.tree_ = RBRoot{nullptr, nullptr, nullptr};
+            other.size_ = 0;
+        }
+
+        void copy_from(const RedBlackTree& other) {
+            for (RBLink* node = other.tree_.leftmost; node != nullptr; node = detail::rb_next(node)) {
+                const std::pair<const K, V>& entry = Access::value(node);
+                link_new(tree_.rightmost, false, entry.first, entry.second);
+            }
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using iterator = RedBlackTreeIterator<value_type, Access>;
+
+        explicit RedBlackTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+            : tree_{nullptr, nullptr, nullptr}, size_(0), comp_(comp), pool_(alloc) {}
+
+        RedBlackTree(const RedBlackTree& other)
+            : RedBlackTree(other.comp_,
+                           std::allocator_traits<Alloc>::select_on_container_copy_construction(other.get_allocator())) {
+            try {
+                copy_from(other);
+            } catch (...) {
+                destroy_all();
+                throw;
+            }
+        }
+
+        // 连同节点池一起接管，other 留下一个空池
+        RedBlackTree(RedBlackTree&& other) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
+            : tree_{nullptr, nullptr, nullptr}, size_(0), comp_(other.comp_), pool_(std::move(other.pool_)) {
+            steal(other);
+        }
+
+        ~RedBlackTree() {
+            destroy_all();
+        }
+
+        RedBlackTree& operator=(const RedBlackTree& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            copy_from(other);
+            return *this;
+        }
+
+        // 不传播分配器；分配器不相等时逐个移动元素
+        RedBlackTree& operator=(RedBlackTree&& other) {
+            if (this == &other) return *this;
+            clear();
+            comp_ = other.comp_;
+            if (get_allocator() == other.get_allocator()) {
+                pool_.swap(other.pool_);
+                steal(other);
+            } else {
+                for (RBLink* node = other.tree_.leftmost; node != nullptr; node = detail::rb_next(node)) {
+                    value_type& entry = Access::value(node);
+                    link_new(tree_.rightmost, false, entry.first, std::move(entry.second));
+                }
+                other.clear();
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return Alloc(pool_.get_allocator());
+        }
+
+        // 键已存在时不修改，返回已有元素
+        std::pair<iterator, bool> insert(const K& key, const V& value) {
+            auto result = insert_unique(key, value, false);
+            return {iterator(result.first, &tree_), result.second};
+        }
+
+        std::pair<iterator, bool> insert(const K& key, V&& value) {
+            auto result = insert_unique(key, std::move(value), false);
+            return {iterator(result.first, &tree_), result.second};
+        }
+
+        std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+            auto result = insert_unique(key, value, true);
+            return {iterator(result.first, &tree_), result.second};
+        }
+
+        // hint 为新键的后继（或 end()）、或新键的前驱时直接在该处链接，不从根查找；
+        // 顺序或近似有序的输入传入上一次返回的迭代器或 end() 即可。提示不对时退化为普通插入
+        iterator insert_hint(iterator hint, const K& key, const V& value) {
+            RBLink* next = hint.node_;
+            RBLink* prev = next == nullptr ? tree_.rightmost : detail::rb_prev(next);
+            if (next != nullptr && !less(key, key_of(next))) {
+                // 新键不在 hint 之前时，尝试放在 hint 之后
+                if (!less(key_of(next), key)) return hint;
+                prev = next;
+                next = detail::rb_next(next);
+                if (next != nullptr && !less(key, key_of(next))) return insert(key, value).first;
+            }
+            if (prev != nullptr && !less(key_of(prev), key)) {
+                if (!less(key, key_of(prev))) return iterator(prev, &tree_);
+                return insert(key, value).first;
+            }
+
+            // prev < key < next：两者相邻，其中一个在对应方向上必然没有子节点
+            RBLink* node = (prev != nullptr && prev->right == nullptr) ? link_new(prev, false, key, value)
+                                                                       : link_new(next, true, key, value);
+            return iterator(node, &tree_);
+        }
+
+        V& operator[](const K& key) {
+            return static_cast<Node*>(insert_unique(key, V(), false).first)->value.second;
+        }
+
+        V& at(const K& key) {
+            iterator it = find(key);
+            if (it == end()) throw std::out_of_range("Key not found");
+            return it->second;
+        }
+
+        iterator find(const K& key) {
+            RBLink* node = lower_bound_link(key);
+            if (node == nullptr || less(key, key_of(node))) return end();
+            return iterator(node, &tree_);
+        }
+
+        bool contains(const K& key) const {
+            RBLink* node = lower_bound_link(key);
+            return node != nullptr && !less(key, key_of(node));
+        }
+
+        // 第一个不小于 key 的元素
+        iterator lower_bound(const K& key) {
+            return iterator(lower_bound_link(key), &tree_);
+        }
+
+        // 第一个大于 key 的元素
+        iterator upper_bound(const K& key) {
+            return iterator(upper_bound_link(key), &tree_);
+        }
+
+        // 返回被删除元素的下一个元素
+        iterator erase(iterator pos) {
+            RBLink* node = pos.node_;
+            RBLink* next = detail::rb_next(node);
+            this->count_rotations(detail::rb_erase(tree_, node));
+            destroy_node(node);
+            size_--;
+            return iterator(next, &tree_);
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(const K& key) {
+            iterator it = find(key);
+            if (it == end()) return 0;
+            erase(it);
+            return 1;
+        }
+
+        void clear() {
+            destroy_all();
+        }
+
+        // 归还池中完全空闲的 slab
+        void shrink_to_fit() {
+            pool_.shrink_to_fit();
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        // 检查红黑性质、父指针、最左最右节点、键严格递增以及元素个数
+        bool validate() const {
+            if (!detail::rb_validate(tree_)) return false;
+            size_t count = 0;
+            for (RBLink* node = tree_.leftmost; node != nullptr; node = detail::rb_next(node)) {
+                RBLink* next = detail::rb_next(node);
+                if (next != nullptr && !less(key_of(node), key_of(next))) return false;
+                count++;
+            }
+            return count == size_;
+        }
+
+        iterator begin() {
+            return iterator(tree_.leftmost, &tree_);
+        }
+
+        iterator end() {
+            return iterator(nullptr, &tree_);
+        }
+
+        // Stats 为 Linear::stats::none 时全为零
+        Linear::stats::Counters stats() const {
+            return this->counters();
+        }
+    };
+
+    // 侵入式红黑树的钩子：元素类型继承 RBHook<Tag>，同一个对象用不同的 Tag 可以同时挂在多棵树上。
+    // 复制元素时钩子不随之复制，副本处于未链接状态
+    template <typename Tag = void>
+    struct RBHook : RBLink {
+        RBHook() : RBLink{nullptr, nullptr, 0} {}
+        RBHook(const RBHook&) : RBHook() {}
+        RBHook& operator=(const RBHook&) {
+            return *this;
+        }
+
+        bool is_linked() const {
+            return parent_color != 0;
+        }
+    };
+
+    // 侵入式红黑树：不分配内存也不拥有元素，元素由使用者管理，且在挂在树上期间不能移动或析构。
+    // KeyOf 从元素取出键；insert 要求键唯一，insert_multi 允许重复键并排在相等元素之后。
+    // 树析构或 clear 时摘下全部元素
+    template <typename T, typename KeyOf, typename Compare = std::less<>, typename Tag = void>
+    class IntrusiveRedBlackTree : public BinaryTree<IntrusiveRedBlackTree<T, KeyOf, Compare, Tag>, RBLink> {
+    private:
+        using Hook = RBHook<Tag>;
+
+        struct Access {
+            static T& value(RBLink* link) {
+                return static_cast<T&>(static_cast<Hook&>(*link));
+            }
+        };
+
+        friend class BinaryTree<IntrusiveRedBlackTree, RBLink>;
+
+        RBRoot tree_;
+        size_t size_;
+        Compare comp_;
+        KeyOf key_of_;
+
+    private:
+        RBLink* root_link() const {
+            return tree_.root;
+        }
+
+        static RBLink* link_of(T& value) {
+            return static_cast<Hook*>(&value);
+        }
+
+        decltype(auto) key_of(RBLink* link) const {
+            return key_of_(Access::value(link));
+        }
+
+        template <typename A, typename B>
+        bool less(const A& a, const B& b) const {
+            return comp_(a, b);
+        }
+
+        template <typename Key>
+        RBLink* lower_bound_link(const Key& key) const {
+            RBLink* node = tree_.root;
+            RBLink* result = nullptr;
+            while (node != nullptr) {
+                if (!comp_(key_of(node), key)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        template <typename Key>
+        RBLink* upper_bound_link(const Key& key) const {
+            RBLink* node = tree_.root;
+            RBLink* result = nullptr;
+            while (node != nullptr) {
+                if (comp_(key, key_of(node))) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        // 摘下全部元素：后序遍历，逐个重置钩子
+        void unlink_all() {
+            RBLink* node = tree_.root;
+            while (node != nullptr) {
+                if (node->left != nullptr) {
+                    node = node->left;
+                } else if (node->right != nullptr) {
+                    node = node->right;
+                } else {
+                    RBLink* parent = node->parent();
+                    if (parent != nullptr) {
+                        if (parent->left == node) {
+                            parent->left = nullptr;
+                        } else {
+                            parent->right = nullptr;
+                        }
+                    }
+                    node->parent_color = 0;
+                    node = parent;
+                }
+            }
+            tree_ = RBRoot{nullptr, nullptr, nullptr};
+            size_ = 0;
+        }
+
+    public:
+        using value_type = T;
+        using key_type = std::decay_t<decltype(std::declval<const KeyOf&>()(std::declval<const T&>()))>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using iterator = RedBlackTreeIterator<T, Access>;
+
+        explicit IntrusiveRedBlackTree(const Compare& comp = Compare(), const KeyOf& key_of = KeyOf())
+            : tree_{nullptr, nullptr, nullptr}, size_(0), comp_(comp), key_of_(key_of) {}
+
+        IntrusiveRedBlackTree(const IntrusiveRedBlackTree&) = delete;
+        IntrusiveRedBlackTree& operator=(const IntrusiveRedBlackTree&) = delete;
+
+        IntrusiveRedBlackTree(IntrusiveRedBlackTree&& other) noexcept
+            : tree_(other.tree_), size_(other.size_), comp_(other.comp_), key_of_(other.key_of_) {
+            other.tree_ = RBRoot{nullptr, nullptr, nullptr};
+            other.size_ = 0;
+        }
+
+        IntrusiveRedBlackTree& operator=(IntrusiveRedBlackTree&& other) noexcept {
+            if (this == &other) return *this;
+            unlink_all();
+            tree_ = other.tree_;
+            size_ = other.size_;
+            comp_ = other.comp_;
+            key_of_ = other.key_of_;
+            other.tree_ = RBRoot{nullptr, nullptr, nullptr};
+            other.size_ = 0;
+            return *this;
+        }
+
+        ~IntrusiveRedBlackTree() {
+            unlink_all();
+        }
+
+        // value 必须未链接在使用同一 Tag 的树上；键已存在时不插入，返回已有元素
+        std::pair<iterator, bool> insert(T& value) {
+            RBLink* parent = nullptr;
+            RBLink* candidate = nullptr;
+            bool left = false;
+            const auto& key = key_of_(value);
+            for (RBLink* node = tree_.root; node != nullptr;) {
+                parent = node;
+                left = comp_(key, key_of(node));
+                if (left) {
+                    node = node->left;
+                } else {
+                    candidate = node;
+                    node = node->right;
+                }
+            }
+            if (candidate != nullptr && !comp_(key_of(candidate), key)) return {iterator(candidate, &tree_), false};
+            detail::rb_insert(tree_, link_of(value), parent, left);
+            size_++;
+            return {iterator(link_of(value), &tree_), true};
+        }
+
+        // 允许重复键，新元素排在所有相等元素之后
+        iterator insert_multi(T& value) {
+            RBLink* parent = nullptr;
+            bool left = false;
+            const auto& key = key_of_(value);
+            for (RBLink* node = tree_.root; node != nullptr;) {
+                parent = node;
+                left = comp_(key, key_of(node));
+                node = left ? node->left : node->right;
+            }
+            detail::rb_insert(tree_, link_of(value), parent, left);
+            size_++;
+            return iterator(link_of(value), &tree_);
+        }
+
+        // 摘下 value，不需要查找；value 必须在本树上
+        void erase(T& value) {
+            detail::rb_erase(tree_, link_of(value));
+            size_--;
+        }
+
+        // 返回被摘下元素的下一个元素
+        iterator erase(iterator pos) {
+            RBLink* next = detail::rb_next(pos.node_);
+            erase(*pos);
+            return iterator(next, &tree_);
+        }
+
+        // 最小的元素，空树时行为未定义
+        T& front() {
+            return Access::value(tree_.leftmost);
+        }
+
+        T& back() {
+            return Access::value(tree_.rightmost);
+        }
+
+        // 摘下并返回最小的元素，用于定时器等按键取最早元素的场景
+        T& pop_front() {
+            T& value = front();
+            erase(value);
+            return value;
+        }
+
+        template <typename Key>
+        iterator find(const Key& key) {
+            RBLink* node = lower_bound_link(key);
+            if (node == nullptr || comp_(key, key_of(node))) return end();
+            return iterator(node, &tree_);
+        }
+
+        template <typename Key>
+        bool contains(const Key& key) const {
+            RBLink* node = lower_bound_link(key);
+            return node != nullptr && !comp_(key, key_of(node));
+        }
+
+        template <typename Key>
+        iterator lower_bound(const Key& key) {
+            return iterator(lower_bound_link(key), &tree_);
+        }
+
+        template <typename Key>
+        iterator upper_bound(const Key& key) {
+            return iterator(upper_bound_link(key), &tree_);
+        }
+
+        // value 必须在本树上
+        iterator iterator_to(T& value) {
+            return iterator(link_of(value), &tree_);
+        }
+
+        void clear() {
+            unlink_all();
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        // 检查红黑性质、父指针、最左最右节点、键有序以及元素个数
+        bool validate() const {
+            if (!detail::rb_validate(tree_)) return false;
+            size_t count = 0;
+            for (RBLink* node = tree_.leftmost; node != nullptr; node = detail::rb_next(node)) {
+                RBLink* next = detail::rb_next(node);
+                if (next != nullptr && comp_(key_of(next), key_of(node))) return false;
+                count++;
+            }
+            return count == size_;
+        }
+
+        iterator begin() {
+            return iterator(tree_.leftmost, &tree_);
+        }
+
+        iterator end() {
+            return iterator(nullptr, &tree_);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,1766 @@
+#ifndef TRIE_HPP
+#define TRIE_HPP
+
+#include <Linear/SmallVector.hpp>
+#include <Tree/MappedFile.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TREE_TRIE_SSE2 1
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Tree {
+    namespace detail {
+        enum class ArtType : uint8_t { node4, node16, node48, node256 };
+
+        // 压缩路径最多内联保存 kArtPrefix 字节，更长的前缀只记录长度：查找时跳过未保存的部分，
+        // 到叶子再比较完整的键；插入需要完整前缀时从子树中任取一个叶子读出
+        inline constexpr size_t kArtPrefix = 8;
+
+        // 内部节点的公共头部。terminal 指向恰好在本节点结束的键（例如同时存在 "/a" 与 "/a/b"），
+        // 子节点指针的最低位为 1 时指向叶子
+        struct ArtNode {
+            ArtType type;
+            uint16_t count;
+            uint32_t prefix_length;
+            unsigned char prefix[kArtPrefix];
+            void* terminal;
+        };
+
+        struct ArtNode4 : ArtNode {
+            static constexpr ArtType kType = ArtType::node4;
+            static constexpr size_t kCapacity = 4;
+            unsigned char keys[4];
+            ArtNode* children[4];
+        };
+
+        struct ArtNode16 : ArtNode {
+            static constexpr ArtType kType = ArtType::node16;
+            static constexpr size_t kCapacity = 16;
+            unsigned char keys[16];
+            ArtNode* children[16];
+        };
+
+        // index[byte] 为 0 表示没有该子节点，否则为 children 中的下标加一
+        struct ArtNode48 : ArtNode {
+            static constexpr ArtType kType = ArtType::node48;
+            static constexpr size_t kCapacity = 48;
+            uint8_t index[256];
+            ArtNode* children[48];
+        };
+
+        struct ArtNode256 : ArtNode {
+            static constexpr ArtType kType = ArtType::node256;
+            static constexpr size_t kCapacity = 256;
+            ArtNode* children[256];
+        };
+
+        inline unsigned art_ctz(unsigned mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+
+        // 在有序的 keys[0, count) 中查找 byte，返回下标，找不到返回 count
+        inline size_t art_find_key16(const unsigned char* keys, size_t count, unsigned char byte) {
+#if defined(TREE_TRIE_SSE2)
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+            __m128i equal = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(byte)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal)) & ((1u << count) - 1);
+            return mask != 0 ? art_ctz(mask) : count;
+#else
+            for (size_t i = 0; i < count; i++) {
+                if (keys[i] == byte) return i;
+            }
+            return count;
+#endif
+        }
+
+        // 有序的 keys[0, count) 中第一个不小于 byte 的位置
+        inline size_t art_lower_bound16(const unsigned char* keys, size_t count, unsigned char byte) {
+#if defined(TREE_TRIE_SSE2)
+            // SSE2 只有有符号字节比较，两边同时翻转最高位后按无符号比较
+            __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+            __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys)), flip);
+            __m128i probe = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip);
+            unsigned less = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(block, probe)));
+            unsigned mask = ~less & ((1u << count) - 1);
+            return mask != 0 ? art_ctz(mask) : count;
+#else
+            size_t pos = 0;
+            while (pos < count && keys[pos] < byte) pos++;
+            return pos;
+#endif
+        }
+
+        // 返回 byte 对应的子节点槽位，没有时返回 nullptr
+        inline ArtNode** art_find_child(ArtNode* node, unsigned char byte) {
+            switch (node->type) {
+                case ArtType::node4: {
+                    ArtNode4* n = static_cast<ArtNode4*>(node);
+                    for (size_t i = 0; i < n->count; i++) {
+                        if (n->keys[i] == byte) return &n->children[i];
+                    }
+                    return nullptr;
+                }
+                case ArtType::node16: {
+                    ArtNode16* n = static_cast<ArtNode16*>(node);
+                    size_t i = art_find_key16(n->keys, n->count, byte);
+                    return i < n->count ? &n->children[i] : nullptr;
+                }
+                case ArtType::node48: {
+                    ArtNode48* n = static_cast<ArtNode48*>(node);
+                    return n->index[byte] != 0 ? &n->children[n->index[byte] - 1] : nullptr;
+                }
+                default: {
+                    ArtNode256* n = static_cast<ArtNode256*>(node);
+                    return n->children[byte] != nullptr ? &n->children[byte] : nullptr;
+                }
+            }
+        }
+
+        // 按字节升序对每个子节点调用 fn(byte, child)
+        template <typename Fn>
+        void art_for_each_child(ArtNode* node, Fn&& fn) {
+            switch (node->type) {
+                case ArtType::node4: {
+                    ArtNode4* n = static_cast<ArtNode4*>(node);
+                    for (size_t i = 0; i < n->count; i++) fn(n->keys[i], n->children[i]);
+                    break;
+                }
+                case ArtType::node16: {
+                    ArtNode16* n = static_cast<ArtNode16*>(node);
+                    for (size_t i = 0; i < n->count; i++) fn(n->keys[i], n->children[i]);
+                    break;
+                }
+                case ArtType::node48: {
+                    ArtNode48* n = static_cast<ArtNode48*>(node);
+                    for (size_t byte = 0; byte < 256; byte++) {
+                        if (n->index[byte] != 0) fn(static_cast<unsigned char>(byte), n->children[n->index[byte] - 1]);
+                    }
+                    break;
+                }
+                default: {
+                    ArtNode256* n = static_cast<ArtNode256*>(node);
+                    for (size_t byte = 0; byte < 256; byte++) {
+                        if (n->children[byte] != nullptr) fn(static_cast<unsigned char>(byte), n->children[byte]);
+                    }
+                }
+            }
+        }
+
+        // 子节点槽位数组及其长度，未使用的槽位为 nullptr
+        inline ArtNode** art_child_slots(ArtNode* node, size_t& capacity) {
+            switch (node->type) {
+                case ArtType::node4:
+                    capacity = ArtNode4::kCapacity;
+                    return static_cast<ArtNode4*>(node)->children;
+                case ArtType::node16:
+                    capacity = ArtNode16::kCapacity;
+                    return static_cast<ArtNode16*>(node)->children;
+                case ArtType::node48:
+                    capacity = ArtNode48::kCapacity;
+                    return static_cast<ArtNode48*>(node)->children;
+                default:
+                    capacity = ArtNode256::kCapacity;
+                    return static_cast<ArtNode256*>(node)->children;
+            }
+        }
+
+        // 有序数组中在 pos 处插入一个键和子节点
+        inline void art_insert_at(unsigned char* keys, ArtNode** children, size_t count, size_t pos, unsigned char byte,
+                                  ArtNode* child) {
+            std::memmove(keys + pos + 1, keys + pos, count - pos);
+            std::memmove(children + pos + 1, children + pos, (count - pos) * sizeof(ArtNode*));
+            keys[pos] = byte;
+            children[pos] = child;
+        }
+
+        inline void art_erase_at(unsigned char* keys, ArtNode** children, size_t count, size_t pos) {
+            std::memmove(keys + pos, keys + pos + 1, count - pos - 1);
+            std::memmove(children + pos, children + pos + 1, (count - pos - 1) * sizeof(ArtNode*));
+            keys[count - 1] = 0;
+            children[count - 1] = nullptr;
+        }
+    }
+
+    // 字符串键的自适应基数树（ART）。内部节点按子节点数在 4/16/48/256 四种布局间切换，
+    // 只有一个子节点的路径压缩进节点前缀；16 路节点用 SSE2 一次比较全部键字节。
+    // 键按字节（无符号）字典序排列，与 std::string 的比较一致；键可以互为前缀
+    template <typename V, typename Alloc = std::allocator<V>>
+    class Trie {
+    private:
+        using ArtNode = detail::ArtNode;
+        using ArtType = detail::ArtType;
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        // 叶子后面紧跟键的字节
+        struct Leaf {
+            V value;
+            size_t length;
+
+            const unsigned char* bytes() const {
+                return reinterpret_cast<const unsigned char*>(this + 1);
+            }
+
+            std::string_view key() const {
+                return std::string_view(reinterpret_cast<const char*>(this + 1), length);
+            }
+        };
+
+        using leaf_unit = std::aligned_storage_t<sizeof(Leaf), alignof(Leaf)>;
+
+        ArtNode* root_;
+        size_t size_;
+        size_t memory_;
+        Alloc alloc_;
+
+    private:
+        static const unsigned char* bytes_of(std::string_view key) {
+            return reinterpret_cast<const unsigned char*>(key.data());
+        }
+
+        static bool is_leaf(const ArtNode* ref) {
+            return (reinterpret_cast<uintptr_t>(ref) & 1) != 0;
+        }
+
+        static Leaf* as_leaf(const ArtNode* ref) {
+            return reinterpret_cast<Leaf*>(reinterpret_cast<uintptr_t>(ref) & ~uintptr_t(1));
+        }
+
+        static ArtNode* tag(Leaf* leaf) {
+            return reinterpret_cast<ArtNode*>(reinterpret_cast<uintptr_t>(leaf) | 1);
+        }
+
+        static Leaf* terminal(const ArtNode* node) {
+            return static_cast<Leaf*>(node->terminal);
+        }
+
+        static bool leaf_matches(const Leaf* leaf, std::string_view key) {
+            return leaf->key() == key;
+        }
+
+        static bool leaf_starts_with(const Leaf* leaf, std::string_view prefix) {
+            return leaf->key().substr(0, prefix.size()) == prefix;
+        }
+
+        // 子树中任意一个叶子，它的键包含到达该子树的完整路径
+        static const Leaf* any_leaf(const ArtNode* ref) {
+            while (!is_leaf(ref)) {
+                if (ref->terminal != nullptr) return terminal(ref);
+                ArtNode* first = nullptr;
+                detail::art_for_each_child(const_cast<ArtNode*>(ref), [&](unsigned char, ArtNode* child) {
+                    if (first == nullptr) first = child;
+                });
+                ref = first;
+            }
+            return as_leaf(ref);
+        }
+
+        static void set_prefix(ArtNode* node, const unsigned char* bytes, size_t length) {
+            node->prefix_length = static_cast<uint32_t>(length);
+            std::memmove(node->prefix, bytes, std::min(length, detail::kArtPrefix));
+        }
+
+        template <typename NodeT>
+        NodeT* new_node() {
+            using node_alloc_type = typename alloc_traits::template rebind_alloc<NodeT>;
+            node_alloc_type alloc(alloc_);
+            NodeT* node = std::allocator_traits<node_alloc_type>::allocate(alloc, 1);
+            ::new (static_cast<void*>(node)) NodeT();
+            node->type = NodeT::kType;
+            memory_ += sizeof(NodeT);
+            return node;
+        }
+
+        template <typename NodeT>
+        void delete_node(NodeT* node) {
+            using node_alloc_type = typename alloc_traits::template rebind_alloc<NodeT>;
+            node_alloc_type alloc(alloc_);
+            std::allocator_traits<node_alloc_type>::deallocate(alloc, node, 1);
+            memory_ -= sizeof(NodeT);
+        }
+
+        void free_node(ArtNode* node) {
+            switch (node->type) {
+                case ArtType::node4:
+                    delete_node(static_cast<detail::ArtNode4*>(node));
+                    break;
+                case ArtType::node16:
+                    delete_node(static_cast<detail::ArtNode16*>(node));
+                    break;
+                case ArtType::node48:
+                    delete_node(static_cast<detail::ArtNode48*>(node));
+                    break;
+                default:
+                    delete_node(static_cast<detail::ArtNode256*>(node));
+            }
+        }
+
+        // 与 node 同类型的空节点，复制头部与键数组，子节点与 terminal 置空
+        ArtNode* new_node_like(const ArtNode* node) {
+            switch (node->type) {
+                case ArtType::node4: {
+                    auto* copy = new_node<detail::ArtNode4>();
+                    std::memcpy(copy->keys, static_cast<const detail::ArtNode4*>(node)->keys, sizeof(copy->keys));
+                    return copy_header(copy, node);
+                }
+                case ArtType::node16: {
+                    auto* copy = new_node<detail::ArtNode16>();
+                    std::memcpy(copy->keys, static_cast<const detail::ArtNode16*>(node)->keys, sizeof(copy->keys));
+                    return copy_header(copy, node);
+                }
+                case ArtType::node48: {
+                    auto* copy = new_node<detail::ArtNode48>();
+                    std::memcpy(copy->index, static_cast<const detail::ArtNode48*>(node)->index, sizeof(copy->index));
+                    return copy_header(copy, node);
+                }
+                default:
+                    return copy_header(new_node<detail::ArtNode256>(), node);
+            }
+        }
+
+        static ArtNode* copy_header(ArtNode* copy, const ArtNode* node) {
+            copy->count = node->count;
+            copy->prefix_length = node->prefix_length;
+            std::memcpy(copy->prefix, node->prefix, detail::kArtPrefix);
+            return copy;
+        }
+
+        static size_t leaf_units(size_t length) {
+            return 1 + (length + sizeof(Leaf) - 1) / sizeof(Leaf);
+        }
+
+        template <typename... Args>
+        Leaf* new_leaf(std::string_view key, Args&&... args) {
+            using leaf_alloc_type = typename alloc_traits::template rebind_alloc<leaf_unit>;
+            leaf_alloc_type alloc(alloc_);
+            size_t units = leaf_units(key.size());
+            leaf_unit* raw = std::allocator_traits<leaf_alloc_type>::allocate(alloc, units);
+            Leaf* leaf;
+            try {
+                leaf = ::new (static_cast<void*>(raw)) Leaf{V(std::forward<Args>(args)...), key.size()};
+            } catch (...) {
+                std::allocator_traits<leaf_alloc_type>::deallocate(alloc, raw, units);
+                throw;
+            }
+            if (!key.empty()) std::memcpy(reinterpret_cast<unsigned char*>(leaf + 1), key.data(), key.size());
+            memory_ += units * sizeof(Leaf);
+            return leaf;
+        }
+
+        void free_leaf(Leaf* leaf) {
+            using leaf_alloc_type = typename alloc_traits::template rebind_alloc<leaf_unit>;
+            leaf_alloc_type alloc(alloc_);
+            size_t units = leaf_units(leaf->length);
+            leaf->~Leaf();
+            std::allocator_traits<leaf_alloc_type>::deallocate(alloc, reinterpret_cast<leaf_unit*>(leaf), units);
+            memory_ -= units * sizeof(Leaf);
+        }
+
+        void destroy(ArtNode* ref) {
+            if (ref == nullptr) return;
+            if (is_leaf(ref)) {
+                free_leaf(as_leaf(ref));
+                return;
+            }
+            size_t capacity;
+            ArtNode** children = detail::art_child_slots(ref, capacity);
+            for (size_t i = 0; i < capacity; i++) {
+                destroy(children[i]);
+            }
+            if (ref->terminal != nullptr) free_leaf(terminal(ref));
+            free_node(ref);
+        }
+
+        ArtNode* clone(const ArtNode* ref) {
+            if (is_leaf(ref)) {
+                const Leaf* leaf = as_leaf(ref);
+                return tag(new_leaf(leaf->key(), leaf->value));
+            }
+            ArtNode* copy = new_node_like(ref);
+            try {
+                if (ref->terminal != nullptr) copy->terminal = new_leaf(terminal(ref)->key(), terminal(ref)->value);
+                size_t capacity;
+                ArtNode** from = detail::art_child_slots(const_cast<ArtNode*>(ref), capacity);
+                ArtNode** to = detail::art_child_slots(copy, capacity);
+                for (size_t i = 0; i < capacity; i++) {
+                    if (from[i] != nullptr) to[i] = clone(from[i]);
+                }
+            } catch (...) {
+                destroy(copy);
+                throw;
+            }
+            return copy;
+        }
+
+        // 键与 node 压缩前缀的公共长度；key 在前缀中途结束时返回剩余长度
+        size_t prefix_mismatch(const ArtNode* node, const unsigned char* bytes, size_t size, size_t depth) const {
+            size_t length = node->prefix_length;
+            size_t limit = std::min(length, size - depth);
+            size_t stored = std::min(limit, detail::kArtPrefix);
+            size_t i = 0;
+            for (; i < stored; i++) {
+                if (node->prefix[i] != bytes[depth + i]) return i;
+            }
+            if (length > detail::kArtPrefix) {
+                const unsigned char* full = any_leaf(node)->bytes() + depth;
+                for (; i < limit; i++) {
+                    if (full[i] != bytes[depth + i]) return i;
+                }
+            }
+            return limit;
+        }
+
+        // 把叶子挂到刚创建、尚有空位的 Node4 上：键在 depth 处结束则作为 terminal
+        static void attach(detail::ArtNode4* node, Leaf* leaf, size_t depth) {
+            if (leaf->length == depth) {
+                node->terminal = leaf;
+            } else {
+                add_to_node4(node, leaf->bytes()[depth], tag(leaf));
+            }
+        }
+
+        static void add_to_node4(detail::ArtNode4* node, unsigned char byte, ArtNode* child) {
+            size_t pos = 0;
+            while (pos < node->count && node->keys[pos] < byte) pos++;
+            detail::art_insert_at(node->keys, node->children, node->count, pos, byte, child);
+            node->count++;
+        }
+
+        // 在 *slot 指向的节点中加入子节点，节点已满时换成更大的类型
+        void add_child(ArtNode** slot, unsigned char byte, ArtNode* child) {
+            ArtNode* node = *slot;
+            switch (node->type) {
+                case ArtType::node4: {
+                    auto* n = static_cast<detail::ArtNode4*>(node);
+                    if (n->count < 4) {
+                        add_to_node4(n, byte, child);
+                        return;
+                    }
+                    auto* bigger = new_node<detail::ArtNode16>();
+                    copy_header(bigger, n);
+                    bigger->terminal = n->terminal;
+                    std::memcpy(bigger->keys, n->keys, 4);
+                    std::memcpy(bigger->children, n->children, 4 * sizeof(ArtNode*));
+                    *slot = bigger;
+                    free_node(n);
+                    add_child(slot, byte, child);
+                    return;
+                }
+                case ArtType::node16: {
+                    auto* n = static_cast<detail::ArtNode16*>(node);
+                    if (n->count < 16) {
+                        size_t pos = detail::art_lower_bound16(n->keys, n->count, byte);
+                        detail::art_insert_at(n->keys, n->children, n->count, pos, byte, child);
+                        n->count++;
+                        return;
+                    }
+                    auto* bigger = new_node<detail::ArtNode48>();
+                    copy_header(bigger, n);
+                    bigger->terminal = n->terminal;
+                    for (size_t i = 0; i < 16; i++) {
+                        bigger->index[n->keys[i]] = static_cast<uint8_t>(i + 1);
+                        bigger->children[i] = n->children[i];
+                    }
+                    *slot = bigger;
+                    free_node(n);
+                    add_child(slot, byte, child);
+                    return;
+                }
+                case ArtType::node48: {
+                    auto* n = static_cast<detail::ArtNode48*>(node);
+                    if (n->count < 48) {
+                        size_t free = 0;
+                        while (n->children[free] != nullptr) free++;
+                        n->children[free] = child;
+                        n->index[byte] = static_cast<uint8_t>(free + 1);
+                        n->count++;
+                        return;
+                    }
+                    auto* bigger = new_node<detail::ArtNode256>();
+                    copy_header(bigger, n);
+                    bigger->terminal = n->terminal;
+                    for (size_t b = 0; b < 256; b++) {
+                        if (n->index[b] != 0) bigger->children[b] = n->children[n->index[b] - 1];
+                    }
+                    *slot = bigger;
+                    free_node(n);
+                    add_child(slot, byte, child);
+                    return;
+                }
+                default: {
+                    auto* n = static_cast<detail::ArtNode256*>(node);
+                    n->children[byte] = child;
+                    n->count++;
+                }
+            }
+        }
+
+        // 删除 byte 对应的子节点，子节点明显变少时换成更小的类型（留有余量，避免在边界反复切换）
+        void remove_child(ArtNode** slot, unsigned char byte) {
+            ArtNode* node = *slot;
+            switch (node->type) {
+                case ArtType::node4: {
+                    auto* n = static_cast<detail::ArtNode4*>(node);
+                    size_t pos = 0;
+                    while (n->keys[pos] != byte) pos++;
+                    detail::art_erase_at(n->keys, n->children, n->count, pos);
+                    n->count--;
+                    return;
+                }
+                case ArtType::node16: {
+                    auto* n = static_cast<detail::ArtNode16*>(node);
+                    detail::art_erase_at(n->keys, n->children, n->count, detail::art_find_key16(n->keys, n->count, byte));
+                    n->count--;
+                    if (n->count <= 2) shrink(slot);
+                    return;
+                }
+                case ArtType::node48: {
+                    auto* n = static_cast<detail::ArtNode48*>(node);
+                    n->children[n->index[byte] - 1] = nullptr;
+                    n->index[byte] = 0;
+                    n->count--;
+                    if (n->count <= 12) shrink(slot);
+                    return;
+                }
+                default: {
+                    auto* n = static_cast<detail::ArtNode256*>(node);
+                    n->children[byte] = nullptr;
+                    n->count--;
+                    if (n->count <= 40) shrink(slot);
+                }
+            }
+        }
+
+        // 换成小一级的节点类型。删除不应因内存不足而失败，分配失败时保留原节点
+        void shrink(ArtNode** slot) {
+            ArtNode* node = *slot;
+            ArtNode* smaller;
+            try {
+                switch (node->type) {
+                    case ArtType::node16: {
+                        auto* n = static_cast<detail::ArtNode16*>(node);
+                        auto* s = new_node<detail::ArtNode4>();
+                        std::memcpy(s->keys, n->keys, n->count);
+                        std::memcpy(s->children, n->children, n->count * sizeof(ArtNode*));
+                        smaller = s;
+                        break;
+                    }
+                    case ArtType::node48: {
+                        auto* n = static_cast<detail::ArtNode48*>(node);
+                        auto* s = new_node<detail::ArtNode16>();
+                        size_t count = 0;
+                        for (size_t b = 0; b < 256; b++) {
+                            if (n->index[b] == 0) continue;
+                            s->keys[count] = static_cast<unsigned char>(b);
+                            s->children[count++] = n->children[n->index[b] - 1];
+                        }
+                        smaller = s;
+                        break;
+                    }
+                    default: {
+                        auto* n = static_cast<detail::ArtNode256*>(node);
+                        auto* s = new_node<detail::ArtNode48>();
+                        size_t count = 0;
+                        for (size_t b = 0; b < 256; b++) {
+                            if (n->children[b] == nullptr) continue;
+                            s->index[b] = static_cast<uint8_t>(count + 1);
+                            s->children[count++] = n->children[b];
+                        }
+                        smaller = s;
+                    }
+                }
+            } catch (...) {
+                return;
+            }
+            copy_header(smaller, node);
+            smaller->terminal = node->terminal;
+            *slot = smaller;
+            free_node(node);
+        }
+
+        // 删除后恢复不变式：内部节点至少有两项（子节点或 terminal），否则与唯一的一项合并
+        void collapse(ArtNode** slot) {
+            ArtNode* node = *slot;
+            if (node->count == 0) {
+                *slot = tag(terminal(node));
+                free_node(node);
+                return;
+            }
+            if (node->count != 1 || node->terminal != nullptr) return;
+
+            unsigned char byte = 0;
+            ArtNode* child = nullptr;
+            detail::art_for_each_child(node, [&](unsigned char b, ArtNode* c) {
+                byte = b;
+                child = c;
+            });
+            if (!is_leaf(child)) {
+                // 合并后的前缀：本节点前缀 + 边上的字节 + 子节点前缀，只保存前 kArtPrefix 字节
+                unsigned char merged[detail::kArtPrefix];
+                size_t stored = std::min<size_t>(node->prefix_length, detail::kArtPrefix);
+                std::memcpy(merged, node->prefix, stored);
+                if (stored < detail::kArtPrefix) merged[stored++] = byte;
+                size_t rest = std::min<size_t>(child->prefix_length, detail::kArtPrefix - stored);
+                std::memcpy(merged + stored, child->prefix, rest);
+                child->prefix_length = node->prefix_length + 1 + child->prefix_length;
+                std::memcpy(child->prefix, merged, stored + rest);
+            }
+            *slot = child;
+            free_node(node);
+        }
+
+        Leaf* find_leaf(std::string_view key) const {
+            const unsigned char* bytes = bytes_of(key);
+            size_t size = key.size();
+            ArtNode* ref = root_;
+            size_t depth = 0;
+            while (ref != nullptr) {
+                if (is_leaf(ref)) {
+                    Leaf* leaf = as_leaf(ref);
+                    return leaf_matches(leaf, key) ? leaf : nullptr;
+                }
+                if (ref->prefix_length != 0) {
+                    if (size - depth < ref->prefix_length) return nullptr;
+                    size_t stored = std::min<size_t>(ref->prefix_length, detail::kArtPrefix);
+                    if (std::memcmp(ref->prefix, bytes + depth, stored) != 0) return nullptr;
+                    depth += ref->prefix_length;
+                }
+                if (depth == size) {
+                    Leaf* leaf = terminal(ref);
+                    return leaf != nullptr && leaf_matches(leaf, key) ? leaf : nullptr;
+                }
+                ArtNode** child = detail::art_find_child(ref, bytes[depth]);
+                if (child == nullptr) return nullptr;
+                ref = *child;
+                depth++;
+            }
+            return nullptr;
+        }
+
+        // 插入键，已存在时返回已有叶子。新叶子先分配好再修改树，分配失败时树保持不变
+        template <typename... Args>
+        std::pair<Leaf*, bool> emplace_leaf(std::string_view key, Args&&... args) {
+            const unsigned char* bytes = bytes_of(key);
+            size_t size = key.size();
+            ArtNode** slot = &root_;
+            size_t depth = 0;
+            for (;;) {
+                ArtNode* ref = *slot;
+                if (ref == nullptr) {
+                    Leaf* leaf = new_leaf(key, std::forward<Args>(args)...);
+                    *slot = tag(leaf);
+                    size_++;
+                    return {leaf, true};
+                }
+
+                if (is_leaf(ref)) {
+                    Leaf* existing = as_leaf(ref);
+                    if (leaf_matches(existing, key)) return {existing, false};
+                    // 两个键在 depth 之后的公共部分成为新节点的压缩前缀
+                    size_t limit = std::min(existing->length, size);
+                    size_t end = depth;
+                    while (end < limit && existing->bytes()[end] == bytes[end]) end++;
+                    Leaf* leaf = new_leaf(key, std::forward<Args>(args)...);
+                    detail::ArtNode4* node;
+                    try {
+                        node = new_node<detail::ArtNode4>();
+                    } catch (...) {
+                        free_leaf(leaf);
+                        throw;
+                    }
+                    set_prefix(node, bytes + depth, end - depth);
+                    attach(node, existing, end);
+                    attach(node, leaf, end);
+                    *slot = node;
+                    size_++;
+                    return {leaf, true};
+                }
+
+                if (ref->prefix_length != 0) {
+                    size_t mismatch = prefix_mismatch(ref, bytes, size, depth);
+                    if (mismatch < ref->prefix_length) {
+                        Leaf* leaf = new_leaf(key, std::forward<Args>(args)...);
+                        detail::ArtNode4* parent;
+                        try {
+                            parent = new_node<detail::ArtNode4>();
+                        } catch (...) {
+                            free_leaf(leaf);
+                            throw;
+                        }
+                        split_prefix(ref, parent, depth, mismatch);
+                        attach(parent, leaf, depth + mismatch);
+                        *slot = parent;
+                        size_++;
+                        return {leaf, true};
+                    }
+                    depth += ref->prefix_length;
+                }
+
+                if (depth == size) {
+                    if (ref->terminal != nullptr) return {terminal(ref), false};
+                    Leaf* leaf = new_leaf(key, std::forward<Args>(args)...);
+                    ref->terminal = leaf;
+                    size_++;
+                    return {leaf, true};
+                }
+
+                ArtNode** child = detail::art_find_child(ref, bytes[depth]);
+                if (child != nullptr) {
+                    slot = child;
+                    depth++;
+                    continue;
+                }
+                Leaf* leaf = new_leaf(key, std::forward<Args>(args)...);
+                try {
+                    add_child(slot, bytes[depth], tag(leaf));
+                } catch (...) {
+                    free_leaf(leaf);
+                    throw;
+                }
+                size_++;
+                return {leaf, true};
+            }
+        }
+
+        // node 的压缩前缀在 mismatch 处分叉：前 mismatch 字节移到 parent，node 经由下一个字节挂在 parent 下
+        void split_prefix(ArtNode* node, detail::ArtNode4* parent, size_t depth, size_t mismatch) {
+            set_prefix(parent, node->prefix, mismatch);
+            const unsigned char* full =
+                node->prefix_length <= detail::kArtPrefix ? node->prefix : any_leaf(node)->bytes() + depth;
+            unsigned char byte = full[mismatch];
+            set_prefix(node, full + mismatch + 1, node->prefix_length - mismatch - 1);
+            add_to_node4(parent, byte, node);
+        }
+
+        bool erase_at(ArtNode** slot, std::string_view key, size_t depth) {
+            ArtNode* ref = *slot;
+            if (ref == nullptr) return false;
+            if (is_leaf(ref)) {
+                if (!leaf_matches(as_leaf(ref), key)) return false;
+                free_leaf(as_leaf(ref));
+                *slot = nullptr;
+                return true;
+            }
+
+            const unsigned char* bytes = bytes_of(key);
+            if (ref->prefix_length != 0) {
+                if (key.size() - depth < ref->prefix_length) return false;
+                size_t stored = std::min<size_t>(ref->prefix_length, detail::kArtPrefix);
+                if (std::memcmp(ref->prefix, bytes + depth, stored) != 0) return false;
+                depth += ref->prefix_length;
+            }
+
+            if (depth == key.size()) {
+                Leaf* leaf = terminal(ref);
+                if (leaf == nullptr || !leaf_matches(leaf, key)) return false;
+                free_leaf(leaf);
+                ref->terminal = nullptr;
+            } else {
+                ArtNode** child = detail::art_find_child(ref, bytes[depth]);
+                if (child == nullptr || !erase_at(child, key, depth + 1)) return false;
+                if (*child == nullptr) remove_child(slot, bytes[depth]);
+            }
+            collapse(slot);
+            return true;
+        }
+
+        // 按键序访问子树：先是在本节点结束的键，再按字节顺序访问子节点
+        template <typename Fn>
+        static void visit(ArtNode* ref, Fn& fn) {
+            if (is_leaf(ref)) {
+                fn(as_leaf(ref));
+                return;
+            }
+            if (ref->terminal != nullptr) fn(terminal(ref));
+            detail::art_for_each_child(ref, [&](unsigned char, ArtNode* child) { visit(child, fn); });
+        }
+
+        // 找到全部以 prefix 开头的键所在的子树，没有时返回 nullptr
+        ArtNode* prefix_subtree(std::string_view prefix) const {
+            const unsigned char* bytes = bytes_of(prefix);
+            ArtNode* ref = root_;
+            size_t depth = 0;
+            while (ref != nullptr) {
+                if (is_leaf(ref)) return leaf_starts_with(as_leaf(ref), prefix) ? ref : nullptr;
+                if (depth + ref->prefix_length >= prefix.size()) {
+                    // prefix 在本节点的压缩路径内结束：子树中的键要么全部匹配，要么全不匹配
+                    return leaf_starts_with(any_leaf(ref), prefix) ? ref : nullptr;
+                }
+                size_t stored = std::min<size_t>(ref->prefix_length, detail::kArtPrefix);
+                if (std::memcmp(ref->prefix, bytes + depth, stored) != 0) return nullptr;
+                depth += ref->prefix_length;
+                ArtNode** child = detail::art_find_child(ref, bytes[depth]);
+                if (child == nullptr) return nullptr;
+                ref = *child;
+                depth++;
+            }
+            return nullptr;
+        }
+
+        void steal(Trie& other) {
+            root_ = other.root_;
+            size_ = other.size_;
+            memory_ = other.memory_;
+            other.root_ = nullptr;
+            other.size_ = 0;
+            other.memory_ = 0;
+        }
+
+        // 检查节点计数、键的顺序，以及每个子树的键都经过到达它的路径；返回子树中的键数
+        size_t validate_node(const ArtNode* ref, size_t depth, const Leaf* parent_leaf, bool& ok) const {
+            if (is_leaf(ref)) {
+                const Leaf* leaf = as_leaf(ref);
+                if (parent_leaf != nullptr && std::memcmp(leaf->bytes(), parent_leaf->bytes(), depth) != 0) ok = false;
+                if (leaf->length < depth) ok = false;
+                return 1;
+            }
+            const Leaf* witness = any_leaf(ref);
+            size_t end = depth + ref->prefix_length;
+            if (witness->length < end ||
+                std::memcmp(ref->prefix, witness->bytes() + depth,
+                            std::min<size_t>(ref->prefix_length, detail::kArtPrefix)) != 0 ||
+                (parent_leaf != nullptr && std::memcmp(witness->bytes(), parent_leaf->bytes(), depth) != 0)) {
+                ok = false;
+                return 0;
+            }
+
+            size_t keys = 0;
+            if (ref->terminal != nullptr) {
+                if (terminal(ref)->length != end || std::memcmp(terminal(ref)->bytes(), witness->bytes(), end) != 0) {
+                    ok = false;
+                }
+                keys++;
+            }
+            size_t children = 0;
+            int previous = -1;
+            detail::art_for_each_child(const_cast<ArtNode*>(ref), [&](unsigned char byte, ArtNode* child) {
+                if (static_cast<int>(byte) <= previous) ok = false;
+                previous = byte;
+                children++;
+                // 子树的代表叶子与本节点的路径一致，子树内部再与这个代表叶子比较
+                const Leaf* leaf = any_leaf(child);
+                if (leaf->length <= end || leaf->bytes()[end] != byte ||
+                    std::memcmp(leaf->bytes(), witness->bytes(), end) != 0) {
+                    ok = false;
+                    return;
+                }
+                keys += validate_node(child, end + 1, leaf, ok);
+            });
+            size_t capacity;
+            ArtNode** slots = detail::art_child_slots(const_cast<ArtNode*>(ref), capacity);
+            size_t used = static_cast<size_t>(std::count_if(slots, slots + capacity, [](ArtNode* c) { return c != nullptr; }));
+            if (children != ref->count || used != ref->count || children + (ref->terminal != nullptr) < 2) ok = false;
+            return keys;
+        }
+
+    public:
+        using mapped_type = V;
+        using size_type = size_t;
+        using allocator_type = Alloc;
+
+        explicit Trie(const Alloc& alloc = Alloc()) : root_(nullptr), size_(0), memory_(0), alloc_(alloc) {}
+
+        Trie(const Trie& other)
+            : Trie(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+            if (other.root_ != nullptr) root_ = clone(other.root_);
+            size_ = other.size_;
+        }
+
+        Trie(Trie&& other) : Trie(other.alloc_) {
+            steal(other);
+        }
+
+        ~Trie() {
+            destroy(root_);
+        }
+
+        Trie& operator=(const Trie& other) {
+            if (this == &other) return *this;
+            clear();
+            if (other.root_ != nullptr) root_ = clone(other.root_);
+            size_ = other.size_;
+            return *this;
+        }
+
+        // 不传播分配器；分配器不相等时复制全部键值
+        Trie& operator=(Trie&& other) {
+            if (this == &other) return *this;
+            clear();
+            if (alloc_ == other.alloc_) {
+                steal(other);
+            } else {
+                if (other.root_ != nullptr) root_ = clone(other.root_);
+                size_ = other.size_;
+                other.clear();
+            }
+            return *this;
+        }
+
+        Alloc get_allocator() const {
+            return alloc_;
+        }
+
+        // 键已存在时不修改，返回已有的值
+        std::pair<V*, bool> insert(std::string_view key, const V& value) {
+            auto result = emplace_leaf(key, value);
+            return {&result.first->value, result.second};
+        }
+
+        std::pair<V*, bool> insert(std::string_view key, V&& value) {
+            auto result = emplace_leaf(key, std::move(value));
+            return {&result.first->value, result.second};
+        }
+
+        template <typename M>
+        std::pair<V*, bool> insert_or_assign(std::string_view key, M&& value) {
+            auto result = emplace_leaf(key, std::forward<M>(value));
+            if (!result.second) result.first->value = std::forward<M>(value);
+            return {&result.first->value, result.second};
+        }
+
+        V& operator[](std::string_view key) {
+            return emplace_leaf(key).first->value;
+        }
+
+        V* find(std::string_view key) {
+            Leaf* leaf = find_leaf(key);
+            return leaf != nullptr ? &leaf->value : nullptr;
+        }
+
+        const V* find(std::string_view key) const {
+            const Leaf* leaf = find_leaf(key);
+            return leaf != nullptr ? &leaf->value : nullptr;
+        }
+
+        bool contains(std::string_view key) const {
+            return find_leaf(key) != nullptr;
+        }
+
+        V& at(std::string_view key) {
+            V* value = find(key);
+            if (value == nullptr) throw std::out_of_range("Key not found");
+            return *value;
+        }
+
+        const V& at(std::string_view key) const {
+            const V* value = find(key);
+            if (value == nullptr) throw std::out_of_range("Key not found");
+            return *value;
+        }
+
+        // 最长前缀匹配：返回作为 key 前缀的最长键及其值，没有时值为 nullptr
+        std::pair<std::string_view, V*> longest_prefix(std::string_view key) const {
+            const unsigned char* bytes = bytes_of(key);
+            size_t size = key.size();
+            // 沿途经过的候选键，由浅到深；跳过的前缀字节未经比较，最后统一用一个叶子核对
+            Linear::SmallVector<Leaf*, 16> candidates;
+            const Leaf* probe = nullptr;
+            ArtNode* ref = root_;
+            size_t depth = 0;
+            while (ref != nullptr) {
+                if (is_leaf(ref)) {
+                    probe = as_leaf(ref);
+                    if (probe->length <= size) candidates.push_back(as_leaf(ref));
+                    break;
+                }
+                if (ref->prefix_length != 0) {
+                    size_t stored = std::min<size_t>(ref->prefix_length, detail::kArtPrefix);
+                    if (size - depth < ref->prefix_length || std::memcmp(ref->prefix, bytes + depth, stored) != 0) {
+                        probe = any_leaf(ref);
+                        break;
+                    }
+                    depth += ref->prefix_length;
+                }
+                if (ref->terminal != nullptr) candidates.push_back(terminal(ref));
+                ArtNode** child = depth < size ? detail::art_find_child(ref, bytes[depth]) : nullptr;
+                if (child == nullptr) {
+                    probe = any_leaf(ref);
+                    break;
+                }
+                ref = *child;
+                depth++;
+            }
+            if (probe == nullptr || candidates.size() == 0) return {std::string_view(), nullptr};
+
+            // 候选键都是 probe 的前缀，只需知道 probe 与 key 的公共长度
+            size_t limit = std::min(probe->length, size);
+            size_t common = 0;
+            while (common < limit && probe->bytes()[common] == bytes[common]) common++;
+            for (size_t i = candidates.size(); i-- > 0;) {
+                if (candidates[i]->length <= common) return {candidates[i]->key(), &candidates[i]->value};
+            }
+            return {std::string_view(), nullptr};
+        }
+
+        // 按键序对每个以 prefix 开头的键调用 fn(key, value)
+        template <typename Fn>
+        void scan_prefix(std::string_view prefix, Fn fn) {
+            ArtNode* subtree = prefix_subtree(prefix);
+            if (subtree == nullptr) return;
+            auto call = [&](Leaf* leaf) { fn(leaf->key(), leaf->value); };
+            visit(subtree, call);
+        }
+
+        template <typename Fn>
+        void scan_prefix(std::string_view prefix, Fn fn) const {
+            ArtNode* subtree = prefix_subtree(prefix);
+            if (subtree == nullptr) return;
+            auto call = [&](const Leaf* leaf) { fn(leaf->key(), static_cast<const V&>(leaf->value)); };
+            visit(subtree, call);
+        }
+
+        // 按键序对全部元素调用 fn(key, value)
+        template <typename Fn>
+        void for_each(Fn fn) {
+            scan_prefix(std::string_view(), fn);
+        }
+
+        template <typename Fn>
+        void for_each(Fn fn) const {
+            scan_prefix(std::string_view(), fn);
+        }
+
+        // 返回删除的元素个数（0 或 1）
+        size_t erase(std::string_view key) {
+            if (!erase_at(&root_, key, 0)) return 0;
+            size_--;
+            return 1;
+        }
+
+        void clear() {
+            destroy(root_);
+            root_ = nullptr;
+            size_ = 0;
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        // 节点与叶子（含键字节）占用的字节数
+        size_t memory_usage() const {
+            return memory_;
+        }
+
+        bool validate() const {
+            if (root_ == nullptr) return size_ == 0;
+            bool ok = true;
+            size_t keys = validate_node(root_, 0, nullptr, ok);
+            return ok && keys == size_;
+        }
+    };
+
+    // ------------------------- 静态字典 -------------------------
+
+    namespace detail {
+        inline constexpr uint64_t kFrozenOnes8 = 0x0101010101010101ull;
+        inline constexpr uint64_t kFrozenHighs8 = 0x8080808080808080ull;
+
+        // 每个字节中 1 的个数
+        inline uint64_t frozen_byte_counts(uint64_t word) {
+            word = word - ((word >> 1) & 0x5555555555555555ull);
+            word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+            return (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        }
+
+        // 没有 POPCNT 指令时 __builtin_popcountll 会变成库函数调用，改用内联的逐字节计数
+        inline unsigned frozen_popcount(uint64_t word) {
+#if defined(__POPCNT__)
+            return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+            return static_cast<unsigned>((frozen_byte_counts(word) * kFrozenOnes8) >> 56);
+#endif
+        }
+
+        // word 不能为 0
+        inline unsigned frozen_ctz(uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+        }
+
+        // word 中第 rank 个（从 0 计）为 1 的位，调用方保证它存在。先用字节前缀和并行比较定位字节，
+        // 再在字节内逐位清除
+        inline unsigned frozen_select_in_word(uint64_t word, unsigned rank) {
+            uint64_t sums = frozen_byte_counts(word) * kFrozenOnes8;
+            // 字节 i 的前缀和不超过 rank 时，该字节的最高位为 1
+            uint64_t below = ((rank * kFrozenOnes8) | kFrozenHighs8) - sums;
+            unsigned shift = static_cast<unsigned>((((below & kFrozenHighs8) >> 7) * kFrozenOnes8) >> 56) * 8;
+            rank -= static_cast<unsigned>(((sums << 8) >> shift) & 0xFF);
+            word >>= shift;
+            for (; rank > 0; rank--) word &= word - 1;
+            return shift + frozen_ctz(word);
+        }
+
+        // 镜像文件的校验和：4 路独立的乘法混合
+        inline uint64_t frozen_checksum(const uint64_t* words, size_t count) {
+            const uint64_t prime = 0x100000001B3ull;
+            uint64_t lanes[4] = {0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0x27D4EB2F165667C5ull};
+            for (size_t i = 0; i < count; i++) {
+                uint64_t& lane = lanes[i % 4];
+                lane = (lane ^ words[i]) * prime;
+                lane ^= lane >> 32;
+            }
+            uint64_t hash = count;
+            for (uint64_t lane : lanes) {
+                hash = (hash ^ lane) * prime;
+                hash ^= hash >> 29;
+            }
+            return hash;
+        }
+
+        // 只读位向量，数据本身不归它所有。ranks[b] 是前 b 个 512 位块中 1 的个数；
+        // samples[j] 是第 512j 个 0 所在的块，select0 从采样块向后跳块，再在块内逐字定位。
+        // 末尾不足一个字的填充位必须为 0
+        struct FrozenBits {
+            static constexpr size_t kBlockWords = 8;
+            static constexpr size_t kBlockBits = kBlockWords * 64;
+            static constexpr size_t kSampleRate = 512;
+
+            const uint64_t* words = nullptr;
+            const uint64_t* ranks = nullptr;
+            const uint64_t* samples = nullptr;
+            size_t bits = 0;
+
+            static size_t word_count(size_t bits) {
+                return (bits + 63) / 64;
+            }
+
+            static size_t rank_count(size_t bits) {
+                return (word_count(bits) + kBlockWords - 1) / kBlockWords + 1;
+            }
+
+            static size_t sample_count(size_t zeros) {
+                return zeros / kSampleRate + 1;
+            }
+
+            // 为 words 的前 bits 位生成 rank 目录，写入 rank_count(bits) 个字
+            static void build_ranks(const uint64_t* words, size_t bits, uint64_t* ranks) {
+                size_t count = word_count(bits);
+                uint64_t rank = 0;
+                for (size_t w = 0; w < count; w++) {
+                    if (w % kBlockWords == 0) ranks[w / kBlockWords] = rank;
+                    rank += frozen_popcount(words[w]);
+                }
+                ranks[rank_count(bits) - 1] = rank;
+            }
+
+            // 依赖已生成的 rank 目录，写入 sample_count(zeros) 个字
+            static void build_samples(const uint64_t* ranks, size_t bits, size_t zeros, uint64_t* samples) {
+                size_t blocks = rank_count(bits) - 1;
+                size_t block = 0;
+                for (size_t j = 0; j < sample_count(zeros); j++) {
+                    while (block + 1 < blocks && (block + 1) * kBlockBits - ranks[block + 1] <= j * kSampleRate) block++;
+                    samples[j] = block;
+                }
+            }
+
+            bool get(size_t pos) const {
+                return (words[pos / 64] >> (pos % 64)) & 1;
+            }
+
+            // [0, pos) 中 1 的个数
+            size_t rank1(size_t pos) const {
+                size_t block = pos / kBlockBits;
+                size_t rank = static_cast<size_t>(ranks[block]);
+                for (size_t w = block * kBlockWords; w < pos / 64; w++) rank += frozen_popcount(words[w]);
+                if (pos % 64 != 0) rank += frozen_popcount(words[pos / 64] & ((uint64_t(1) << (pos % 64)) - 1));
+                return rank;
+            }
+
+            // 第 rank 个（从 0 计）0 的位置，调用方保证它存在
+            size_t select0(size_t rank) const {
+                size_t blocks = rank_count(bits) - 1;
+                size_t block = static_cast<size_t>(samples[rank / kSampleRate]);
+                while (block + 1 < blocks && (block + 1) * kBlockBits - ranks[block + 1] <= rank) block++;
+                rank -= block * kBlockBits - static_cast<size_t>(ranks[block]);
+                for (size_t w = block * kBlockWords;; w++) {
+                    uint64_t zeros = ~words[w];
+                    unsigned count = frozen_popcount(zeros);
+                    if (rank < count) return w * 64 + frozen_select_in_word(zeros, static_cast<unsigned>(rank));
+                    rank -= count;
+                }
+            }
+
+            // pos 处或之后的第一个 0，调用方保证它存在
+            size_t next0(size_t pos) const {
+                size_t w = pos / 64;
+                uint64_t zeros = ~words[w] & (~uint64_t(0) << (pos % 64));
+                while (zeros == 0) zeros = ~words[++w];
+                return w * 64 + frozen_ctz(zeros);
+            }
+        };
+    }
+
+    // FrozenTrie 镜像的文件头，之后各段依次排列、均按 8 字节对齐，段的位置由计数推出。
+    // 镜像按本机字节序和值类型布局写出，只能由相同 V 的程序打开
+    struct FrozenTrieHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t value_size;
+        uint64_t size;        // 键数
+        uint64_t nodes;       // 节点数，空字典为 0
+        uint64_t tail_bytes;  // 尾部字节总数
+        uint64_t checksum;    // 文件头之后全部字的校验和
+    };
+
+    // 只读字典：由有序键一次性构建成紧凑的扁平镜像，之后不能修改。
+    // 树形用 LOUDS 位向量表示——按层序为每个节点写出“子节点数个 1 再加一个 0”，节点按层序编号，
+    // 第 e 个 1 对应的子节点编号为 e + 1，子节点的边字节按升序存放在 labels 中；
+    // 只剩一个键的子树不再展开，剩余字节整体存入尾部数组。每个节点约 11 位，
+    // 另加每键一个尾部偏移与值。内存中构建的镜像与文件逐字节相同，open 只映射文件、校验文件头，
+    // 不做任何解析，查询直接在映射上进行。V 必须可平凡复制
+    template <typename V>
+    class FrozenTrie {
+        static_assert(std::is_trivially_copyable_v<V>, "FrozenTrie stores values as raw bytes");
+        static_assert(alignof(V) <= alignof(uint64_t), "FrozenTrie aligns values to 8 bytes");
+
+    private:
+        using Bits = detail::FrozenBits;
+
+        // 小端序下为 "FROZTRI1"
+        static constexpr uint64_t kMagic = 0x314952545A4F5246ull;
+        static constexpr uint32_t kVersion = 1;
+        static constexpr size_t kHeaderWords = sizeof(FrozenTrieHeader) / sizeof(uint64_t);
+        static constexpr size_t kNone = static_cast<size_t>(-1);
+
+        static_assert(sizeof(FrozenTrieHeader) % sizeof(uint64_t) == 0, "header must be word aligned");
+
+        // 各段在镜像中的起始字号
+        struct Layout {
+            size_t louds;
+            size_t louds_ranks;
+            size_t louds_samples;
+            size_t terminal;
+            size_t terminal_ranks;
+            size_t labels;
+            size_t tail_offsets;
+            size_t tails;
+            size_t values;
+            size_t words;  // 镜像总字数
+        };
+
+        // 内存中构建的镜像存放在 image_，从文件打开时映射在 file_，两者至多一个非空
+        std::vector<uint64_t> image_;
+        MappedFile file_;
+        FrozenTrieHeader header_;
+        Bits louds_;     // 2 * nodes - 1 位
+        Bits terminal_;  // 每节点一位：有键恰好结束在此节点；按 rank 得到该键的序号
+        const unsigned char* labels_;   // 每节点一字节：从父节点到它的边，根节点不用
+        const uint64_t* tail_offsets_;  // size + 1 个，键 i 的尾部为 [tail_offsets_[i], tail_offsets_[i + 1])
+        const unsigned char* tails_;
+        const V* values_;
+
+        static size_t louds_bits(size_t nodes) {
+            return nodes == 0 ? 0 : 2 * nodes - 1;
+        }
+
+        static Layout layout(const FrozenTrieHeader& header) {
+            size_t nodes = static_cast<size_t>(header.nodes);
+            size_t size = static_cast<size_t>(header.size);
+            Layout at;
+            size_t next = kHeaderWords;
+            at.louds = next;
+            next += Bits::word_count(louds_bits(nodes));
+            at.louds_ranks = next;
+            next += Bits::rank_count(louds_bits(nodes));
+            at.louds_samples = next;
+            next += Bits::sample_count(nodes);
+            at.terminal = next;
+            next += Bits::word_count(nodes);
+            at.terminal_ranks = next;
+            next += Bits::rank_count(nodes);
+            at.labels = next;
+            next += (nodes + 7) / 8;
+            at.tail_offsets = next;
+            next += size + 1;
+            at.tails = next;
+            next += static_cast<size_t>(header.tail_bytes + 7) / 8;
+            at.values = next;
+            next += (size * sizeof(V) + 7) / 8;
+            at.words = next;
+            return at;
+        }
+
+        void reset() {
+            header_ = FrozenTrieHeader();
+            louds_ = Bits();
+            terminal_ = Bits();
+            labels_ = nullptr;
+            tail_offsets_ = nullptr;
+            tails_ = nullptr;
+            values_ = nullptr;
+        }
+
+        // 按 header_ 把各段指针指向 base 开始的镜像
+        void attach(const uint64_t* base) {
+            Layout at = layout(header_);
+            size_t nodes = static_cast<size_t>(header_.nodes);
+            louds_ = Bits{base + at.louds, base + at.louds_ranks, base + at.louds_samples, louds_bits(nodes)};
+            terminal_ = Bits{base + at.terminal, base + at.terminal_ranks, nullptr, nodes};
+            labels_ = reinterpret_cast<const unsigned char*>(base + at.labels);
+            tail_offsets_ = base + at.tail_offsets;
+            tails_ = reinterpret_cast<const unsigned char*>(base + at.tails);
+            values_ = reinterpret_cast<const V*>(base + at.values);
+        }
+
+        const uint64_t* base() const {
+            return file_.is_open() ? reinterpret_cast<const uint64_t*>(file_.data()) : image_.data();
+        }
+
+        void steal(FrozenTrie& other) {
+            image_ = std::move(other.image_);
+            file_ = std::move(other.file_);
+            header_ = other.header_;
+            louds_ = other.louds_;
+            terminal_ = other.terminal_;
+            labels_ = other.labels_;
+            tail_offsets_ = other.tail_offsets_;
+            tails_ = other.tails_;
+            values_ = other.values_;
+            other.image_.clear();
+            other.reset();
+        }
+
+        std::string_view tail(size_t index) const {
+            size_t begin = static_cast<size_t>(tail_offsets_[index]);
+            size_t end = static_cast<size_t>(tail_offsets_[index + 1]);
+            return std::string_view(reinterpret_cast<const char*>(tails_) + begin, end - begin);
+        }
+
+        // 节点的子节点编号连续，返回 {第一个子节点, 子节点数}
+        std::pair<size_t, size_t> children(size_t node) const {
+            size_t start = node == 0 ? 0 : louds_.select0(node - 1) + 1;
+            return {start - node + 1, louds_.next0(start) - start};
+        }
+
+        // 从 node 沿 byte 对应的边下行，start 是 node 的子节点列表在 LOUDS 中的起点；成功时更新两者
+        bool descend(size_t& node, size_t& start, unsigned char byte) const {
+            size_t end = louds_.next0(start);
+            size_t first = start - node + 1;
+            // 边字节升序，多数节点只有一两个子节点，顺序比较即可
+            for (size_t i = first, last = first + (end - start); i < last && labels_[i] <= byte; i++) {
+                if (labels_[i] == byte) {
+                    // 子节点 i 的列表紧跟在第 i - 1 个 0 之后
+                    start = louds_.select0(i - 1) + 1;
+                    node = i;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // 返回键的序号，不存在时返回 kNone
+        size_t find_index(std::string_view key) const {
+            if (header_.nodes == 0) return kNone;
+            size_t node = 0, start = 0;
+            for (size_t depth = 0;; depth++) {
+                if (terminal_.get(node)) {
+                    size_t index = terminal_.rank1(node);
+                    std::string_view rest = tail(index);
+                    if (rest == key.substr(depth)) return index;
+                    // 尾部非空的节点是叶子
+                    if (!rest.empty()) return kNone;
+                }
+                if (depth == key.size() || !descend(node, start, static_cast<unsigned char>(key[depth]))) return kNone;
+            }
+        }
+
+        // 以 key 为当前路径，按键序访问 node 的子树
+        template <typename Fn>
+        void visit(size_t node, std::string& key, Fn& fn) const {
+            if (terminal_.get(node)) {
+                size_t index = terminal_.rank1(node);
+                size_t length = key.size();
+                key.append(tail(index));
+                fn(std::string_view(key), values_[index]);
+                key.resize(length);
+            }
+            auto range = children(node);
+            for (size_t i = 0; i < range.second; i++) {
+                key.push_back(static_cast<char>(labels_[range.first + i]));
+                visit(range.first + i, key, fn);
+                key.pop_back();
+            }
+        }
+
+        // 按层序展开：每层只保存当前层与下一层各节点覆盖的键区间
+        template <typename InputIt>
+        static std::vector<uint64_t> make_image(InputIt first, InputIt last) {
+            std::string bytes;
+            std::vector<size_t> offsets(1, 0);
+            std::vector<V> input;
+            for (; first != last; ++first) {
+                auto&& entry = *first;
+                std::string_view key(entry.first);
+                if (!input.empty() && !(std::string_view(bytes).substr(offsets[input.size() - 1]) < key)) {
+                    throw std::invalid_argument("FrozenTrie input must be strictly increasing");
+                }
+                bytes.append(key);
+                offsets.push_back(bytes.size());
+                input.push_back(entry.second);
+            }
+            auto key_at = [&](size_t i) { return std::string_view(bytes).substr(offsets[i], offsets[i + 1] - offsets[i]); };
+            auto push_bit = [](std::vector<uint64_t>& words, size_t& bits, bool bit) {
+                if (bits % 64 == 0) words.push_back(0);
+                if (bit) words.back() |= uint64_t(1) << (bits % 64);
+                bits++;
+            };
+
+            struct Range {
+                size_t begin;
+                size_t end;
+                size_t depth;
+            };
+            std::vector<uint64_t> louds, terminal;
+            size_t louds_size = 0, nodes = 0;
+            std::vector<unsigned char> labels;
+            std::string tails;
+            std::vector<uint64_t> tail_offsets(1, 0);
+            std::vector<V> values;
+            values.reserve(input.size());
+            std::vector<Range> level, next;
+            if (!input.empty()) level.push_back(Range{0, input.size(), 0});
+            while (!level.empty()) {
+                next.clear();
+                for (Range range : level) {
+                    labels.push_back(range.depth == 0 ? 0 : static_cast<unsigned char>(key_at(range.begin)[range.depth - 1]));
+                    // 区间只剩一个键时整体成为叶子；否则区间首键恰好在此结束时，它的尾部为空
+                    bool is_terminal = range.end - range.begin == 1 || key_at(range.begin).size() == range.depth;
+                    push_bit(terminal, nodes, is_terminal);
+                    if (is_terminal) {
+                        tails.append(key_at(range.begin).substr(range.depth));
+                        tail_offsets.push_back(tails.size());
+                        values.push_back(input[range.begin]);
+                        range.begin++;
+                    }
+                    while (range.begin < range.end) {
+                        char byte = key_at(range.begin)[range.depth];
+                        size_t end = range.begin + 1;
+                        while (end < range.end && key_at(end)[range.depth] == byte) end++;
+                        next.push_back(Range{range.begin, end, range.depth + 1});
+                        push_bit(louds, louds_size, true);
+                        range.begin = end;
+                    }
+                    push_bit(louds, louds_size, false);
+                }
+                level.swap(next);
+            }
+
+            FrozenTrieHeader header = FrozenTrieHeader();
+            header.magic = kMagic;
+            header.version = kVersion;
+            header.value_size = static_cast<uint32_t>(sizeof(V));
+            header.size = input.size();
+            header.nodes = nodes;
+            header.tail_bytes = tails.size();
+            Layout at = layout(header);
+
+            std::vector<uint64_t> image(at.words, 0);
+            uint64_t* base = image.data();
+            std::copy(louds.begin(), louds.end(), base + at.louds);
+            Bits::build_ranks(base + at.louds, louds_size, base + at.louds_ranks);
+            Bits::build_samples(base + at.louds_ranks, louds_size, nodes, base + at.louds_samples);
+            std::copy(terminal.begin(), terminal.end(), base + at.terminal);
+            Bits::build_ranks(base + at.terminal, nodes, base + at.terminal_ranks);
+            if (!labels.empty()) std::memcpy(base + at.labels, labels.data(), labels.size());
+            std::copy(tail_offsets.begin(), tail_offsets.end(), base + at.tail_offsets);
+            if (!tails.empty()) std::memcpy(base + at.tails, tails.data(), tails.size());
+            if (!values.empty()) std::memcpy(base + at.values, values.data(), values.size() * sizeof(V));
+            header.checksum = detail::frozen_checksum(base + kHeaderWords, at.words - kHeaderWords);
+            std::memcpy(base, &header, sizeof(header));
+            return image;
+        }
+
+        // 先写到 path + ".tmp"，完成后替换 path，失败时原文件保持不变
+        static void write_image(const std::string& path, const uint64_t* words, size_t count) {
+            std::string temp = path + ".tmp";
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("FrozenTrie: cannot create '" + temp + "'");
+            try {
+                out.write(reinterpret_cast<const char*>(words), static_cast<std::streamsize>(count * sizeof(uint64_t)));
+                out.close();
+                if (!out) throw std::runtime_error("FrozenTrie: cannot write '" + temp + "'");
+                std::filesystem::rename(temp, path);
+            } catch (...) {
+                out.close();
+                std::error_code ignored;
+                std::filesystem::remove(temp, ignored);
+                throw;
+            }
+        }
+
+        static bool padding_clear(const Bits& bits) {
+            return bits.bits % 64 == 0 || (bits.words[bits.bits / 64] >> (bits.bits % 64)) == 0;
+        }
+
+    public:
+        using mapped_type = V;
+        using size_type = size_t;
+
+        FrozenTrie() {
+            reset();
+        }
+
+        // 由按 std::string 顺序严格递增的 (key, value) 序列构建
+        template <typename InputIt>
+        FrozenTrie(InputIt first, InputIt last) : FrozenTrie() {
+            build(first, last);
+        }
+
+        explicit FrozenTrie(const std::string& path, bool verify = false) : FrozenTrie() {
+            open(path, verify);
+        }
+
+        FrozenTrie(FrozenTrie&& other) noexcept {
+            steal(other);
+        }
+
+        FrozenTrie& operator=(FrozenTrie&& other) noexcept {
+            if (this != &other) {
+                close();
+                steal(other);
+            }
+            return *this;
+        }
+
+        // 在内存中构建，替换原有内容。键按 std::string 顺序（逐字节无符号比较）严格递增，
+        // 否则抛出 std::invalid_argument，原有内容保持不变
+        template <typename InputIt>
+        void build(InputIt first, InputIt last) {
+            std::vector<uint64_t> image = make_image(first, last);
+            close();
+            image_ = std::move(image);
+            std::memcpy(&header_, image_.data(), sizeof(header_));
+            attach(image_.data());
+        }
+
+        // 构建并直接写成文件，输入要求与 build 相同；写文件失败时抛出 std::runtime_error
+        template <typename InputIt>
+        static void build_to_file(const std::string& path, InputIt first, InputIt last) {
+            std::vector<uint64_t> image = make_image(first, last);
+            write_image(path, image.data(), image.size());
+        }
+
+        // 把当前镜像写成文件，之后可以用 open 映射
+        void save(const std::string& path) const {
+            if (header_.magic != kMagic) throw std::logic_error("FrozenTrie: nothing to save");
+            write_image(path, base(), layout(header_).words);
+        }
+
+        // 以只读方式映射文件。文件头与各段长度总会检查；verify 为 true 时还会读完整个文件，
+        // 核对校验和与结构（validate），否则损坏的文件会让查询得到错误结果。失败时抛出 std::runtime_error
+        void open(const std::string& path, bool verify = false) {
+            close();
+            MappedFile file(path);
+            auto fail = [&](const char* what) {
+                throw std::runtime_error("FrozenTrie: '" + path + "' " + what);
+            };
+            if (file.size() < sizeof(FrozenTrieHeader) || file.size() % sizeof(uint64_t) != 0) fail("is not a frozen trie");
+
+            FrozenTrieHeader header;
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (header.magic != kMagic || header.version != kVersion) fail("is not a frozen trie");
+            if (header.value_size != sizeof(V)) fail("was written with a different value type");
+            // 先限制各计数再推算布局，避免损坏的计数溢出
+            if (header.nodes > file.size() || header.size > file.size() || header.tail_bytes > file.size() ||
+                (header.nodes == 0) != (header.size == 0) ||
+                layout(header).words * sizeof(uint64_t) != file.size()) {
+                fail("is truncated or has a corrupt header");
+            }
+
+            file_ = std::move(file);
+            header_ = header;
+            attach(reinterpret_cast<const uint64_t*>(file_.data()));
+            if (verify && !validate()) {
+                close();
+                fail("failed verification");
+            }
+        }
+
+        void close() {
+            image_.clear();
+            image_.shrink_to_fit();
+            file_.close();
+            reset();
+        }
+
+        // 镜像来自 open 映射的文件
+        bool is_mapped() const {
+            return file_.is_open();
+        }
+
+        // 提示操作系统按随机访问处理映射，适合以点查询为主的负载
+        void advise_random() const {
+            file_.advise_random();
+        }
+
+        const V* find(std::string_view key) const {
+            size_t index = find_index(key);
+            return index != kNone ? &values_[index] : nullptr;
+        }
+
+        bool contains(std::string_view key) const {
+            return find_index(key) != kNone;
+        }
+
+        const V& at(std::string_view key) const {
+            const V* value = find(key);
+            if (value == nullptr) throw std::out_of_range("Key not found");
+            return *value;
+        }
+
+        // 最长前缀匹配：返回作为 key 前缀的最长键及其值，没有时值为 nullptr。
+        // 字典不保存完整的键，返回的键是 key 本身的一段
+        std::pair<std::string_view, const V*> longest_prefix(std::string_view key) const {
+            std::pair<std::string_view, const V*> best(std::string_view(), nullptr);
+            if (header_.nodes == 0) return best;
+            size_t node = 0, start = 0;
+            for (size_t depth = 0;; depth++) {
+                if (terminal_.get(node)) {
+                    size_t index = terminal_.rank1(node);
+                    std::string_view rest = tail(index);
+                    if (key.substr(depth, rest.size()) == rest) best = {key.substr(0, depth + rest.size()), &values_[index]};
+                    if (!rest.empty()) break;
+                }
+                if (depth == key.size() || !descend(node, start, static_cast<unsigned char>(key[depth]))) break;
+            }
+            return best;
+        }
+
+        // 按键序对每个以 prefix 开头的键调用 fn(key, value)；key 只在调用期间有效
+        template <typename Fn>
+        void scan_prefix(std::string_view prefix, Fn fn) const {
+            if (header_.nodes == 0) return;
+            size_t node = 0, start = 0;
+            for (size_t depth = 0; depth < prefix.size(); depth++) {
+                if (terminal_.get(node)) {
+                    size_t index = terminal_.rank1(node);
+                    std::string_view rest = tail(index);
+                    // 叶子：prefix 的剩余部分落在尾部之内
+                    if (!rest.empty()) {
+                        if (rest.substr(0, prefix.size() - depth) == prefix.substr(depth)) {
+                            std::string key(prefix.substr(0, depth));
+                            key.append(rest);
+                            fn(std::string_view(key), values_[index]);
+                        }
+                        return;
+                    }
+                }
+                if (!descend(node, start, static_cast<unsigned char>(prefix[depth]))) return;
+            }
+            std::string key(prefix);
+            visit(node, key, fn);
+        }
+
+        // 按键序对全部元素调用 fn(key, value)
+        template <typename Fn>
+        void for_each(Fn fn) const {
+            scan_prefix(std::string_view(), fn);
+        }
+
+        size_t size() const {
+            return static_cast<size_t>(header_.size);
+        }
+
+        bool empty() const {
+            return header_.size == 0;
+        }
+
+        size_t node_count() const {
+            return static_cast<size_t>(header_.nodes);
+        }
+
+        // 镜像（即文件）的字节数
+        size_t memory_usage() const {
+            return header_.magic == kMagic ? layout(header_).words * sizeof(uint64_t) : 0;
+        }
+
+        // 读完整个镜像：校验和、rank/select 目录、LOUDS 形状、边字节有序、叶子都有键、尾部偏移单调
+        bool validate() const {
+            if (header_.magic != kMagic) return header_.size == 0;
+            Layout at = layout(header_);
+            const uint64_t* words = base();
+            if (detail::frozen_checksum(words + kHeaderWords, at.words - kHeaderWords) != header_.checksum) return false;
+
+            size_t nodes = static_cast<size_t>(header_.nodes);
+            if (!padding_clear(louds_) || !padding_clear(terminal_)) return false;
+            std::vector<uint64_t> expected(Bits::rank_count(louds_.bits));
+            Bits::build_ranks(louds_.words, louds_.bits, expected.data());
+            if (!std::equal(expected.begin(), expected.end(), louds_.ranks) ||
+                expected.back() != (nodes == 0 ? 0 : nodes - 1)) {
+                return false;
+            }
+            std::vector<uint64_t> samples(Bits::sample_count(nodes));
+            Bits::build_samples(louds_.ranks, louds_.bits, nodes, samples.data());
+            if (!std::equal(samples.begin(), samples.end(), louds_.samples)) return false;
+            expected.assign(Bits::rank_count(nodes), 0);
+            Bits::build_ranks(terminal_.words, nodes, expected.data());
+            if (!std::equal(expected.begin(), expected.end(), terminal_.ranks) || expected.back() != header_.size) {
+                return false;
+            }
+            for (size_t i = 0; i < header_.size; i++) {
+                if (tail_offsets_[i] > tail_offsets_[i + 1]) return false;
+            }
+            if (tail_offsets_[0] != 0 || tail_offsets_[header_.size] != header_.tail_bytes) return false;
+
+            // 顺序扫描 LOUDS，逐个节点核对 select0 与 rank1 的结果
+            size_t pos = 0, edges = 0, keys = 0;
+            for (size_t node = 0; node < nodes; node++) {
+                if (node > 0 && louds_.select0(node - 1) + 1 != pos) return false;
+                if (terminal_.rank1(node) != keys) return false;
+                size_t degree = 0;
+                while (pos < louds_.bits && louds_.get(pos)) {
+                    size_t next = edges + degree + 1;
+                    if (next <= node || next >= nodes) return false;
+                    if (degree > 0 && labels_[next - 1] >= labels_[next]) return false;
+                    degree++;
+                    pos++;
+                }
+                if (pos == louds_.bits) return false;
+                pos++;
+                edges += degree;
+                if (terminal_.get(node)) {
+                    if (degree > 0 && !tail(keys).empty()) return false;
+                    keys++;
+                } else if (degree == 0) {
+                    return false;
+                }
+            }
+            return pos == louds_.bits && edges + (nodes != 0) == nodes && keys == header_.size;
+        }
+    };
+}
+
+#endif
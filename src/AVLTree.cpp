@@ -0,0 +1,332 @@
+#include <Tree/AVLTree.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <memory_resource>
+#include <type_traits>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：按迭代器顺序取出全部键值对
+template <typename TreeType>
+auto treeToVector(TreeType& tree) {
+    std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>> result;
+    for (auto& entry : tree) {
+        result.emplace_back(entry.first, entry.second);
+    }
+    return result;
+}
+
+template <typename TreeType, typename MapType>
+bool sameContents(TreeType& tree, const MapType& model) {
+    return tree.size() == model.size() && tree.validate() &&
+           treeToVector(tree) == std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>>(
+                                     model.begin(), model.end());
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：随机插入、删除与查找
+bool testInsertAndErase() {
+    Tree::AVLTree<int, int> tree;
+    std::map<int, int> model;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 50000; i++) {
+        int key = static_cast<int>(rng() % 5000);
+        if (rng() % 3 != 0) {
+            bool inserted = tree.insert(key, i).second;
+            if (inserted != model.emplace(key, i).second) break;
+        } else {
+            if (tree.erase(key) != model.erase(key)) break;
+        }
+    }
+    CHECK(sameContents(tree, model), "Random operations match std::map");
+
+    size_t limit = 1;
+    while ((size_t(1) << limit) <= tree.size()) limit++;
+    CHECK(tree.height() <= limit * 3 / 2 + 1, "Height stays within the AVL bound");
+
+    tree.insert_or_assign(model.begin()->first, -1);
+    CHECK(tree.at(model.begin()->first) == -1 && tree.find(-5) == tree.end() && !tree.contains(-5), "insert_or_assign, at and find");
+
+    bool caught = false;
+    try {
+        tree.at(-1);
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() on missing key throws");
+
+    for (auto it = tree.begin(); it != tree.end();) {
+        it = it->first % 2 == 0 ? tree.erase(it) : std::next(it);
+    }
+    bool odd = true;
+    for (auto& entry : tree) odd &= entry.first % 2 != 0;
+    CHECK(odd && tree.validate(), "Erase by iterator");
+
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();) backward.push_back((--it)->first);
+    CHECK(backward.size() == tree.size() && std::is_sorted(backward.rbegin(), backward.rend()), "Reverse iteration from end()");
+
+    return true;
+}
+
+// 测试 2：select、rank 与 count_range
+bool testOrderStatistics() {
+    Tree::AVLTree<int, int> tree;
+    std::set<int> model;
+    std::mt19937 rng(2);
+    bool matched = true;
+    for (int round = 0; round < 20000; round++) {
+        int key = static_cast<int>(rng() % 2000);
+        if (rng() % 4 != 0) {
+            tree.insert(key, key);
+            model.insert(key);
+        } else {
+            tree.erase(key);
+            model.erase(key);
+        }
+        if (round % 97 == 0) {
+            std::vector<int> sorted(model.begin(), model.end());
+            for (size_t k = 0; k < sorted.size(); k += 13) matched &= tree.select(k)->first == sorted[k];
+            matched &= tree.select(sorted.size()) == tree.end();
+            for (int probe = -1; probe <= 2000; probe += 37) {
+                size_t rank = std::lower_bound(sorted.begin(), sorted.end(), probe) - sorted.begin();
+                matched &= tree.rank(probe) == rank;
+                int hi = probe + static_cast<int>(rng() % 300);
+                size_t inRange = std::lower_bound(sorted.begin(), sorted.end(), hi) - sorted.begin() - rank;
+                matched &= tree.count_range(probe, hi) == inRange;
+            }
+        }
+    }
+    CHECK(matched && tree.validate(), "select, rank and count_range match a sorted array");
+    CHECK(tree.count_range(100, 100) == 0 && tree.count_range(200, 100) == 0, "Empty and reversed ranges");
+
+    return true;
+}
+
+// 测试 3：子树聚合
+struct Concat {
+    using value_type = std::string;
+    static std::string identity() {
+        return std::string();
+    }
+    static std::string from(const int&, const std::string& value) {
+        return value;
+    }
+    static std::string combine(const std::string& left, const std::string& right) {
+        return left + right;
+    }
+};
+
+bool testAugmentation() {
+    Tree::AVLTree<int, long long, std::less<int>, Tree::augment::sum<long long>> sums;
+    Tree::AVLTree<int, int, std::less<int>, Tree::augment::max<int>> maxima;
+    std::map<int, long long> model;
+    std::mt19937 rng(3);
+    bool matched = true;
+    for (int round = 0; round < 20000; round++) {
+        int key = static_cast<int>(rng() % 1000);
+        int value = static_cast<int>(rng() % 100000) - 50000;
+        if (rng() % 4 != 0) {
+            sums.insert_or_assign(key, value);
+            maxima.insert_or_assign(key, value);
+            model[key] = value;
+        } else {
+            sums.erase(key);
+            maxima.erase(key);
+            model.erase(key);
+        }
+        if (round % 101 == 0) {
+            int lo = static_cast<int>(rng() % 1000);
+            int hi = lo + static_cast<int>(rng() % 400);
+            long long sum = 0;
+            int max = std::numeric_limits<int>::lowest();
+            for (auto it = model.lower_bound(lo); it != model.end() && it->first < hi; ++it) {
+                sum += it->second;
+                max = std::max(max, static_cast<int>(it->second));
+            }
+            matched &= sums.summarize_range(lo, hi) == sum && maxima.summarize_range(lo, hi) == max;
+        }
+    }
+    long long total = 0;
+    for (auto& entry : model) total += entry.second;
+    CHECK(matched && sums.summary() == total && sums.validate() && maxima.validate(), "Range sum and range max");
+
+    // 不满足交换律的聚合按键序合并
+    Tree::AVLTree<int, std::string, std::less<int>, Concat> text;
+    for (int i : {5, 1, 9, 3, 7, 2, 8, 4, 6, 0}) {
+        text.insert(i, std::string(1, static_cast<char>('a' + i)));
+    }
+    CHECK(text.summary() == "abcdefghij" && text.summarize_range(2, 7) == "cdefg", "Non-commutative augmentation");
+
+    CHECK(sizeof(Tree::AVLNode<int, int, Tree::augment::none::value_type>) ==
+              sizeof(Tree::AVLLink) + sizeof(std::pair<const int, int>),
+          "No augmentation adds no space");
+
+    return true;
+}
+
+// 测试 4：拷贝、移动与自定义分配器
+bool testCopyMoveAllocator() {
+    Tree::AVLTree<int, long long, std::less<int>, Tree::augment::sum<long long>> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i, i);
+    }
+
+    auto copy(tree);
+    tree.insert_or_assign(0, 1000);
+    CHECK(copy.at(0) == 0 && copy.size() == 100 && copy.summary() == 4950 && copy.validate(), "Copy constructor is deep");
+
+    auto moved(std::move(tree));
+    CHECK(moved.size() == 100 && tree.empty() && moved.summary() == 5950, "Move constructor");
+    CHECK((std::is_nothrow_move_constructible<Tree::AVLTree<int, std::string>>::value), "Move constructor is noexcept");
+
+    // 节点池随树移动，源树重新使用时与目标树互不影响
+    Tree::AVLTree<int, int> source;
+    for (int i = 0; i < 1000; i++) {
+        source.insert(i, i);
+    }
+    Tree::AVLTree<int, int> target(std::move(source));
+    for (int i = 0; i < 1000; i++) {
+        source.insert(i, -i);
+        if (i % 2 == 0) target.erase(i);
+    }
+    CHECK(source.size() == 1000 && target.size() == 500 && source.validate() && target.validate() && source.at(7) == -7,
+          "Moved-from tree is independent of the target");
+
+    tree = copy;
+    moved = std::move(copy);
+    CHECK(tree.summary() == 4950 && moved.select(99)->first == 99 && copy.empty() && moved.validate(), "Copy and move assignment");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    using PmrTree = Tree::AVLTree<int, int, std::less<int>, Tree::augment::none,
+                                  std::pmr::polymorphic_allocator<std::pair<const int, int>>>;
+    PmrTree pmrTree(std::less<int>(), &pool);
+    for (int i = 0; i < 1000; i++) {
+        pmrTree.insert((i * 7919) % 1000, i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        pmrTree.erase(i);
+    }
+    CHECK(pmrTree.size() == 666 && pmrTree.rank(500) == 333 && pmrTree.validate() &&
+              pmrTree.get_allocator().resource() == &pool,
+          "Tree with polymorphic allocator");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+// 排名服务的混合负载：一半为插入或删除，一半为 rank、select 与区间计数
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<long long> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<long long>(rng() % (count * 4));
+    size_t operations = count;
+
+    std::cout << "-- " << count << " keys --\n";
+    {
+        Tree::AVLTree<long long, long long> tree;
+        long long insertMs = timeMs([&] {
+            for (long long key : keys) tree.insert(key, key);
+        });
+        size_t checksum = 0;
+        long long mixedMs = timeMs([&] {
+            for (size_t i = 0; i < operations; i++) {
+                long long key = static_cast<long long>(rng() % (count * 4));
+                switch (i % 4) {
+                    case 0:
+                        tree.insert(key, key);
+                        break;
+                    case 1:
+                        tree.erase(key);
+                        break;
+                    case 2:
+                        checksum += tree.rank(key) + tree.count_range(key, key + 1000);
+                        break;
+                    default:
+                        checksum += tree.select(static_cast<size_t>(key) % tree.size())->first;
+                }
+            }
+        });
+        std::cout << "[AVLTree]  insert: " << insertMs << " ms, mixed update/rank x" << operations << ": " << mixedMs
+                  << " ms (checksum " << checksum << ")\n";
+    }
+
+    // std::map 只能用 std::distance 求排名，每次 O(n)，只跑少量操作后按比例估算
+    {
+        std::map<long long, long long> map;
+        for (long long key : keys) map.emplace(key, key);
+        size_t sampled = 20;
+        size_t checksum = 0;
+        long long mixedMs = timeMs([&] {
+            for (size_t i = 0; i < sampled; i++) {
+                long long key = static_cast<long long>(rng() % (count * 4));
+                switch (i % 4) {
+                    case 0:
+                        map.emplace(key, key);
+                        break;
+                    case 1:
+                        map.erase(key);
+                        break;
+                    case 2:
+                        checksum += std::distance(map.begin(), map.lower_bound(key)) +
+                                    std::distance(map.lower_bound(key), map.lower_bound(key + 1000));
+                        break;
+                    default:
+                        checksum += std::next(map.begin(), static_cast<long>(static_cast<size_t>(key) % map.size()))->first;
+                }
+            }
+        });
+        std::cout << "[std::map] mixed update/rank x" << sampled << ": " << mixedMs << " ms, estimated x" << operations
+                  << ": " << mixedMs * static_cast<long long>(operations / sampled) << " ms (checksum " << checksum << ")\n";
+    }
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 10M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInsertAndErase();
+    allPassed &= testOrderStatistics();
+    allPassed &= testAugmentation();
+    allPassed &= testCopyMoveAllocator();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 10000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
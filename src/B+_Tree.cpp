@@ -0,0 +1,498 @@
+#include <Tree/B+_Tree.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <memory_resource>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：按迭代器顺序取出全部键值对
+template <typename TreeType>
+auto treeToVector(TreeType& tree) {
+    std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>> result;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+        result.emplace_back(it.key(), it.value());
+    }
+    return result;
+}
+
+template <typename TreeType, typename MapType>
+bool sameContents(TreeType& tree, const MapType& model) {
+    return tree.size() == model.size() && tree.validate() &&
+           treeToVector(tree) == std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>>(
+                                     model.begin(), model.end());
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：插入、查找与遍历
+bool testInsertAndFind() {
+    Tree::BPlusTree<int, int, 4> tree;
+    CHECK(tree.empty() && tree.begin() == tree.end() && tree.validate(), "Empty tree");
+
+    std::map<int, int> model;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 2000; i++) {
+        int key = static_cast<int>(rng() % 5000);
+        bool inserted = tree.insert(key, i).second;
+        bool expected = model.emplace(key, i).second;
+        if (inserted != expected) break;
+    }
+    CHECK(sameContents(tree, model), "Random inserts match std::map");
+    CHECK(tree.height() > 3, "Tree grows in height");
+
+    auto it = tree.find(model.begin()->first);
+    CHECK(it != tree.end() && it.value() == model.begin()->second, "Find existing key");
+    CHECK(tree.find(-1) == tree.end() && !tree.contains(5001), "Find missing key");
+
+    tree.insert_or_assign(model.begin()->first, -7);
+    tree[123456] = 9;
+    CHECK(tree.at(model.begin()->first) == -7 && tree.at(123456) == 9, "insert_or_assign and operator[]");
+
+    bool caught = false;
+    try {
+        tree.at(-1);
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() on missing key throws");
+
+    std::vector<int> backwards;
+    auto back = tree.end();
+    while (back != tree.begin()) {
+        --back;
+        backwards.push_back(back.key());
+    }
+    CHECK(backwards.size() == tree.size() && std::is_sorted(backwards.rbegin(), backwards.rend()), "Reverse traversal");
+
+    return true;
+}
+
+// 测试 2：顺序插入与删除（含借位与合并）
+bool testSequentialAndErase() {
+    Tree::BPlusTree<int, int, 5> tree;
+    std::map<int, int> model;
+    for (int i = 0; i < 1000; i++) {
+        tree.insert(i, i * 2);
+        model.emplace(i, i * 2);
+    }
+    CHECK(sameContents(tree, model), "Sequential inserts");
+
+    std::mt19937 rng(2);
+    for (int i = 0; i < 3000; i++) {
+        int key = static_cast<int>(rng() % 1200);
+        if (rng() % 3 == 0) {
+            tree.insert(key, key);
+            model.emplace(key, key);
+        } else {
+            size_t removed = tree.erase(key);
+            if (removed != model.erase(key)) break;
+        }
+    }
+    CHECK(sameContents(tree, model), "Random erases and inserts match std::map");
+
+    for (auto& [key, value] : std::map<int, int>(model)) {
+        tree.erase(key);
+    }
+    CHECK(tree.empty() && tree.height() == 1 && tree.validate(), "Erase everything");
+    tree.insert(5, 5);
+    CHECK(tree.size() == 1 && tree.begin().key() == 5, "Reuse after erasing everything");
+
+    return true;
+}
+
+// 测试 3：lower_bound、upper_bound 与范围扫描
+bool testRangeQueries() {
+    Tree::BPlusTree<int, std::string, 6> tree;
+    for (int i = 0; i < 500; i += 5) {
+        tree.insert(i, std::to_string(i));
+    }
+
+    CHECK(tree.lower_bound(10).key() == 10 && tree.lower_bound(11).key() == 15, "lower_bound");
+    CHECK(tree.upper_bound(10).key() == 15 && tree.upper_bound(-1).key() == 0, "upper_bound");
+    CHECK(tree.lower_bound(496) == tree.end() && tree.upper_bound(495) == tree.end(), "Bounds past the end");
+
+    std::vector<int> keys;
+    tree.scan(42, 133, [&](const int& key, std::string& value) {
+        if (value == std::to_string(key)) keys.push_back(key);
+    });
+    std::vector<int> expected;
+    for (int i = 45; i < 133; i += 5) expected.push_back(i);
+    CHECK(keys == expected, "Scan across several leaves");
+
+    keys.clear();
+    tree.scan(0, 10000, [&](const int& key, std::string&) { keys.push_back(key); });
+    CHECK(keys.size() == 100, "Scan the whole tree");
+
+    keys.clear();
+    tree.scan(50, 50, [&](const int& key, std::string&) { keys.push_back(key); });
+    CHECK(keys.empty(), "Empty scan range");
+
+    return true;
+}
+
+// 测试 4：批量构建
+bool testBulkLoad() {
+    for (size_t count : {0, 1, 4, 5, 6, 7, 25, 26, 1000, 12345}) {
+        std::vector<std::pair<int, int>> input;
+        std::map<int, int> model;
+        for (size_t i = 0; i < count; i++) {
+            input.emplace_back(static_cast<int>(i * 3), static_cast<int>(i));
+            model.emplace(static_cast<int>(i * 3), static_cast<int>(i));
+        }
+        Tree::BPlusTree<int, int, 4> tree(Tree::sorted_input, input.begin(), input.end());
+        if (!sameContents(tree, model)) {
+            CHECK(false, "Bulk load of " + std::to_string(count) + " elements");
+        }
+
+        // 批量构建后的树可以继续插入和删除
+        for (size_t i = 0; i < count; i += 2) {
+            tree.erase(static_cast<int>(i * 3));
+            model.erase(static_cast<int>(i * 3));
+            tree.insert(static_cast<int>(i * 3 + 1), 0);
+            model.emplace(static_cast<int>(i * 3 + 1), 0);
+        }
+        if (!sameContents(tree, model)) {
+            CHECK(false, "Updates after bulk load of " + std::to_string(count) + " elements");
+        }
+    }
+    std::cout << "\033[32m[PASS]\033[0m Bulk load at many sizes\n";
+
+    std::vector<std::pair<int, int>> unsorted{{1, 1}, {3, 3}, {2, 2}};
+    bool caught = false;
+    try {
+        Tree::BPlusTree<int, int, 4> tree(Tree::sorted_input, unsorted.begin(), unsorted.end());
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught, "Unsorted bulk input throws");
+
+    return true;
+}
+
+// 测试 5：拷贝、移动与自定义分配器
+bool testCopyMoveAllocator() {
+    Tree::BPlusTree<int, std::string, 4> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i, std::to_string(i));
+    }
+
+    Tree::BPlusTree<int, std::string, 4> copy(tree);
+    tree[0] = "changed";
+    CHECK(copy.at(0) == "0" && copy.size() == 100 && copy.validate(), "Copy constructor is deep");
+
+    Tree::BPlusTree<int, std::string, 4> moved(std::move(tree));
+    CHECK(moved.size() == 100 && tree.empty() && tree.begin() == tree.end(), "Move constructor");
+
+    tree = copy;
+    moved = std::move(copy);
+    CHECK(tree.size() == 100 && moved.at(99) == "99" && copy.empty() && moved.validate(), "Copy and move assignment");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    using PmrTree = Tree::BPlusTree<int, int, 8, std::less<int>, std::pmr::polymorphic_allocator<std::pair<const int, int>>>;
+    PmrTree pmrTree(std::less<int>(), &pool);
+    for (int i = 0; i < 1000; i++) {
+        pmrTree.insert((i * 7919) % 1000, i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        pmrTree.erase(i);
+    }
+    CHECK(pmrTree.size() == 666 && pmrTree.validate() && pmrTree.get_allocator().resource() == &pool, "Tree with polymorphic allocator");
+
+    return true;
+}
+
+// 测试 6：页文件的写出、打开、查询与校验
+bool testMappedFile() {
+    using Mapped = Tree::MappedBPlusTree<int, long long, std::less<int>, Tree::search::simd, 256>;
+    std::string path = (std::filesystem::temp_directory_path() / "bplus_tree_test.idx").string();
+
+    for (size_t count : {0, 1, 14, 15, 16, 1000, 54321}) {
+        std::vector<std::pair<int, long long>> input;
+        for (size_t i = 0; i < count; i++) input.emplace_back(static_cast<int>(i * 3), static_cast<long long>(i) * 7);
+        Mapped::build_to_file(path, input.begin(), input.end());
+        Mapped tree(path, Tree::PageCheck::eager);
+
+        std::vector<std::pair<int, long long>> items;
+        tree.for_each([&](const int& key, const long long& value) { items.emplace_back(key, value); });
+        bool found = true;
+        for (size_t i = 0; i < count; i += 7) {
+            const long long* value = tree.find(static_cast<int>(i * 3));
+            found &= value != nullptr && *value == static_cast<long long>(i) * 7 && !tree.contains(static_cast<int>(i * 3 + 1));
+        }
+        if (tree.size() != count || items != input || !found || !tree.validate()) {
+            CHECK(false, "Page file with " + std::to_string(count) + " elements");
+        }
+    }
+    std::cout << "\033[32m[PASS]\033[0m Page files at many sizes\n";
+
+    // 从内存中的树写出，再做范围扫描
+    Tree::BPlusTree<int, long long> source;
+    for (int i = 0; i < 5000; i++) source.insert((i * 7919) % 5000, i);
+    Mapped::build_to_file(path, source.begin(), source.end());
+    Mapped tree(path);
+    long long sum = 0, expected = 0;
+    tree.scan(1000, 3000, [&](const int&, const long long& value) { sum += value; });
+    source.scan(1000, 3000, [&](const int&, long long& value) { expected += value; });
+    CHECK(tree.size() == 5000 && tree.height() > 2 && sum == expected && tree.at(4999) == source.at(4999),
+          "Build from BPlusTree and scan");
+
+    // 多个线程同时查询同一个按需校验的索引
+    Mapped shared(path, Tree::PageCheck::on_access);
+    std::vector<std::thread> readers;
+    std::vector<long long> sums(4, 0);
+    for (size_t t = 0; t < sums.size(); t++) {
+        readers.emplace_back([&, t] {
+            for (int key = 0; key < 5000; key++) sums[t] += *shared.find(key);
+        });
+    }
+    for (std::thread& reader : readers) reader.join();
+    CHECK(sums[0] == 4999LL * 5000 / 2 && std::count(sums.begin(), sums.end(), sums[0]) == 4,
+          "Concurrent reads of a page file");
+
+    Mapped moved(std::move(tree));
+    CHECK(moved.contains(42) && !tree.is_open() && tree.empty() && tree.find(42) == nullptr, "Move constructor");
+    moved.close();
+
+    bool caught = false;
+    std::vector<std::pair<int, long long>> unsorted{{1, 1}, {3, 3}, {2, 2}};
+    try {
+        Mapped::build_to_file(path, unsorted.begin(), unsorted.end());
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught && Mapped(path).size() == 5000, "Unsorted input throws and keeps the old file");
+
+    caught = false;
+    try {
+        Tree::MappedBPlusTree<int, int, std::less<int>, Tree::search::simd, 256> wrongType(path);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    CHECK(caught, "Opening with a different value type throws");
+
+    // 改写一个叶子页中的一个字节
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(256 * 3 + 100);
+        file.put('\x7f');
+    }
+    Mapped lazy(path, Tree::PageCheck::on_access);
+    caught = false;
+    try {
+        for (int key = 0; key < 5000; key++) lazy.find(key);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    CHECK(caught && !lazy.validate(), "Corrupt page detected on access");
+
+    caught = false;
+    try {
+        Mapped eager(path, Tree::PageCheck::eager);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    Mapped unchecked(path, Tree::PageCheck::none);
+    CHECK(caught && unchecked.contains(4999), "Corrupt page rejected by eager open, ignored when unchecked");
+
+    std::filesystem::remove(path);
+    return true;
+}
+
+// 测试 7：操作计数策略
+bool testStats() {
+    Tree::BPlusTree<int, int, 4, std::less<int>, std::allocator<std::pair<const int, int>>, Tree::search::simd,
+                    Linear::stats::counting>
+        tree;
+    std::mt19937 rng(4);
+    for (int i = 0; i < 1000; i++) {
+        tree.insert(static_cast<int>(rng() % 1000), i);
+    }
+    Linear::stats::Counters inserted = tree.stats();
+    // 叶子与内部节点的每次分裂分配一个兄弟节点，根分裂时再分配新根
+    CHECK(inserted.splits > 0 && inserted.node_allocations == 1 + inserted.splits + (tree.height() - 1),
+          "Insert counts leaf and inner splits");
+
+    for (int i = 0; i < 1000; i += 3) {
+        tree.erase(i);
+    }
+    CHECK(tree.stats().rotations > 0 && tree.stats().node_allocations == inserted.node_allocations && tree.validate(),
+          "Erase counts borrows from siblings");
+
+    Tree::BPlusTree<int, int, 4> plain;
+    plain.insert(1, 1);
+    CHECK(Linear::stats::enabled<Linear::stats::default_policy> || plain.stats().node_allocations == 0,
+          "Disabled stats report zero");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<long long> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<long long>(i) * 2;
+    std::vector<long long> shuffled(keys);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    size_t lookups = std::min<size_t>(count, 10000000);
+    std::vector<long long> probes(lookups);
+    for (long long& probe : probes) probe = static_cast<long long>(rng() % (2 * count));
+
+    size_t ranges = 10000;
+    const long long span = 1000;
+    std::cout << "-- " << count << " keys --\n";
+
+    {
+        std::map<long long, long long> map;
+        long long insertMs = timeMs([&] {
+            for (long long key : shuffled) map.emplace(key, key);
+        });
+        long long found = 0;
+        long long lookupMs = timeMs([&] {
+            for (long long probe : probes) found += map.count(probe);
+        });
+        long long sum = 0;
+        long long scanMs = timeMs([&] {
+            for (size_t r = 0; r < ranges; r++) {
+                long long lo = probes[r % lookups];
+                for (auto it = map.lower_bound(lo); it != map.end() && it->first < lo + span; ++it) sum += it->second;
+            }
+        });
+        std::cout << "[std::map]   random insert: " << insertMs << " ms, lookup x" << lookups << ": " << lookupMs
+                  << " ms, scan x" << ranges << ": " << scanMs << " ms (found " << found << ", sum " << sum << ")\n";
+    }
+
+    {
+        Tree::BPlusTree<long long, long long> tree;
+        long long insertMs = timeMs([&] {
+            for (long long key : shuffled) tree.insert(key, key);
+        });
+        long long found = 0;
+        long long lookupMs = timeMs([&] {
+            for (long long probe : probes) found += tree.contains(probe);
+        });
+        long long sum = 0;
+        long long scanMs = timeMs([&] {
+            for (size_t r = 0; r < ranges; r++) {
+                long long lo = probes[r % lookups];
+                tree.scan(lo, lo + span, [&](const long long&, long long& value) { sum += value; });
+            }
+        });
+        std::cout << "[BPlusTree]  random insert: " << insertMs << " ms, lookup x" << lookups << ": " << lookupMs
+                  << " ms, scan x" << ranges << ": " << scanMs << " ms (found " << found << ", sum " << sum << ")\n";
+    }
+
+    {
+        std::vector<std::pair<long long, long long>> input;
+        input.reserve(count);
+        for (long long key : keys) input.emplace_back(key, key);
+        long long bulkMs = 0;
+        long long sequentialMs = timeMs([&] {
+            Tree::BPlusTree<long long, long long> tree;
+            for (long long key : keys) tree.insert(key, key);
+        });
+        bulkMs = timeMs([&] { Tree::BPlusTree<long long, long long> tree(Tree::sorted_input, input.begin(), input.end()); });
+        std::cout << "[BPlusTree]  sequential insert: " << sequentialMs << " ms, bulk load: " << bulkMs << " ms\n";
+    }
+}
+
+// 启动开销：打开预先写好的页文件，与在内存中重建索引对比
+void testStartup(size_t count) {
+    std::string path = (std::filesystem::temp_directory_path() / "bplus_tree_bench.idx").string();
+    std::mt19937_64 rng(7);
+    std::vector<std::pair<long long, long long>> input(count);
+    for (size_t i = 0; i < count; i++) input[i] = {static_cast<long long>(i) * 2, static_cast<long long>(i)};
+    std::vector<long long> shuffled(count);
+    for (size_t i = 0; i < count; i++) shuffled[i] = input[i].first;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    std::vector<long long> probes(1000000);
+    for (long long& probe : probes) probe = static_cast<long long>(rng() % (2 * count));
+
+    using Mapped = Tree::MappedBPlusTree<long long, long long>;
+    long long writeMs = timeMs([&] { Mapped::build_to_file(path, input.begin(), input.end()); });
+
+    long long insertMs = timeMs([&] {
+        Tree::BPlusTree<long long, long long> tree;
+        for (long long key : shuffled) tree.insert(key, key / 2);
+    });
+    long long bulkMs = timeMs([&] { Tree::BPlusTree<long long, long long> tree(Tree::sorted_input, input.begin(), input.end()); });
+
+    // 文件刚写完，页缓存是热的；冷启动时首批查询还要加上磁盘读
+    auto start = std::chrono::high_resolution_clock::now();
+    Mapped mapped(path);
+    auto opened = std::chrono::high_resolution_clock::now();
+    long long found = 0;
+    for (size_t i = 0; i < 1000; i++) found += mapped.contains(probes[i]);
+    auto queried = std::chrono::high_resolution_clock::now();
+    long long lookupMs = timeMs([&] {
+        for (long long probe : probes) found += mapped.contains(probe);
+    });
+    auto us = [](auto from, auto to) { return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count(); };
+
+    std::cout << "-- " << count << " keys, " << std::filesystem::file_size(path) / (1 << 20) << " MiB page file --\n"
+              << "[rebuild]  random insert: " << insertMs << " ms, bulk load: " << bulkMs << " ms\n"
+              << "[mapped]   build_to_file: " << writeMs << " ms, open: " << us(start, opened)
+              << " us, open + 1000 lookups: " << us(start, queried) << " us, lookup x" << probes.size() << ": "
+              << lookupMs << " ms (found " << found << ")\n";
+    mapped.close();
+    std::filesystem::remove(path);
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 1M，可传 100000000 跑到 100M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInsertAndFind();
+    allPassed &= testSequentialAndErase();
+    allPassed &= testRangeQueries();
+    allPassed &= testBulkLoad();
+    allPassed &= testCopyMoveAllocator();
+    allPassed &= testMappedFile();
+    allPassed &= testStats();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 1000000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    std::cout << "\n=== Startup: Page File vs Rebuild ===\n";
+    for (size_t count = 1000000; count <= maxCount; count *= 10) {
+        testStartup(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,318 @@
+#include <Tree/B_Tree.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+template <typename TreeType, typename MapType>
+bool sameContents(TreeType& tree, const MapType& model) {
+    std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>> items;
+    tree.for_each([&](const auto& key, auto& value) { items.emplace_back(key, value); });
+    return tree.size() == model.size() && tree.validate() &&
+           items == std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>>(model.begin(),
+                                                                                                         model.end());
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：各种查找策略与标准库结果一致
+template <typename Search, typename K>
+bool searchMatches(const std::vector<K>& keys, const std::vector<K>& probes) {
+    for (size_t count = 0; count <= keys.size(); count++) {
+        for (const K& probe : probes) {
+            size_t lower = std::lower_bound(keys.begin(), keys.begin() + count, probe) - keys.begin();
+            size_t upper = std::upper_bound(keys.begin(), keys.begin() + count, probe) - keys.begin();
+            if (Search::lower_bound(keys.data(), count, probe, std::less<K>()) != lower) return false;
+            if (Search::upper_bound(keys.data(), count, probe, std::less<K>()) != upper) return false;
+        }
+    }
+    return true;
+}
+
+template <typename K>
+bool searchAllPolicies(const std::string& name) {
+    std::mt19937 rng(3);
+    std::vector<K> keys;
+    for (int i = 0; i < 70; i++) keys.push_back(static_cast<K>(static_cast<int>(rng() % 200) - 100));
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::vector<K> probes;
+    for (int i = -110; i <= 110; i++) probes.push_back(static_cast<K>(i));
+    probes.push_back(static_cast<K>(-0.5));
+    probes.push_back(static_cast<K>(0.5));
+
+    CHECK(searchMatches<Tree::search::binary>(keys, probes), "Binary search on " + name);
+    CHECK(searchMatches<Tree::search::linear>(keys, probes), "Linear search on " + name);
+    CHECK(searchMatches<Tree::search::simd>(keys, probes), "SIMD search on " + name);
+    return true;
+}
+
+bool testNodeSearch() {
+    bool passed = true;
+    passed &= searchAllPolicies<int32_t>("int32");
+    passed &= searchAllPolicies<int64_t>("int64");
+    passed &= searchAllPolicies<long long>("long long");
+    passed &= searchAllPolicies<float>("float");
+    passed &= searchAllPolicies<double>("double");
+    if (!passed) return false;
+
+    // 降序比较器不能走向量路径
+    std::vector<int> descending{9, 7, 5, 3, 1};
+    auto greater = std::greater<int>();
+    CHECK(Tree::search::simd::lower_bound(descending.data(), descending.size(), 4, greater) == 3 &&
+              Tree::search::simd::upper_bound(descending.data(), descending.size(), 5, greater) == 3,
+          "SIMD search falls back for other comparators");
+
+    // 64 位整数键默认用二分，其余算术键默认用向量比较
+    CHECK((std::is_same<Tree::search::default_policy<long long>, Tree::search::binary>::value &&
+           std::is_same<Tree::search::default_policy<int>, Tree::search::simd>::value &&
+           std::is_same<Tree::search::default_policy<double>, Tree::search::simd>::value),
+          "Default search policy depends on key type");
+
+    return true;
+}
+
+// 测试 2：插入、查找与删除（含分裂、借位与合并）
+template <size_t Order, typename Search>
+bool randomOperations(const std::string& name) {
+    Tree::BTree<int, int, Order, std::less<int>, std::allocator<std::pair<const int, int>>, Search> tree;
+    std::map<int, int> model;
+    std::mt19937 rng(Order);
+    for (int i = 0; i < 20000; i++) {
+        int key = static_cast<int>(rng() % 3000);
+        if (rng() % 3 != 0) {
+            bool inserted = tree.insert(key, i).second;
+            if (inserted != model.emplace(key, i).second) break;
+        } else {
+            if (tree.erase(key) != model.erase(key)) break;
+        }
+    }
+    CHECK(sameContents(tree, model), "Random operations match std::map, " + name);
+
+    for (auto& [key, value] : model) {
+        int* found = tree.find(key);
+        if (found == nullptr || *found != value) break;
+    }
+    CHECK(tree.find(-1) == nullptr && tree.find(5000) == nullptr, "Find after random operations, " + name);
+
+    for (auto& [key, value] : std::map<int, int>(model)) {
+        tree.erase(key);
+    }
+    CHECK(tree.empty() && tree.height() == 1 && tree.validate(), "Erase everything, " + name);
+
+    return true;
+}
+
+bool testRandomOperations() {
+    bool passed = true;
+    passed &= randomOperations<3, Tree::search::binary>("order 3");
+    passed &= randomOperations<4, Tree::search::simd>("order 4");
+    passed &= randomOperations<5, Tree::search::linear>("order 5");
+    passed &= randomOperations<32, Tree::search::simd>("order 32");
+    return passed;
+}
+
+// 测试 3：值的修改、非算术键与拷贝移动
+bool testAccessAndCopy() {
+    Tree::BTree<std::string, int, 4> tree;
+    for (int i = 0; i < 200; i++) {
+        tree.insert("key" + std::to_string(i), i);
+    }
+    tree["key7"] = -7;
+    tree.insert_or_assign("key8", -8);
+    tree.insert("key9", -9);
+    CHECK(tree.at("key7") == -7 && tree.at("key8") == -8 && tree.at("key9") == 9, "operator[], insert_or_assign and insert");
+
+    bool caught = false;
+    try {
+        tree.at("missing");
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() on missing key throws");
+
+    Tree::BTree<std::string, int, 4> copy(tree);
+    tree["key0"] = 100;
+    CHECK(copy.at("key0") == 0 && copy.size() == 200 && copy.validate(), "Copy constructor is deep");
+
+    Tree::BTree<std::string, int, 4> moved(std::move(tree));
+    CHECK(moved.size() == 200 && tree.empty() && tree.find("key0") == nullptr, "Move constructor");
+
+    tree = copy;
+    moved = std::move(copy);
+    CHECK(tree.size() == 200 && moved.at("key199") == 199 && copy.empty() && tree.validate(), "Copy and move assignment");
+
+    Tree::BTree<double, int> doubles;
+    for (int i = 0; i < 1000; i++) {
+        doubles.insert(i * 0.5, i);
+    }
+    CHECK(doubles.at(10.5) == 21 && doubles.find(10.25) == nullptr && doubles.validate(), "Floating point keys");
+
+    return true;
+}
+
+// 测试 4：操作计数策略
+bool testStats() {
+    Tree::BTree<int, int, 4, std::less<int>, std::allocator<std::pair<const int, int>>, Tree::search::simd,
+                Linear::stats::counting>
+        tree;
+    for (int i = 0; i < 1000; i++) {
+        tree.insert(i, i);
+    }
+    Linear::stats::Counters inserted = tree.stats();
+    // 每次分裂分配一个兄弟节点，根分裂时再分配新根
+    CHECK(inserted.splits > 0 && inserted.node_allocations == 1 + inserted.splits + (tree.height() - 1),
+          "Insert counts splits and node allocations");
+    CHECK(inserted.comparisons == 0 && inserted.rotations == 0, "Sequential insert needs no borrowing");
+
+    for (int i = 0; i < 1000; i += 2) {
+        tree.erase(i);
+    }
+    CHECK(tree.stats().rotations > 0 && tree.stats().splits == inserted.splits && tree.validate(),
+          "Erase counts borrows from siblings");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeNs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// 节点内查找：大量有序小数组轮流查找，模拟从不同节点读键
+template <typename K>
+void benchNodeSearch(const std::string& typeName, size_t width) {
+    const size_t nodes = 4096;
+    const size_t queries = 4000000;
+    std::mt19937 rng(7);
+    std::vector<K> keys(nodes * width);
+    for (size_t n = 0; n < nodes; n++) {
+        K value = 0;
+        for (size_t i = 0; i < width; i++) {
+            value += static_cast<K>(1 + rng() % 8);
+            keys[n * width + i] = value;
+        }
+    }
+    std::vector<K> probes(queries);
+    for (K& probe : probes) probe = static_cast<K>(rng() % (width * 8));
+
+    auto run = [&](auto search) {
+        size_t sum = 0;
+        long long ns = timeNs([&] {
+            for (size_t q = 0; q < queries; q++) {
+                sum += search(keys.data() + (q % nodes) * width, probes[q]);
+            }
+        });
+        return std::make_pair(static_cast<double>(ns) / queries, sum);
+    };
+
+    auto branchy = run([&](const K* node, K probe) { return size_t(std::lower_bound(node, node + width, probe) - node); });
+    auto binary = run([&](const K* node, K probe) { return Tree::search::binary::lower_bound(node, width, probe, std::less<K>()); });
+    auto linear = run([&](const K* node, K probe) { return Tree::search::linear::lower_bound(node, width, probe, std::less<K>()); });
+    auto simd = run([&](const K* node, K probe) { return Tree::search::simd::lower_bound(node, width, probe, std::less<K>()); });
+
+    std::cout << "[" << typeName << " x" << width << "] std::lower_bound: " << branchy.first
+              << " ns, binary: " << binary.first << " ns, linear: " << linear.first << " ns, simd: " << simd.first
+              << " ns" << (branchy.second == simd.second && binary.second == simd.second && linear.second == simd.second
+                                ? ""
+                                : " (MISMATCH)") << "\n";
+}
+
+template <size_t Order, typename Search>
+void benchTreeLookup(const std::string& name, const std::vector<long long>& keys, const std::vector<long long>& probes) {
+    Tree::BTree<long long, long long, Order, std::less<long long>, std::allocator<std::pair<const long long, long long>>, Search> tree;
+    long long insertNs = timeNs([&] {
+        for (long long key : keys) tree.insert(key, key);
+    });
+    size_t found = 0;
+    long long lookupNs = timeNs([&] {
+        for (long long probe : probes) found += tree.contains(probe);
+    });
+    std::cout << "[BTree order " << Order << ", " << name << "] insert: " << insertNs / 1000000 << " ms, lookup: "
+              << static_cast<double>(lookupNs) / probes.size() << " ns/op (found " << found << ")\n";
+}
+
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<long long> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<long long>(i) * 2;
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::vector<long long> probes(std::min<size_t>(count, 2000000));
+    for (long long& probe : probes) probe = static_cast<long long>(rng() % (2 * count));
+
+    std::cout << "-- " << count << " keys --\n";
+    {
+        std::map<long long, long long> map;
+        long long insertNs = timeNs([&] {
+            for (long long key : keys) map.emplace(key, key);
+        });
+        size_t found = 0;
+        long long lookupNs = timeNs([&] {
+            for (long long probe : probes) found += map.count(probe);
+        });
+        std::cout << "[std::map] insert: " << insertNs / 1000000 << " ms, lookup: "
+                  << static_cast<double>(lookupNs) / probes.size() << " ns/op (found " << found << ")\n";
+    }
+    benchTreeLookup<16, Tree::search::binary>("binary", keys, probes);
+    benchTreeLookup<16, Tree::search::simd>("simd", keys, probes);
+    benchTreeLookup<32, Tree::search::binary>("binary", keys, probes);
+    benchTreeLookup<32, Tree::search::simd>("simd", keys, probes);
+    benchTreeLookup<64, Tree::search::binary>("binary", keys, probes);
+    benchTreeLookup<64, Tree::search::simd>("simd", keys, probes);
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：树查找测试的最大键数（默认 1M），为 0 时只运行正确性测试
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testNodeSearch();
+    allPassed &= testRandomOperations();
+    allPassed &= testAccessAndCopy();
+    allPassed &= testStats();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    if (maxCount > 0) {
+        const char* levels[] = {"none", "sse4.2", "avx2"};
+        std::cout << "\n=== Node Search (detected: " << levels[static_cast<int>(Tree::detail::kSimdLevel)] << ") ===\n";
+        for (size_t width : {16, 32, 64}) {
+            benchNodeSearch<int32_t>("int32", width);
+            benchNodeSearch<int64_t>("int64", width);
+            benchNodeSearch<float>("float", width);
+            benchNodeSearch<double>("double", width);
+        }
+    }
+
+    std::cout << "\n=== Tree Lookup ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
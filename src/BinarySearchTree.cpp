@@ -0,0 +1,333 @@
+#include <Tree/BinarySearchTree.hpp>
+#include <Linear/Vector.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：按迭代器顺序取出全部键值对
+template <typename TreeType>
+auto treeToVector(TreeType& tree) {
+    std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>> result;
+    for (auto& entry : tree) {
+        result.emplace_back(entry.first, entry.second);
+    }
+    return result;
+}
+
+template <typename TreeType, typename MapType>
+bool sameContents(TreeType& tree, const MapType& model) {
+    return tree.size() == model.size() && tree.validate() &&
+           treeToVector(tree) == std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>>(
+                                     model.begin(), model.end());
+}
+
+// 在冻结树上对每个查询键比较 lower_bound、upper_bound、find 和 rank 与有序数组上的结果
+template <typename FrozenType>
+bool sameAnswers(const FrozenType& frozen, const std::vector<int>& sorted, const std::vector<int>& queries) {
+    if (frozen.size() != sorted.size()) return false;
+    for (int key : queries) {
+        size_t lower = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        size_t upper = static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        if (static_cast<size_t>(frozen.lower_bound(key) - frozen.begin()) != lower) return false;
+        if (static_cast<size_t>(frozen.upper_bound(key) - frozen.begin()) != upper) return false;
+        if (frozen.rank(key) != lower) return false;
+        bool present = lower < sorted.size() && sorted[lower] == key;
+        if (frozen.contains(key) != present) return false;
+        if (present && frozen.at(key) != key * 2) return false;
+    }
+    return true;
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：随机插入、删除与查找
+bool testInsertAndErase() {
+    Tree::BinarySearchTree<int, int> tree;
+    std::map<int, int> model;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 50000; i++) {
+        int key = static_cast<int>(rng() % 5000);
+        if (rng() % 3 != 0) {
+            bool inserted = tree.insert(key, i).second;
+            if (inserted != model.emplace(key, i).second) break;
+        } else {
+            if (tree.erase(key) != model.erase(key)) break;
+        }
+    }
+    CHECK(sameContents(tree, model), "Random operations match std::map");
+
+    bool boundsMatch = true;
+    for (int key = -1; key <= 5001; key++) {
+        auto lower = tree.lower_bound(key);
+        auto expected = model.lower_bound(key);
+        if ((lower == tree.end()) != (expected == model.end())) boundsMatch = false;
+        if (lower != tree.end() && lower->first != expected->first) boundsMatch = false;
+        auto upper = tree.upper_bound(key);
+        auto expectedUpper = model.upper_bound(key);
+        if ((upper == tree.end()) != (expectedUpper == model.end())) boundsMatch = false;
+        if (upper != tree.end() && upper->first != expectedUpper->first) boundsMatch = false;
+        if (tree.contains(key) != (model.count(key) == 1)) boundsMatch = false;
+    }
+    CHECK(boundsMatch, "lower_bound/upper_bound/contains match std::map");
+
+    auto last = tree.end();
+    --last;
+    CHECK(last->first == model.rbegin()->first, "--end() reaches the largest key");
+
+    tree.insert_or_assign(model.begin()->first, -7);
+    model[model.begin()->first] = -7;
+    tree[100000] += 3;
+    model[100000] += 3;
+    CHECK(tree.at(100000) == 3 && sameContents(tree, model), "insert_or_assign and operator[] update values");
+
+    // erase(iterator) 返回下一个元素，删掉偶数键
+    for (auto it = tree.begin(); it != tree.end();) {
+        if (it->first % 2 == 0) {
+            model.erase(it->first);
+            it = tree.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    CHECK(sameContents(tree, model), "erase(iterator) while iterating");
+
+    bool threw = false;
+    try {
+        tree.at(-1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    CHECK(threw, "at() throws on a missing key");
+
+    size_t limit = 1;
+    while ((size_t(1) << limit) <= tree.size()) limit++;
+    CHECK(tree.height() >= limit && tree.height() < 4 * limit, "Random insertion keeps height logarithmic");
+    return true;
+}
+
+// 测试 2：有序插入退化成链，复制、析构和校验都不能递归
+bool testDegenerate() {
+    const int count = 50000;
+    Tree::BinarySearchTree<int, int> tree;
+    for (int i = 0; i < count; i++) tree.insert(i, i);
+    CHECK(tree.height() == static_cast<size_t>(count) && tree.validate(), "Sorted insertion gives a chain");
+
+    Tree::BinarySearchTree<int, int> copy(tree);
+    CHECK(copy.size() == tree.size() && copy.validate() && copy.height() == tree.height(), "Copy of a chain");
+
+    Tree::BinarySearchTree<int, int> moved(std::move(copy));
+    CHECK(copy.empty() && moved.size() == static_cast<size_t>(count) && moved.validate(), "Move leaves source empty");
+    CHECK((std::is_nothrow_move_constructible<Tree::BinarySearchTree<int, int>>::value), "Move constructor is noexcept");
+
+    // 节点池随树移动，源树重新使用时与目标树互不影响
+    for (int i = 0; i < 1000; i++) copy.insert(i, -i);
+    for (int i = 1; i < count; i += 2) moved.erase(i);
+    CHECK(copy.size() == 1000 && copy.validate() && copy.at(7) == -7 && moved.size() == static_cast<size_t>(count / 2),
+          "Moved-from tree is independent of the target");
+
+    for (int i = 0; i < count; i += 2) moved.erase(i);
+    CHECK(moved.empty() && moved.validate(), "Erase along the chain");
+
+    auto frozen = tree.freeze<Tree::SearchLayout::van_emde_boas>();
+    CHECK(frozen.size() == static_cast<size_t>(count) && frozen.height() == 16 && frozen.rank(count / 2) == count / 2,
+          "Freezing a chain gives a balanced layout");
+
+    tree.clear();
+    CHECK(tree.empty() && tree.height() == 0 && tree.validate(), "clear() on a chain");
+    return true;
+}
+
+// 测试 3：两种布局的冻结树与有序数组上的二分查找结果一致
+template <Tree::SearchLayout Layout>
+bool testFrozenLayout(const char* name) {
+    std::mt19937 rng(7);
+    bool smallMatch = true;
+    for (int n = 0; n <= 130; n++) {
+        Tree::BinarySearchTree<int, int> tree;
+        std::vector<int> sorted;
+        for (int i = 0; i < n; i++) sorted.push_back(i * 3 + 1);
+        std::vector<int> shuffled = sorted;
+        std::shuffle(shuffled.begin(), shuffled.end(), rng);
+        for (int key : shuffled) tree.insert(key, key * 2);
+        std::vector<int> queries;
+        for (int key = -2; key <= n * 3 + 2; key++) queries.push_back(key);
+        auto frozen = tree.template freeze<Layout>();
+        if (!sameAnswers(frozen, sorted, queries)) smallMatch = false;
+    }
+    CHECK(smallMatch, std::string(name) + ": every key and gap for sizes 0..130");
+
+    std::vector<int> sorted;
+    for (int i = 0; i < 300000; i++) sorted.push_back(static_cast<int>(rng() >> 3));
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    std::vector<std::pair<int, int>> items;
+    for (int key : sorted) items.emplace_back(key, key * 2);
+    Tree::FrozenSearchTree<int, int, std::less<int>, Layout> frozen(items.begin(), items.end());
+    std::vector<int> queries;
+    for (int i = 0; i < 200000; i++) queries.push_back(i % 2 == 0 ? sorted[rng() % sorted.size()] : static_cast<int>(rng() >> 3));
+    queries.push_back(std::numeric_limits<int>::min());
+    queries.push_back(std::numeric_limits<int>::max());
+    CHECK(sameAnswers(frozen, sorted, queries), std::string(name) + ": random queries on a large sorted range");
+
+    // 复制后对齐偏移重新计算，结果不变
+    auto copy = frozen;
+    decltype(frozen) assigned;
+    assigned = copy;
+    CHECK(sameAnswers(copy, sorted, queries) && sameAnswers(assigned, sorted, queries),
+          std::string(name) + ": copies answer the same");
+
+    std::vector<std::pair<int, int>> reversed(items.rbegin(), items.rend());
+    Tree::FrozenSearchTree<int, int, std::greater<int>, Layout> descending(reversed.begin(), reversed.end());
+    bool greaterMatch = true;
+    for (size_t i = 0; i < 1000; i++) {
+        int key = queries[i];
+        auto it = std::lower_bound(reversed.begin(), reversed.end(), key,
+                                   [](const std::pair<int, int>& a, int b) { return a.first > b; });
+        if (descending.lower_bound(key) - descending.begin() != it - reversed.begin()) greaterMatch = false;
+    }
+    CHECK(greaterMatch, std::string(name) + ": custom comparator");
+
+    bool threw = false;
+    std::swap(items[10], items[11]);
+    try {
+        Tree::FrozenSearchTree<int, int, std::less<int>, Layout> bad(items.begin(), items.end());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    CHECK(threw, std::string(name) + ": unsorted input throws");
+
+    Tree::FrozenSearchTree<int, int, std::less<int>, Layout> empty;
+    CHECK(empty.empty() && empty.lower_bound(5) == empty.end() && !empty.contains(5),
+          std::string(name) + ": empty tree");
+    return true;
+}
+
+// 测试 4：冻结是快照，之后修改原树不影响它
+bool testFreezeSnapshot() {
+    Tree::BinarySearchTree<std::string, int> tree;
+    std::vector<std::string> words = {"pear", "apple", "fig", "kiwi", "banana", "cherry", "date", "grape", "lemon"};
+    for (size_t i = 0; i < words.size(); i++) tree.insert(words[i], static_cast<int>(i));
+    auto frozen = tree.freeze();
+    tree.erase("fig");
+    tree.insert("zucchini", 99);
+    CHECK(frozen.size() == words.size() && frozen.contains("fig") && !frozen.contains("zucchini"),
+          "Frozen tree is independent of later edits");
+    CHECK(frozen.begin()->first == "apple" && frozen.lower_bound("c")->first == "cherry" &&
+              frozen.upper_bound("pear") == frozen.end() && frozen.at("kiwi") == 3,
+          "String keys in the frozen tree");
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+template <typename Fn>
+void reportLookups(const char* name, const std::vector<long long>& queries, Fn lookup) {
+    long long checksum = 0;
+    long long ms = timeMs([&] {
+        for (long long key : queries) checksum += lookup(key);
+    });
+    std::cout << name << ms * 1000000 / static_cast<long long>(queries.size()) << " ns/lookup (checksum " << checksum
+              << ")\n";
+}
+
+// 只读查找表：随机顺序建树，再分别在各种结构上做相同的随机 lower_bound
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<long long> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<long long>(rng() % (count * 4));
+    std::vector<long long> queries(2000000);
+    for (long long& key : queries) key = static_cast<long long>(rng() % (count * 4));
+
+    std::cout << "-- " << count << " keys, " << queries.size() << " lookups --\n";
+    Tree::BinarySearchTree<long long, long long> tree;
+    for (long long key : keys) tree.insert(key, key);
+    reportLookups("[BinarySearchTree]            ", queries, [&](long long key) {
+        auto it = tree.lower_bound(key);
+        return it == tree.end() ? 0 : it->second;
+    });
+
+    {
+        Tree::FrozenSearchTree<long long, long long> frozen;
+        long long freezeMs = timeMs([&] { frozen = tree.freeze(); });
+        std::cout << "  freeze: " << freezeMs << " ms, " << frozen.memory_usage() / frozen.size() << " B/key\n";
+        reportLookups("[FrozenSearchTree eytzinger]  ", queries, [&](long long key) {
+            auto it = frozen.lower_bound(key);
+            return it == frozen.end() ? 0 : it->second;
+        });
+    }
+    {
+        Tree::FrozenSearchTree<long long, long long, std::less<long long>, Tree::SearchLayout::van_emde_boas> frozen;
+        long long freezeMs = timeMs([&] { frozen = tree.freeze<Tree::SearchLayout::van_emde_boas>(); });
+        std::cout << "  freeze: " << freezeMs << " ms, " << frozen.memory_usage() / frozen.size() << " B/key\n";
+        reportLookups("[FrozenSearchTree vEB]        ", queries, [&](long long key) {
+            auto it = frozen.lower_bound(key);
+            return it == frozen.end() ? 0 : it->second;
+        });
+    }
+
+    Linear::Vector<long long> sorted;
+    for (auto& entry : tree) sorted.push_back(entry.first);
+    tree.clear();
+    reportLookups("[std::lower_bound on Vector]  ", queries, [&](long long key) {
+        const long long* it = std::lower_bound(sorted.data(), sorted.data() + sorted.size(), key);
+        return it == sorted.data() + sorted.size() ? 0 : *it;
+    });
+
+    std::set<long long> set(keys.begin(), keys.end());
+    reportLookups("[std::set]                    ", queries, [&](long long key) {
+        auto it = set.lower_bound(key);
+        return it == set.end() ? 0 : *it;
+    });
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 10M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInsertAndErase();
+    allPassed &= testDegenerate();
+    allPassed &= testFrozenLayout<Tree::SearchLayout::eytzinger>("Eytzinger");
+    allPassed &= testFrozenLayout<Tree::SearchLayout::van_emde_boas>("van Emde Boas");
+    allPassed &= testFreezeSnapshot();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 10000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,347 @@
+#include <Tree/BinarySearchTree.hpp>
+#include <Tree/AVLTree.hpp>
+#include <Tree/RedBlackTree.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+using BST = Tree::BinarySearchTree<int, int>;
+using BSTNode = Tree::BinarySearchNode<int, int>;
+
+// 辅助函数：取出某种遍历顺序下的全部键
+template <typename Range>
+std::vector<int> keysOf(Range range) {
+    std::vector<int> result;
+    for (auto& entry : range) result.push_back(entry.first);
+    return result;
+}
+
+// 从任意节点沿父指针找到 BinarySearchTree 的根，供递归的参照实现使用
+Tree::BinaryLink* rootOf(BST& tree) {
+    if (tree.empty()) return nullptr;
+    Tree::BinaryLink* node = tree.begin().link();
+    while (node->parent != nullptr) node = node->parent;
+    return node;
+}
+
+// 递归遍历作为参照；order 为 0、1、2 分别表示先序、中序、后序
+template <typename Fn>
+void recurse(Tree::BinaryLink* node, int order, Fn& fn) {
+    if (node == nullptr) return;
+    if (order == 0) fn(static_cast<BSTNode*>(node)->value);
+    recurse(node->left, order, fn);
+    if (order == 1) fn(static_cast<BSTNode*>(node)->value);
+    recurse(node->right, order, fn);
+    if (order == 2) fn(static_cast<BSTNode*>(node)->value);
+}
+
+std::vector<int> recursiveKeys(BST& tree, int order) {
+    std::vector<int> result;
+    auto collect = [&](const std::pair<const int, int>& entry) { result.push_back(entry.first); };
+    recurse(rootOf(tree), order, collect);
+    return result;
+}
+
+// 由二叉搜索树的先序序列推出后序序列：先序唯一确定树的形状
+void postFromPre(const std::vector<int>& pre, size_t& index, long long lower, long long upper, std::vector<int>& post) {
+    if (index == pre.size() || pre[index] <= lower || pre[index] >= upper) return;
+    int key = pre[index++];
+    postFromPre(pre, index, lower, key, post);
+    postFromPre(pre, index, key, upper, post);
+    post.push_back(key);
+}
+
+// 不接触节点的检查：中序有序且与模型一致，先序能还原出一棵树，其后序与 post_order 相同
+template <typename TreeType>
+bool consistentOrders(TreeType& tree, const std::map<int, int>& model) {
+    std::vector<int> sorted;
+    for (auto& entry : model) sorted.push_back(entry.first);
+    std::vector<int> pre = keysOf(tree.pre_order());
+    std::vector<int> post = keysOf(tree.post_order());
+    std::vector<int> expectedPost;
+    size_t index = 0;
+    postFromPre(pre, index, std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max(), expectedPost);
+    return keysOf(tree.in_order()) == sorted && index == pre.size() && post == expectedPost;
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：BinarySearchTree 的三种顺序与递归遍历一致
+bool testOrdersMatchRecursion() {
+    std::mt19937 rng(3);
+    bool match = true;
+    for (int n : {0, 1, 2, 3, 7, 100, 5000}) {
+        BST tree;
+        for (int i = 0; i < n; i++) tree.insert(static_cast<int>(rng() % 100000), i);
+        if (keysOf(tree.pre_order()) != recursiveKeys(tree, 0)) match = false;
+        if (keysOf(tree.in_order()) != recursiveKeys(tree, 1)) match = false;
+        if (keysOf(tree.post_order()) != recursiveKeys(tree, 2)) match = false;
+    }
+    CHECK(match, "pre_order/in_order/post_order match recursive traversal");
+
+    // 只有左链或只有右链时，先序与后序的回溯路径最长
+    BST left;
+    BST right;
+    for (int i = 0; i < 1000; i++) {
+        left.insert(1000 - i, i);
+        right.insert(i, i);
+    }
+    CHECK(keysOf(left.pre_order()) == recursiveKeys(left, 0) && keysOf(left.post_order()) == recursiveKeys(left, 2) &&
+              keysOf(right.pre_order()) == recursiveKeys(right, 0) &&
+              keysOf(right.post_order()) == recursiveKeys(right, 2),
+          "Left and right chains");
+
+    // 值可写的树可以经遍历修改值
+    for (auto& entry : right.post_order()) entry.second = -entry.first;
+    CHECK(right.at(999) == -999 && right.at(0) == 0, "Values are writable through post_order()");
+    return true;
+}
+
+// 测试 2：AVL 树与红黑树继承的遍历
+bool testInheritedOrders() {
+    std::mt19937 rng(5);
+    Tree::AVLTree<int, int> avl;
+    Tree::RedBlackTree<int, int> rb;
+    BST bst;
+    std::map<int, int> model;
+    for (int i = 0; i < 20000; i++) {
+        int key = static_cast<int>(rng() % 50000);
+        if (rng() % 4 == 0) {
+            avl.erase(key);
+            rb.erase(key);
+            bst.erase(key);
+            model.erase(key);
+        } else {
+            avl.insert(key, i);
+            rb.insert(key, i);
+            bst.insert(key, i);
+            model.emplace(key, i);
+        }
+    }
+    CHECK(consistentOrders(avl, model), "AVLTree: pre/in/post order are consistent");
+    CHECK(consistentOrders(rb, model), "RedBlackTree: pre/in/post order are consistent");
+    CHECK(consistentOrders(bst, model), "BinarySearchTree: pre/in/post order are consistent");
+
+    Tree::RedBlackTree<int, int> emptyTree;
+    CHECK(keysOf(emptyTree.pre_order()).empty() && keysOf(emptyTree.post_order()).empty() && emptyTree.height() == 0,
+          "Empty tree traversals");
+
+    // 红黑树中每条路径的长度不超过最短路径的两倍
+    size_t limit = 1;
+    while ((size_t(1) << limit) <= rb.size()) limit++;
+    CHECK(rb.height() >= limit && rb.height() <= 2 * limit, "RedBlackTree::height() from the shared base");
+    return true;
+}
+
+// 测试 3：for_each 与 range_for_each
+template <typename TreeType>
+bool visitsMatch(TreeType& tree, const std::map<int, int>& model, std::mt19937& rng) {
+    std::vector<std::pair<int, int>> all;
+    tree.for_each([&](const std::pair<const int, int>& entry) { all.emplace_back(entry.first, entry.second); });
+    if (all != std::vector<std::pair<int, int>>(model.begin(), model.end())) return false;
+    for (int i = 0; i < 300; i++) {
+        int lo = static_cast<int>(rng() % 52000) - 1000;
+        int hi = i % 10 == 0 ? lo - 5 : lo + static_cast<int>(rng() % (i % 3 == 0 ? 50 : 20000));
+        std::vector<int> keys;
+        tree.range_for_each(lo, hi, [&](const std::pair<const int, int>& entry) { keys.push_back(entry.first); });
+        std::vector<int> expected;
+        for (auto it = model.lower_bound(lo); it != model.end() && it->first < hi; ++it) expected.push_back(it->first);
+        if (keys != expected) return false;
+    }
+    return true;
+}
+
+struct Item : Tree::RBHook<> {
+    int key;
+    int seen = 0;
+
+    explicit Item(int key) : key(key) {}
+};
+
+struct KeyOfItem {
+    int operator()(const Item& item) const {
+        return item.key;
+    }
+};
+
+bool testVisitors() {
+    std::mt19937 rng(11);
+    Tree::AVLTree<int, int> avl;
+    Tree::RedBlackTree<int, int> rb;
+    BST bst;
+    std::map<int, int> model;
+    for (int i = 0; i < 30000; i++) {
+        int key = static_cast<int>(rng() % 50000);
+        avl.insert(key, i);
+        rb.insert(key, i);
+        bst.insert(key, i);
+        model.emplace(key, i);
+    }
+    CHECK(visitsMatch(avl, model, rng), "AVLTree: for_each and range_for_each match std::map");
+    CHECK(visitsMatch(rb, model, rng), "RedBlackTree: for_each and range_for_each match std::map");
+    CHECK(visitsMatch(bst, model, rng), "BinarySearchTree: for_each and range_for_each match std::map");
+
+    rb.for_each([](std::pair<const int, int>& entry) { entry.second = entry.first * 2; });
+    bool doubled = true;
+    for (auto& entry : rb) doubled &= entry.second == entry.first * 2;
+    CHECK(doubled, "for_each can modify values");
+
+    // 侵入式树允许重复键，range_for_each 访问区间内的全部副本
+    std::vector<Item> items;
+    for (int i = 0; i < 2000; i++) items.emplace_back(i % 500);
+    Tree::IntrusiveRedBlackTree<Item, KeyOfItem> intrusive;
+    for (Item& item : items) intrusive.insert_multi(item);
+    intrusive.range_for_each(100, 200, [](Item& item) { item.seen++; });
+    size_t seen = 0;
+    bool inRange = true;
+    for (const Item& item : items) {
+        seen += static_cast<size_t>(item.seen);
+        if (item.seen != 0 && (item.key < 100 || item.key >= 200)) inRange = false;
+    }
+    size_t visited = 0;
+    intrusive.for_each([&](Item&) { visited++; });
+    CHECK(seen == 400 && inRange && visited == items.size(), "IntrusiveRedBlackTree visitors with duplicate keys");
+    return true;
+}
+
+// 测试 4：退化成链的树上遍历不需要栈
+bool testDeepChain() {
+    const int count = 30000;
+    BST tree;
+    for (int i = 0; i < count; i++) tree.insert(i, i);
+    long long sum = 0;
+    size_t visited = 0;
+    tree.for_each([&](const std::pair<const int, int>& entry) { sum += entry.second; });
+    for (auto& entry : tree.post_order()) visited += static_cast<size_t>(entry.first >= 0);
+    for (auto& entry : tree.pre_order()) visited += static_cast<size_t>(entry.first >= 0);
+    CHECK(sum == static_cast<long long>(count) * (count - 1) / 2 && visited == 2 * static_cast<size_t>(count) &&
+              tree.height() == static_cast<size_t>(count),
+          "Traversals over a chain of 30000 nodes");
+
+    // 向左的长链超出 for_each 暂存祖先的容量，之后要沿父指针找回
+    BST left;
+    for (int i = count - 1; i >= 0; i--) left.insert(i, i);
+    std::vector<int> keys;
+    left.for_each([&](const std::pair<const int, int>& entry) { keys.push_back(entry.first); });
+    bool ascending = keys.size() == static_cast<size_t>(count);
+    for (size_t i = 0; ascending && i < keys.size(); i++) ascending = keys[i] == static_cast<int>(i);
+    size_t inRange = 0;
+    left.range_for_each(100, 20000, [&](const std::pair<const int, int>&) { inRange++; });
+    CHECK(ascending && inRange == 19900, "for_each and range_for_each over a left chain");
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+template <typename Fn>
+void reportScan(const char* name, size_t count, Fn scan) {
+    long long sum = 0;
+    long long ms = timeMs([&] { sum = scan(); });
+    std::cout << name << ms << " ms, " << static_cast<double>(ms) * 1e6 / static_cast<double>(count)
+              << " ns/node (sum " << sum << ")\n";
+}
+
+// 在同一棵树上比较各种全量扫描；树按随机顺序插入，节点在内存中的顺序与键序无关
+template <typename TreeType>
+void scanTree(const char* name, TreeType& tree) {
+    size_t count = tree.size();
+    std::cout << name << "\n";
+    reportScan("  iterator      ", count, [&] {
+        long long sum = 0;
+        for (auto& entry : tree) sum += entry.second;
+        return sum;
+    });
+    reportScan("  for_each      ", count, [&] {
+        long long sum = 0;
+        tree.for_each([&](const auto& entry) { sum += entry.second; });
+        return sum;
+    });
+    reportScan("  pre_order     ", count, [&] {
+        long long sum = 0;
+        for (auto& entry : tree.pre_order()) sum += entry.second;
+        return sum;
+    });
+    reportScan("  post_order    ", count, [&] {
+        long long sum = 0;
+        for (auto& entry : tree.post_order()) sum += entry.second;
+        return sum;
+    });
+}
+
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<int>(rng() % (count * 4));
+
+    std::cout << "-- " << count << " keys --\n";
+    {
+        BST tree;
+        for (int key : keys) tree.insert(key, key);
+        scanTree("[BinarySearchTree]", tree);
+        reportScan("  recursive     ", tree.size(), [&] {
+            long long sum = 0;
+            auto add = [&](const std::pair<const int, int>& entry) { sum += entry.second; };
+            recurse(rootOf(tree), 1, add);
+            return sum;
+        });
+    }
+    {
+        Tree::AVLTree<int, int> tree;
+        for (int key : keys) tree.insert(key, key);
+        scanTree("[AVLTree]", tree);
+    }
+    {
+        Tree::RedBlackTree<int, int> tree;
+        for (int key : keys) tree.insert(key, key);
+        scanTree("[RedBlackTree]", tree);
+    }
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 10M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testOrdersMatchRecursion();
+    allPassed &= testInheritedOrders();
+    allPassed &= testVisitors();
+    allPassed &= testDeepChain();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 10000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
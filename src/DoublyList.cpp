@@ -1,6 +1,12 @@
 #include <Linear/DoublyList.hpp>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 // 自定义测试宏
 #define CHECK(condition, message) \
@@ -101,7 +107,52 @@ bool testSpliceAndMerge() {
     return true;
 }
 
-// 测试 5：去重和反转
+// 测试 5：merge 只重新链接节点，以及区间 splice
+bool testRelinkMerge() {
+    Linear::DoublyList<std::pair<int, char>> list1, list2;
+    for (int i = 0; i < 10; i += 2) {
+        list1.push_back({i, 'a'});
+        list2.push_back({i, 'b'});
+        list2.push_back({i + 1, 'b'});
+    }
+    const std::pair<int, char>* moved = &list2.front();
+    list1.merge(list2, [](const std::pair<int, char>& a, const std::pair<int, char>& b) { return a.first < b.first; });
+
+    std::vector<std::pair<int, char>> expected;
+    for (int i = 0; i < 10; i += 2) {
+        expected.push_back({i, 'a'});
+        expected.push_back({i, 'b'});
+        expected.push_back({i + 1, 'b'});
+    }
+    CHECK(listToVector(list1) == expected, "Merge is stable, this list first");
+    CHECK(list1.size() == 15 && list2.empty(), "Sizes after merge");
+    CHECK(&*++list1.begin() == moved, "Merged nodes are relinked, not copied");
+
+    Linear::DoublyList<int> empty, full;
+    full.push_back(1);
+    empty.merge(full);
+    CHECK(empty.size() == 1 && empty.back() == 1 && full.empty(), "Merge into empty list");
+
+    Linear::DoublyList<int> a, b;
+    for (int i = 0; i < 5; i++) {
+        a.push_back(i);
+        b.push_back(10 + i);
+    }
+    auto first = ++b.begin();
+    auto last = first;
+    ++last;
+    ++last;
+    a.splice(++a.begin(), b, first, last);
+    CHECK((listToVector(a) == std::vector<int>{0, 11, 12, 1, 2, 3, 4}), "Range splice between lists");
+    CHECK((listToVector(b) == std::vector<int>{10, 13, 14}) && a.size() == 7 && b.size() == 3, "Range splice sizes");
+
+    a.splice(a.end(), a, a.begin(), ++++a.begin(), 2);
+    CHECK((listToVector(a) == std::vector<int>{12, 1, 2, 3, 4, 0, 11}) && a.size() == 7, "Range splice within one list");
+
+    return true;
+}
+
+// 测试 6：去重和反转
 bool testUniqueAndReverse() {
     Linear::DoublyList<int> list;
     list.push_back(1);
@@ -119,7 +170,7 @@ bool testUniqueAndReverse() {
     return true;
 }
 
-// 测试 6：排序功能
+// 测试 7：排序功能
 bool testSort() {
     // 测试默认升序排序
     Linear::DoublyList<int> list1;
@@ -144,7 +195,171 @@ bool testSort() {
     return true;
 }
 
-// 测试 7：异常处理
+// 测试 8：排序的稳定性与特殊输入
+bool testSortInputs() {
+    Linear::DoublyList<std::pair<int, int>> pairs;
+    std::vector<std::pair<int, int>> expected;
+    std::mt19937 rng(11);
+    for (int i = 0; i < 2000; i++) {
+        std::pair<int, int> p(static_cast<int>(rng() % 10), i);
+        pairs.push_back(p);
+        expected.push_back(p);
+    }
+    auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    pairs.sort(byKey);
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+    CHECK(listToVector(pairs) == expected, "Sort is stable");
+
+    Linear::DoublyList<int> sorted, reversed, equal;
+    std::vector<int> ascending;
+    for (int i = 0; i < 1000; i++) {
+        sorted.push_back(i);
+        reversed.push_front(i);
+        equal.push_back(5);
+        ascending.push_back(i);
+    }
+    sorted.sort();
+    reversed.sort();
+    equal.sort();
+    CHECK(listToVector(sorted) == ascending, "Sorted input");
+    CHECK(listToVector(reversed) == ascending, "Reverse sorted input");
+    CHECK(listToVector(equal) == std::vector<int>(1000, 5), "All equal input");
+
+    // 排序后 prev 链也必须正确
+    std::vector<int> backwards;
+    auto it = reversed.end();
+    while (it != reversed.begin()) {
+        --it;
+        backwards.push_back(*it);
+    }
+    CHECK((backwards == std::vector<int>(ascending.rbegin(), ascending.rend())), "Prev links rebuilt");
+    CHECK(reversed.back() == 999 && reversed.front() == 0, "Front and back after sort");
+
+    return true;
+}
+
+// 测试 9：并行排序
+bool testParallelSort() {
+    std::mt19937 rng(17);
+    for (size_t threads : {2, 3, 4, 8}) {
+        for (int modulo : {1000000, 7, 1}) {
+            Linear::DoublyList<std::pair<int, int>> list;
+            std::vector<std::pair<int, int>> expected;
+            for (int i = 0; i < 20000; i++) {
+                std::pair<int, int> p(static_cast<int>(rng() % modulo), i);
+                list.push_back(p);
+                expected.push_back(p);
+            }
+            auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+            list.sort(Linear::execution::parallel_policy{threads, 0}, byKey);
+            std::stable_sort(expected.begin(), expected.end(), byKey);
+            if (listToVector(list) != expected || list.size() != expected.size()) {
+                CHECK(false, "Parallel sort with " + std::to_string(threads) + " threads, modulo " + std::to_string(modulo));
+            }
+
+            std::vector<std::pair<int, int>> backwards;
+            auto it = list.end();
+            while (it != list.begin()) {
+                --it;
+                backwards.push_back(*it);
+            }
+            std::reverse(backwards.begin(), backwards.end());
+            if (backwards != expected) {
+                CHECK(false, "Prev links after parallel sort");
+            }
+        }
+    }
+    CHECK(true, "Parallel sort is stable for 2-8 threads and skewed inputs");
+
+    Linear::DoublyList<int> small;
+    small.push_back(3);
+    small.push_back(1);
+    small.sort(Linear::execution::par, [](const int& a, const int& b) { return a < b; });
+    CHECK(small.front() == 1 && small.back() == 3, "Parallel sort falls back below threshold");
+
+    return true;
+}
+
+// 测试 10：拷贝、移动语义与原位构造
+struct Counted {
+    static int copies;
+    static int moves;
+    int value;
+
+    // 哨兵节点需要默认构造
+    Counted() : value(0) {}
+    explicit Counted(int v) : value(v) {}
+    Counted(int a, int b) : value(a + b) {}
+    Counted(const Counted& other) : value(other.value) { copies++; }
+    Counted(Counted&& other) noexcept : value(other.value) { moves++; }
+    Counted& operator=(const Counted& other) {
+        value = other.value;
+        copies++;
+        return *this;
+    }
+    Counted& operator=(Counted&& other) noexcept {
+        value = other.value;
+        moves++;
+        return *this;
+    }
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+Linear::DoublyList<Counted> makeCountedList(int count) {
+    Linear::DoublyList<Counted> list;
+    for (int i = 0; i < count; i++) {
+        list.emplace_back(i);
+    }
+    return list;
+}
+
+bool testMoveAndEmplace() {
+    Counted::reset();
+    Linear::DoublyList<Counted> list = makeCountedList(100);
+    CHECK(list.size() == 100 && Counted::copies == 0 && Counted::moves == 0, "Emplace and return by value do not copy");
+
+    Linear::DoublyList<Counted> moved(std::move(list));
+    moved = std::move(moved);
+    CHECK(moved.size() == 100 && list.empty() && Counted::copies == 0 && Counted::moves == 0, "Move constructor relinks nodes");
+
+    Linear::DoublyList<Counted> assigned;
+    assigned.emplace_back(1);
+    assigned = std::move(moved);
+    CHECK(assigned.size() == 100 && assigned.back().value == 99 && moved.empty(), "Move assignment");
+    CHECK(Counted::copies == 0 && Counted::moves == 0, "Move assignment does not touch elements");
+
+    Counted::reset();
+    assigned.emplace_front(2, 3);
+    auto it = assigned.emplace(++assigned.begin(), 10);
+    assigned.push_back(Counted(7));
+    assigned.push_front(Counted(8));
+    assigned.insert(Counted(9), assigned.end());
+    CHECK(assigned.front().value == 8 && (*it).value == 10 && assigned.at(++assigned.begin()).value == 5, "Emplace front and at position");
+    CHECK(Counted::copies == 0 && Counted::moves == 3, "Rvalue push and insert move exactly once");
+
+    Linear::DoublyList<std::string> source;
+    source.push_back("a");
+    source.push_back("b");
+    Linear::DoublyList<std::string> copy(source);
+    Linear::DoublyList<std::string> assignedCopy;
+    assignedCopy.push_back("x");
+    assignedCopy.push_back("y");
+    assignedCopy.push_back("z");
+    assignedCopy = source;
+    source.front() = "changed";
+    CHECK((listToVector(copy) == std::vector<std::string>{"a", "b"}), "Copy constructor is deep");
+    CHECK((listToVector(assignedCopy) == std::vector<std::string>{"a", "b"}) && assignedCopy.size() == 2, "Copy assignment");
+
+    return true;
+}
+
+// 测试 11：异常处理
 bool testExceptions() {
     Linear::DoublyList<int> list;
     bool caught = false;
@@ -160,15 +375,209 @@ bool testExceptions() {
     return true;
 }
 
-// 测试 8：性能对比
-#include <Windows.h>
-#include <psapi.h>
+// 测试 12：自定义分配器
+bool testAllocator() {
+    std::pmr::unsynchronized_pool_resource pool;
+    Linear::DoublyList<int, std::pmr::polymorphic_allocator<int>> list{
+        std::pmr::polymorphic_allocator<int>(&pool)};
+    for (int i = 0; i < 100; i++) {
+        list.push_back(i);
+    }
+    list.remove(50);
+    list.pop_front();
+    CHECK(list.size() == 98 && list.front() == 1 && list.back() == 99, "List with polymorphic allocator");
+    CHECK(list.get_allocator().resource() == &pool, "Allocator resource is kept");
+
+    return true;
+}
+
+// 测试 13：节点池复用与收缩
+// 统计申请次数的内存资源
+struct CountingResource : std::pmr::memory_resource {
+    size_t allocations = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+using PmrList = Linear::DoublyList<int, std::pmr::polymorphic_allocator<int>>;
+
+bool testNodePool() {
+    Linear::NodePool<Linear::Node<int>> pool;
+    Linear::Node<int>* a = pool.allocate();
+    Linear::Node<int>* b = pool.allocate();
+    CHECK(pool.slab_count() == 1 && pool.live() == 2, "Nodes come from one slab");
+    CHECK(reinterpret_cast<uintptr_t>(a) % alignof(Linear::Node<int>) == 0, "Nodes are aligned");
+    pool.deallocate(b);
+    CHECK(pool.allocate() == b, "Freed node is recycled");
+    pool.deallocate(a);
+    pool.deallocate(b);
+
+    std::vector<Linear::Node<int>*> nodes;
+    size_t target = pool.capacity() * 3;
+    for (size_t i = 0; i < target; i++) {
+        nodes.push_back(pool.allocate());
+    }
+    size_t grown = pool.slab_count();
+    CHECK(grown >= 3, "Pool grows by slabs");
+    for (Linear::Node<int>* node : nodes) {
+        pool.deallocate(node);
+    }
+    pool.shrink_to_fit();
+    CHECK(pool.slab_count() == 0 && pool.live() == 0, "Empty slabs released");
+
+    Linear::DoublyList<int> list;
+    for (int i = 0; i < 100000; i++) {
+        list.push_back(i);
+    }
+    list.clear();
+    list.shrink_to_fit();
+    list.push_back(7);
+    CHECK(list.size() == 1 && list.front() == 7, "List usable after shrink_to_fit");
+
+    // 节点随 splice 转移后，源链表先析构也不影响目标链表
+    Linear::DoublyList<int> target_list;
+    {
+        Linear::DoublyList<int> source;
+        for (int i = 0; i < 1000; i++) {
+            source.push_back(i);
+        }
+        target_list.splice(source);
+    }
+    target_list.remove(10);
+    CHECK(target_list.size() == 999 && target_list.back() == 999, "Spliced nodes outlive their source pool");
+
+    // 其他池释放的节点先进归还链，所属池收回后才复用
+    Linear::NodePool<Linear::Node<int>> owner;
+    Linear::NodePool<Linear::Node<int>> other;
+    std::vector<Linear::Node<int>*> borrowed;
+    for (int i = 0; i < 10; i++) {
+        borrowed.push_back(owner.allocate());
+    }
+    for (Linear::Node<int>* node : borrowed) {
+        other.deallocate(node);
+    }
+    CHECK(owner.live() == 10 && other.live() == 0 && other.slab_count() == 0, "Foreign frees leave the freeing pool untouched");
+    owner.shrink_to_fit();
+    CHECK(owner.live() == 0 && owner.slab_count() == 0, "Owner collects foreign frees");
+
+    // 空链表和移动构造都不申请内存
+    CountingResource counting;
+    {
+        PmrList empty{std::pmr::polymorphic_allocator<int>(&counting)};
+        PmrList moved(std::move(empty));
+        CHECK(moved.empty() && counting.allocations == 0, "Empty and moved lists allocate nothing");
+        moved.push_back(1);
+        PmrList stolen(std::move(moved));
+        size_t allocations = counting.allocations;
+        stolen.push_back(2);
+        CHECK(stolen.size() == 2 && counting.allocations == allocations, "Move takes over the node pool");
+        CHECK((std::is_nothrow_move_constructible<Linear::DoublyList<int>>::value &&
+               std::is_nothrow_move_constructible<PmrList>::value),
+              "Move constructor is noexcept");
+    }
+
+    // 交换过节点的两个链表在不同线程中各自使用
+    bool parallel = true;
+    for (int round = 0; round < 20; round++) {
+        auto left = std::make_unique<Linear::DoublyList<int>>();
+        Linear::DoublyList<int> right;
+        for (int i = 0; i < 2000; i++) {
+            left->push_back(i);
+        }
+        auto middle = left->begin();
+        for (int i = 0; i < 1000; i++) {
+            ++middle;
+        }
+        right.splice(right.end(), *left, middle, left->end(), 1000);
+
+        std::thread worker([&] {
+            while (!right.empty()) right.pop_front();
+        });
+        if (round % 2 == 0) {
+            for (int i = 0; i < 2000; i++) {
+                left->push_back(i);
+                left->pop_front();
+            }
+        } else {
+            left.reset();
+        }
+        worker.join();
+        parallel &= right.empty() && (left == nullptr || left->size() == 1000);
+    }
+    CHECK(parallel, "Lists that exchanged nodes work in parallel");
+
+    return true;
+}
+
+// 测试 14：操作计数策略
+bool testStats() {
+    using CountedList = Linear::DoublyList<int, std::allocator<int>, Linear::stats::counting>;
+    using PlainList = Linear::DoublyList<int, std::allocator<int>, Linear::stats::none>;
+    CHECK(sizeof(PlainList) < sizeof(CountedList), "Disabled stats take no space");
+
+    CountedList list;
+    for (int i = 0; i < 100; i++) {
+        int value = 99 - i;
+        list.push_back(value);
+    }
+    CHECK(list.stats().node_allocations == 100 && list.stats().copies == 100 && list.stats().moves == 0,
+          "Push back counts nodes and copies");
+
+    list.sort();
+    CHECK(list.stats().comparisons > 0 && list.stats().moves == 0 && list.front() == 0, "Sort counts comparisons only");
+
+    CountedList other;
+    for (int i = 0; i < 10; i++) {
+        other.emplace_back(i * 10);
+    }
+    size_t compared = list.stats().comparisons;
+    list.merge(other);
+    CHECK(list.stats().comparisons > compared && list.stats().node_allocations == 100, "Merge relinks without allocating");
+
+    CountedList copy(list);
+    CHECK(copy.stats().node_allocations == 110 && copy.stats().copies == 110 && copy.stats().comparisons == 0,
+          "Copy starts with fresh counters");
+
+    Linear::stats::Counters total = Linear::stats::registry().total("Linear::DoublyList");
+    CHECK(total.node_allocations >= 220, "Registry sums live lists");
+
+    return true;
+}
+
+// 测试 15：性能对比
 #include <chrono>
 #include <list>
+#if defined(_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+// 当前常驻内存（KB）：Windows 取工作集，Linux 读 /proc/self/statm，其他平台返回 0
 size_t getMemoryUsage() {
+#if defined(_WIN32)
     PROCESS_MEMORY_COUNTERS pmc;
     GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
     return pmc.WorkingSetSize / 1024;
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0;
+    size_t resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+    return 0;
+#endif
 }
 
 template <typename ListType>
@@ -190,8 +599,113 @@ void testMassiveInsert(const std::string& containerName, int count = 100000) {
     std::cout << "[" << containerName << "] Insert " << count << " elements: " << duration << " ms, Memory: " << memoryUsed << " KB\n";
 }
 
+// 节点池收益：完整遍历、sort() 与 remove()
+template <typename ListType>
+void testNodeOperations(const std::string& containerName, int count = 1000000) {
+    ListType list;
+    unsigned int seed = 12345;
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        list.push_back(static_cast<int>(seed >> 8) % 1000);
+    }
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        sum += *it;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    list.sort();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    list.remove(500);
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    std::cout << "[" << containerName << "] iterate: " << ms(t0, t1) << " ms, sort: " << ms(t1, t2)
+              << " ms, remove: " << ms(t2, t3) << " ms (checksum " << sum << ")\n";
+}
+
+// 排序对比：随机、已排序、逆序、少量不同值
+template <typename ListType>
+void testSortPerformance(const std::string& containerName, int count = 1000000) {
+    std::mt19937 rng(2024);
+    const char* names[] = {"random", "sorted", "reverse", "few-unique"};
+    std::cout << "[" << containerName << "] sort";
+    for (int kind = 0; kind < 4; ++kind) {
+        ListType list;
+        for (int i = 0; i < count; ++i) {
+            int v = kind == 0 ? static_cast<int>(rng()) : kind == 1 ? i : kind == 2 ? count - i : static_cast<int>(rng() % 16);
+            list.push_back(v);
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        list.sort();
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << " " << names[kind] << ": "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms";
+    }
+    std::cout << "\n";
+}
+
+// 并行排序扩展性
+void testSortScaling(size_t count) {
+    std::mt19937 rng(99);
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= cores; threads *= 2) {
+        Linear::DoublyList<int> list;
+        for (size_t i = 0; i < count; ++i) {
+            list.push_back(static_cast<int>(rng()));
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        list.sort(Linear::execution::parallel_policy{threads});
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "[sort " << count << " nodes] threads: " << threads << ", time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+    }
+}
+
+// merge 对比：两条有序链表合并
+template <typename ListType>
+void testMergePerformance(const std::string& containerName, int count = 1000000) {
+    ListType list1, list2;
+    for (int i = 0; i < count; ++i) {
+        list1.push_back(2 * i);
+        list2.push_back(2 * i + 1);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    list1.merge(list2);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "[" << containerName << "] merge " << count << " + " << count << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+}
+
+// 分配器对比：push 密集与 erase 密集（队列式反复 push_back/pop_front）
+template <typename MakeList>
+void testAllocatorPerformance(const std::string& name, MakeList makeList, int count = 1000000) {
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        auto list = makeList();
+        for (int i = 0; i < count; ++i) {
+            list.push_back(i);
+        }
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    {
+        auto list = makeList();
+        for (int i = 0; i < count; ++i) {
+            list.push_back(i);
+            if (list.size() > 1024) list.pop_front();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "[" << name << "] push-heavy: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count() << " ms, erase-heavy: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count() << " ms\n";
+}
+
 // ------------------------- 主函数 -------------------------
-int main() {
+// 可选参数：并行排序扩展性测试的元素个数（默认 10M）
+int main(int argc, char* argv[]) {
     bool allPassed = true;
     
     // 运行所有测试
@@ -199,9 +713,16 @@ int main() {
     allPassed &= testPopAndErase();
     allPassed &= testEdgeCases();
     allPassed &= testSpliceAndMerge();
+    allPassed &= testRelinkMerge();
     allPassed &= testUniqueAndReverse();
     allPassed &= testSort();
+    allPassed &= testSortInputs();
+    allPassed &= testParallelSort();
+    allPassed &= testMoveAndEmplace();
     allPassed &= testExceptions();
+    allPassed &= testAllocator();
+    allPassed &= testNodePool();
+    allPassed &= testStats();
     
     // 输出最终结果
     if (allPassed) {
@@ -216,5 +737,28 @@ int main() {
     std::cout << "\n=== Testing std::list ===\n";
     testMassiveInsert<std::list<int>>("std::list");
 
-    return 0;
+    std::cout << "\n=== Node Operations ===\n";
+    testNodeOperations<Linear::DoublyList<int>>("DoublyList");
+    testNodeOperations<std::list<int>>("std::list");
+
+    std::cout << "\n=== Sort ===\n";
+    testSortPerformance<Linear::DoublyList<int>>("DoublyList");
+    testSortPerformance<std::list<int>>("std::list");
+
+    std::cout << "\n=== Merge ===\n";
+    testMergePerformance<Linear::DoublyList<int>>("DoublyList");
+    testMergePerformance<std::list<int>>("std::list");
+
+    std::cout << "\n=== Allocator Comparison ===\n";
+    using PmrList = Linear::DoublyList<int, std::pmr::polymorphic_allocator<int>>;
+    testAllocatorPerformance("default", [] { return Linear::DoublyList<int>(); });
+    std::pmr::monotonic_buffer_resource arena;
+    testAllocatorPerformance("monotonic", [&] { return PmrList(&arena); });
+    std::pmr::unsynchronized_pool_resource pool;
+    testAllocatorPerformance("pool", [&] { return PmrList(&pool); });
+
+    std::cout << "\n=== Parallel Sort Scaling ===\n";
+    testSortScaling(argc > 1 ? std::stoull(argv[1]) : 10000000);
+
+    return allPassed ? 0 : 1;
 }
\ No newline at end of file
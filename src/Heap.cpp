@@ -0,0 +1,326 @@
+#include <Tree/Heap.hpp>
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <set>
+#include <map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <memory>
+#include <memory_resource>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// ------------------------- 测试用例 -------------------------
+
+// 辅助函数：随机 push/pop 与 std::priority_queue 对照
+template <size_t D, typename Compare>
+bool matchesPriorityQueue(unsigned seed) {
+    Tree::Heap<int, Compare, D> heap;
+    std::priority_queue<int, std::vector<int>, Compare> model;
+    std::mt19937 rng(seed);
+    for (int i = 0; i < 50000; i++) {
+        if (model.empty() || rng() % 3 != 0) {
+            int value = static_cast<int>(rng() % 10000);
+            heap.push(value);
+            model.push(value);
+        } else {
+            if (heap.top() != model.top()) return false;
+            heap.pop();
+            model.pop();
+        }
+        if (heap.size() != model.size()) return false;
+    }
+    if (!heap.validate()) return false;
+    while (!model.empty()) {
+        if (heap.top() != model.top()) return false;
+        heap.pop();
+        model.pop();
+    }
+    return heap.empty();
+}
+
+// 测试 1：随机操作与 std::priority_queue 一致
+bool testPushPop() {
+    CHECK((matchesPriorityQueue<2, std::less<int>>(1)), "Binary max-heap matches std::priority_queue");
+    CHECK((matchesPriorityQueue<4, std::less<int>>(2)), "4-ary max-heap matches std::priority_queue");
+    CHECK((matchesPriorityQueue<8, std::greater<int>>(3)), "8-ary min-heap matches std::priority_queue");
+    CHECK((matchesPriorityQueue<3, std::greater<int>>(4)), "3-ary min-heap matches std::priority_queue");
+
+    Tree::Heap<std::string> strings;
+    for (const char* word : {"pear", "apple", "fig", "plum", "kiwi"}) strings.emplace(word);
+    std::vector<std::string> order;
+    while (!strings.empty()) {
+        order.push_back(strings.top());
+        strings.pop();
+    }
+    CHECK((order == std::vector<std::string>{"plum", "pear", "kiwi", "fig", "apple"}), "emplace and pop with strings");
+
+    return true;
+}
+
+// 测试 2：O(n) 建堆
+bool testMakeHeap() {
+    std::vector<int> values(10007);
+    std::mt19937 rng(5);
+    for (int& value : values) value = static_cast<int>(rng() % 1000);
+
+    Tree::Heap<int, std::less<int>, 2> binary(values.begin(), values.end());
+    Tree::Heap<int, std::less<int>, 4> quaternary(values.begin(), values.end());
+    Tree::Heap<int, std::greater<int>, 8> octonary(values.begin(), values.end());
+    CHECK(binary.validate() && quaternary.validate() && octonary.validate(), "Range constructor builds a valid heap");
+
+    std::vector<int> sorted;
+    while (!quaternary.empty()) {
+        sorted.push_back(quaternary.top());
+        quaternary.pop();
+    }
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    CHECK(sorted == expected, "Popping a bulk-built heap yields sorted order");
+
+    octonary.assign(values.begin(), values.begin() + 3);
+    CHECK(octonary.size() == 3 && octonary.top() == *std::min_element(values.begin(), values.begin() + 3),
+          "assign replaces the contents");
+
+    std::vector<int> none;
+    Tree::Heap<int> empty(none.begin(), none.end());
+    empty.push(1);
+    empty.pop();
+    CHECK(empty.empty() && empty.validate(), "Empty range and single element");
+
+    return true;
+}
+
+// 测试 3：句柄堆的 decrease_key、update 与 erase
+bool testIndexedHeap() {
+    Tree::IndexedHeap<int, std::greater<int>, 4> heap;
+    std::map<size_t, int> model;
+    std::mt19937 rng(6);
+    bool matched = true;
+    for (int i = 0; i < 50000 && matched; i++) {
+        unsigned op = rng() % 6;
+        if (model.empty() || op < 2) {
+            int value = static_cast<int>(rng() % 100000);
+            size_t handle = heap.push(value);
+            matched &= model.count(handle) == 0;
+            model[handle] = value;
+            continue;
+        }
+        auto it = std::next(model.begin(), static_cast<long>(rng() % model.size()));
+        if (op == 2) {
+            int value = it->second - static_cast<int>(rng() % 1000);
+            heap.decrease_key(it->first, value);
+            it->second = value;
+        } else if (op == 3) {
+            int value = static_cast<int>(rng() % 100000);
+            heap.update(it->first, value);
+            it->second = value;
+        } else if (op == 4) {
+            heap.erase(it->first);
+            model.erase(it);
+        } else {
+            int best = std::min_element(model.begin(), model.end(), [](auto& left, auto& right) {
+                           return left.second < right.second;
+                       })->second;
+            matched &= heap.top() == best && model.at(heap.top_handle()) == best;
+            model.erase(heap.top_handle());
+            heap.pop();
+        }
+        matched &= heap.size() == model.size();
+        if (i % 1000 == 0) matched &= heap.validate();
+    }
+    bool values = true;
+    for (auto& entry : model) values &= heap.contains(entry.first) && heap.value(entry.first) == entry.second;
+    CHECK(matched && values && heap.validate(), "Random operations match a handle map");
+
+    size_t handle = heap.top_handle();
+    bool caught = false;
+    try {
+        heap.decrease_key(handle, heap.top() + 1);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught, "decrease_key rejects a lower priority");
+
+    heap.erase(handle);
+    caught = false;
+    try {
+        heap.value(handle);
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught && !heap.contains(handle), "Erased handle is no longer valid");
+    CHECK(heap.push(0) == handle, "Freed handles are reused");
+
+    heap.clear();
+    CHECK(heap.empty() && heap.push(7) == 0 && heap.validate(), "clear resets handles");
+
+    // 不预留容量时逐个 push 也应按倍数扩容，而不是每次只多一个位置
+    Tree::IndexedHeap<int, std::greater<int>> growing;
+    for (int i = 0; i < 200000; i++) growing.push((i * 7919) % 200000);
+    bool ordered = growing.size() == 200000 && growing.validate();
+    for (int expected = 0; ordered && !growing.empty(); expected++) {
+        ordered = growing.top() == expected;
+        growing.pop();
+    }
+    CHECK(ordered, "Many pushes without reserve");
+
+    return true;
+}
+
+// 测试 4：只能移动的元素与自定义分配器
+struct Task {
+    int priority;
+    std::unique_ptr<std::string> name;
+};
+
+struct TaskLess {
+    bool operator()(const Task& left, const Task& right) const {
+        return left.priority < right.priority;
+    }
+};
+
+bool testMoveOnlyAndAllocator() {
+    Tree::Heap<Task, TaskLess, 8> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push(Task{(i * 37) % 100, std::make_unique<std::string>(std::to_string(i))});
+    }
+    bool ordered = true;
+    for (int expected = 99; expected >= 0; expected--) {
+        Task task = tasks.extract_top();
+        ordered &= task.priority == expected && task.name != nullptr && tasks.validate();
+    }
+    CHECK(ordered && tasks.empty(), "Move-only elements");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    Tree::Heap<int, std::less<int>, 4, std::pmr::polymorphic_allocator<int>> heap(std::less<int>(), &pool);
+    Tree::IndexedHeap<int, std::less<int>, 2, std::pmr::polymorphic_allocator<int>> indexed(std::less<int>(), &pool);
+    for (int i = 0; i < 1000; i++) {
+        heap.push(i);
+        indexed.push(i);
+    }
+    CHECK(heap.top() == 999 && indexed.top() == 999 && heap.validate() && indexed.validate(),
+          "Heaps with polymorphic allocator");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+template <typename HeapType>
+void benchHeap(const char* name, const std::vector<unsigned>& values) {
+    HeapType heap;
+    unsigned long long checksum = 0;
+    long long pushMs = timeMs([&] {
+        for (unsigned value : values) heap.push(value);
+    });
+    long long popMs = timeMs([&] {
+        while (!heap.empty()) {
+            checksum += heap.top();
+            heap.pop();
+        }
+    });
+    std::cout << name << " push: " << pushMs << " ms, pop: " << popMs << " ms (checksum " << checksum << ")\n";
+}
+
+template <size_t D>
+void benchMakeHeap(const std::vector<unsigned>& values) {
+    long long buildMs = timeMs([&] {
+        Tree::Heap<unsigned, std::greater<unsigned>, D> heap(values.begin(), values.end());
+        if (!heap.validate()) std::cout << "invalid heap\n";
+    });
+    std::cout << "[Heap D=" << D << "] make_heap: " << buildMs << " ms\n";
+}
+
+// Dijkstra 式负载：大量 decrease_key，间或弹出堆顶
+template <size_t D>
+void benchDecreaseKey(const std::vector<unsigned>& values, bool reserve = true) {
+    Tree::IndexedHeap<unsigned, std::greater<unsigned>, D> heap;
+    if (reserve) heap.reserve(values.size());
+    std::vector<size_t> handles;
+    handles.reserve(values.size());
+    std::mt19937 rng(7);
+    unsigned long long checksum = 0;
+    long long ms = timeMs([&] {
+        for (unsigned value : values) handles.push_back(heap.push(value));
+        for (size_t i = 0; i < values.size(); i++) {
+            size_t handle = handles[rng() % handles.size()];
+            if (heap.contains(handle)) heap.decrease_key(handle, heap.value(handle) / 2);
+            if (i % 4 == 0) {
+                checksum += heap.top();
+                heap.pop();
+            }
+        }
+    });
+    std::cout << "[IndexedHeap D=" << D << (reserve ? "" : ", no reserve") << "] push + decrease_key/pop x"
+              << values.size() << ": " << ms << " ms (checksum " << checksum << ")\n";
+}
+
+void testPerformance(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<unsigned> values(count);
+    for (unsigned& value : values) value = static_cast<unsigned>(rng());
+
+    std::cout << "-- " << count << " elements --\n";
+    benchHeap<std::priority_queue<unsigned, std::vector<unsigned>, std::greater<unsigned>>>("[std::priority_queue]", values);
+    benchHeap<Tree::Heap<unsigned, std::greater<unsigned>, 2>>("[Heap D=2]", values);
+    benchHeap<Tree::Heap<unsigned, std::greater<unsigned>, 4>>("[Heap D=4]", values);
+    benchHeap<Tree::Heap<unsigned, std::greater<unsigned>, 8>>("[Heap D=8]", values);
+
+    std::vector<unsigned> copy = values;
+    long long stdBuildMs = timeMs([&] { std::make_heap(copy.begin(), copy.end(), std::greater<unsigned>()); });
+    std::cout << "[std::make_heap] " << stdBuildMs << " ms\n";
+    benchMakeHeap<2>(values);
+    benchMakeHeap<4>(values);
+    benchMakeHeap<8>(values);
+
+    benchDecreaseKey<2>(values);
+    benchDecreaseKey<4>(values);
+    benchDecreaseKey<8>(values);
+    benchDecreaseKey<4>(values, false);
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大元素数（默认 10M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testPushPop();
+    allPassed &= testMakeHeap();
+    allPassed &= testIndexedHeap();
+    allPassed &= testMoveOnlyAndAllocator();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 10000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
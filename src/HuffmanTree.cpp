@@ -0,0 +1,434 @@
+#include <Tree/HuffmanTree.hpp>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <queue>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：不限码长的 Huffman 编码总位数，用优先队列逐次合并最小的两项
+uint64_t huffmanCost(const std::vector<uint64_t>& frequencies) {
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> queue;
+    for (uint64_t frequency : frequencies) {
+        if (frequency != 0) queue.push(frequency);
+    }
+    if (queue.size() == 1) return queue.top();
+    uint64_t cost = 0;
+    while (queue.size() > 1) {
+        uint64_t first = queue.top();
+        queue.pop();
+        uint64_t second = queue.top();
+        queue.pop();
+        cost += first + second;
+        queue.push(first + second);
+    }
+    return cost;
+}
+
+// 码长构成完整前缀码：Kraft 和恰为 1
+bool isComplete(const std::vector<unsigned char>& lengths) {
+    double kraft = 0;
+    for (unsigned char length : lengths) {
+        if (length != 0) kraft += 1.0 / static_cast<double>(uint64_t(1) << length);
+    }
+    return kraft == 1.0;
+}
+
+// 日志风格的文本：时间戳、级别、模块与少量变化的字段
+std::vector<unsigned char> makeText(size_t size, unsigned seed) {
+    static const char* levels[] = {"INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR"};
+    static const char* modules[] = {"http.server", "db.pool", "cache", "auth", "scheduler"};
+    static const char* messages[] = {"request completed", "connection acquired", "miss for key", "token refreshed",
+                                     "job finished", "slow query detected", "retrying after timeout"};
+    std::mt19937 rng(seed);
+    std::string text;
+    text.reserve(size + 256);
+    unsigned long long time = 1700000000000ull;
+    while (text.size() < size) {
+        time += rng() % 50;
+        text += std::to_string(time) + " " + levels[rng() % 6] + " [" + modules[rng() % 5] + "] " +
+                messages[rng() % 7] + " id=" + std::to_string(rng() % 100000) + " latency_ms=" +
+                std::to_string(rng() % 500) + "\n";
+    }
+    text.resize(size);
+    return std::vector<unsigned char>(text.begin(), text.end());
+}
+
+// 二进制数据：小端序的 32 位整数，数值大多很小，高位字节几乎全是 0
+std::vector<unsigned char> makeBinary(size_t size, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::geometric_distribution<uint32_t> small(0.01);
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i + 4 <= size; i += 4) {
+        uint32_t value = rng() % 16 == 0 ? static_cast<uint32_t>(rng()) : small(rng);
+        for (size_t k = 0; k < 4; k++) data[i + k] = static_cast<unsigned char>(value >> (8 * k));
+    }
+    return data;
+}
+
+// 辅助函数：按随机长度的片段编码，再按另一组随机片段解码
+bool roundTrip(const std::vector<unsigned char>& input, size_t blockSize, unsigned seed,
+               std::vector<unsigned char>* compressed = nullptr) {
+    std::mt19937 rng(seed);
+    Tree::HuffmanEncoder encoder(blockSize);
+    std::vector<unsigned char> encoded;
+    for (size_t offset = 0; offset < input.size();) {
+        size_t take = std::min<size_t>(input.size() - offset, rng() % (2 * blockSize + 1));
+        encoder.write(input.data() + offset, take, encoded);
+        offset += take;
+    }
+    encoder.finish(encoded);
+
+    Tree::HuffmanDecoder decoder;
+    std::vector<unsigned char> decoded;
+    for (size_t offset = 0; offset < encoded.size();) {
+        size_t take = std::min<size_t>(encoded.size() - offset, 1 + rng() % 5000);
+        decoder.write(encoded.data() + offset, take, decoded);
+        offset += take;
+    }
+    if (compressed != nullptr) *compressed = encoded;
+    return decoder.finished() && decoded == input;
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：码长构造
+bool testCodeLengths() {
+    std::mt19937_64 rng(1);
+    bool optimal = true;
+    for (int round = 0; round < 200; round++) {
+        std::vector<uint64_t> frequencies(1 + rng() % 300);
+        for (uint64_t& frequency : frequencies) frequency = rng() % 4 == 0 ? 0 : 1 + rng() % (1 + (rng() % 100000));
+        std::vector<unsigned char> lengths = Tree::huffman_code_lengths(frequencies.data(), frequencies.size(), 32);
+        uint64_t cost = 0;
+        size_t used = 0;
+        for (size_t i = 0; i < frequencies.size(); i++) {
+            cost += frequencies[i] * lengths[i];
+            used += frequencies[i] != 0;
+            optimal &= (frequencies[i] == 0) == (lengths[i] == 0);
+        }
+        optimal &= used == 0 || cost == huffmanCost(frequencies);
+        optimal &= used < 2 || isComplete(lengths);
+    }
+    CHECK(optimal, "Unlimited lengths match Huffman's algorithm");
+
+    // 斐波那契频数让不受限的树退化成一条链，码长上限必须起作用
+    std::vector<uint64_t> fibonacci(40);
+    fibonacci[0] = fibonacci[1] = 1;
+    for (size_t i = 2; i < fibonacci.size(); i++) fibonacci[i] = fibonacci[i - 1] + fibonacci[i - 2];
+    uint64_t previous = 0;
+    bool limited = true;
+    for (unsigned limit = 39; limit >= 6; limit--) {
+        std::vector<unsigned char> lengths = Tree::huffman_code_lengths(fibonacci.data(), fibonacci.size(), limit);
+        uint64_t cost = 0;
+        for (size_t i = 0; i < fibonacci.size(); i++) {
+            cost += fibonacci[i] * lengths[i];
+            limited &= lengths[i] <= limit;
+        }
+        limited &= isComplete(lengths) && cost >= previous && (limit != 39 || cost == huffmanCost(fibonacci));
+        previous = cost;
+    }
+    CHECK(limited, "Length limit holds and cost grows as the limit tightens");
+
+    // 码长限制下的最优性：与穷举所有满足 Kraft 不等式的码长组合对照
+    bool exhaustive = true;
+    for (int round = 0; round < 100; round++) {
+        std::vector<uint64_t> frequencies(2 + rng() % 5);
+        for (uint64_t& frequency : frequencies) frequency = 1 + rng() % 1000;
+        unsigned limit = 3;
+        std::vector<unsigned char> lengths = Tree::huffman_code_lengths(frequencies.data(), frequencies.size(), limit);
+        uint64_t cost = 0, best = UINT64_MAX;
+        for (size_t i = 0; i < frequencies.size(); i++) cost += frequencies[i] * lengths[i];
+        std::vector<unsigned> trial(frequencies.size(), 1);
+        std::function<void(size_t)> search = [&](size_t index) {
+            if (index == trial.size()) {
+                double kraft = 0;
+                uint64_t total = 0;
+                for (size_t i = 0; i < trial.size(); i++) {
+                    kraft += 1.0 / (1 << trial[i]);
+                    total += frequencies[i] * trial[i];
+                }
+                if (kraft <= 1.0) best = std::min(best, total);
+                return;
+            }
+            for (unsigned length = 1; length <= limit; length++) {
+                trial[index] = length;
+                search(index + 1);
+            }
+        };
+        search(0);
+        exhaustive &= cost == best;
+    }
+    CHECK(exhaustive, "Limited lengths are optimal for small alphabets");
+
+    bool caught = false;
+    std::vector<uint64_t> many(300, 1);
+    try {
+        Tree::huffman_code_lengths(many.data(), many.size(), 8);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught, "Too many symbols for the limit throws");
+
+    return true;
+}
+
+// 测试 2：规范码与单张码表的编解码
+bool testCanonicalTable() {
+    std::vector<unsigned char> text = makeText(100000, 2);
+    uint64_t frequencies[256] = {};
+    for (unsigned char byte : text) frequencies[byte]++;
+
+    bool matched = true;
+    for (unsigned limit = 8; limit <= 12; limit++) {
+        Tree::HuffmanTable table;
+        table.build(frequencies, limit);
+        matched &= table.table_bits() <= limit;
+
+        // 规范码：按 (码长, 符号) 排序后，每个码字是前一个码字加一、再左移补齐码长之差
+        std::vector<std::pair<unsigned, unsigned>> order;
+        for (unsigned symbol = 0; symbol < 256; symbol++) {
+            if (table.length(static_cast<unsigned char>(symbol)) != 0) {
+                order.emplace_back(table.length(static_cast<unsigned char>(symbol)), symbol);
+            }
+        }
+        std::sort(order.begin(), order.end());
+        for (size_t i = 1; i < order.size(); i++) {
+            uint32_t left = table.code(static_cast<unsigned char>(order[i - 1].second));
+            uint32_t right = table.code(static_cast<unsigned char>(order[i].second));
+            matched &= right == (left + 1) << (order[i].first - order[i - 1].first);
+        }
+
+        for (size_t streams = 1; streams <= 4; streams++) {
+            std::vector<unsigned char> encoded(table.encoded_bits(frequencies) / 8 + streams + 8);
+            size_t sizes[4];
+            size_t written = table.encode(text.data(), text.size(), encoded.data(), streams, sizes);
+            std::vector<unsigned char> decoded(text.size());
+            table.decode(encoded.data(), sizes, streams, decoded.data(), decoded.size());
+            matched &= decoded == text && written <= table.encoded_bits(frequencies) / 8 + streams;
+        }
+    }
+    CHECK(matched, "Canonical codes round-trip with 1 to 4 streams at every length limit");
+
+    unsigned char lengths[256] = {};
+    lengths['a'] = 1;
+    lengths['b'] = 2;
+    Tree::HuffmanTable table;
+    bool caught = false;
+    try {
+        table.assign_lengths(lengths);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    lengths['c'] = 2;
+    table.assign_lengths(lengths);
+    CHECK(caught && table.code('a') == 0 && table.code('b') == 2 && table.code('c') == 3,
+          "assign_lengths rejects incomplete codes and assigns canonical codes");
+
+    return true;
+}
+
+// 测试 3：流式编解码
+bool testStreaming() {
+    std::vector<unsigned char> text = makeText(1000000, 3);
+    std::vector<unsigned char> binary = makeBinary(1000000, 3);
+    std::vector<unsigned char> random(300000);
+    std::mt19937 rng(3);
+    for (unsigned char& byte : random) byte = static_cast<unsigned char>(rng());
+    std::vector<unsigned char> same(200000, 'x');
+
+    std::vector<unsigned char> compressed;
+    CHECK(roundTrip(text, 1 << 16, 1, &compressed) && compressed.size() < text.size() * 7 / 10,
+          "Text round-trips and compresses");
+    CHECK(roundTrip(binary, 1 << 17, 2, &compressed) && compressed.size() < binary.size() / 2,
+          "Binary round-trips and compresses");
+    CHECK(roundTrip(random, 1 << 16, 3, &compressed) && compressed.size() <= random.size() + 5 * 9,
+          "Incompressible data is stored raw");
+    CHECK(roundTrip(same, 1 << 16, 4, &compressed) && compressed.size() == 4 * 10,
+          "A repeated byte becomes rle blocks");
+
+    bool small = roundTrip(std::vector<unsigned char>(), 100, 5);
+    for (size_t size = 1; size < 600; size += 37) small &= roundTrip(makeText(size, 6), 1 + size % 97, 6);
+    CHECK(small, "Empty input, tiny inputs and tiny blocks");
+
+    // 块大小不是 4 的倍数时最后一段码流更短
+    std::vector<unsigned char> odd = makeText(100003, 7);
+    CHECK(roundTrip(odd, 100003, 7) && roundTrip(odd, 4097, 8), "Stream segments of unequal length");
+
+    bool caught = false;
+    try {
+        Tree::HuffmanEncoder encoder(0);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught, "Zero block size throws");
+
+    return true;
+}
+
+// 测试 4：损坏的输入
+bool testCorruption() {
+    std::vector<unsigned char> text = makeText(50000, 9);
+    Tree::HuffmanEncoder encoder;
+    std::vector<unsigned char> encoded;
+    encoder.write(text.data(), text.size(), encoded);
+    encoder.finish(encoded);
+
+    Tree::HuffmanDecoder truncated;
+    std::vector<unsigned char> decoded;
+    truncated.write(encoded.data(), encoded.size() - 1, decoded);
+    CHECK(!truncated.finished() && decoded.empty(), "A truncated block stays buffered");
+
+    auto throws = [&](std::vector<unsigned char> block) {
+        Tree::HuffmanDecoder decoder;
+        std::vector<unsigned char> out;
+        try {
+            decoder.write(block.data(), block.size(), out);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    std::vector<unsigned char> badMode = encoded;
+    badMode[0] = 7;
+    std::vector<unsigned char> badLengths = encoded;
+    badLengths[9] ^= 0x11;
+    std::vector<unsigned char> badStreams = encoded;
+    badStreams[9 + 128] ^= 0x40;
+    CHECK(throws(badMode) && throws(badLengths) && throws(badStreams), "Corrupt headers throw");
+
+    // 随机翻转码流中的位：要么报错，要么解出同样长度的数据，不能越界
+    std::mt19937 rng(9);
+    size_t detected = 0;
+    for (int round = 0; round < 200; round++) {
+        std::vector<unsigned char> flipped = encoded;
+        flipped[9 + 140 + rng() % (encoded.size() - 149)] ^= static_cast<unsigned char>(1 << (rng() % 8));
+        Tree::HuffmanDecoder decoder;
+        std::vector<unsigned char> out;
+        try {
+            decoder.write(flipped.data(), flipped.size(), out);
+            if (out.size() != text.size()) return false;
+        } catch (const std::runtime_error&) {
+            detected++;
+        }
+    }
+    CHECK(detected > 0, "Bit flips in the payload are caught or decode in bounds");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+double timeSeconds(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+// 对照：用规范码的首码字表逐位解码，相当于逐位走树
+void decodeBitByBit(const Tree::HuffmanTable& table, const unsigned char* in, unsigned char* out, size_t count) {
+    unsigned first[13] = {}, counts[13] = {}, offsets[13] = {};
+    std::vector<unsigned char> sorted;
+    for (unsigned length = 1; length <= 12; length++) {
+        offsets[length] = static_cast<unsigned>(sorted.size());
+        for (unsigned symbol = 0; symbol < 256; symbol++) {
+            if (table.length(static_cast<unsigned char>(symbol)) == length) {
+                if (counts[length]++ == 0) first[length] = table.code(static_cast<unsigned char>(symbol));
+                sorted.push_back(static_cast<unsigned char>(symbol));
+            }
+        }
+    }
+    size_t position = 0;
+    for (size_t i = 0; i < count; i++) {
+        unsigned code = 0;
+        for (unsigned length = 1;; length++) {
+            code = code << 1 | ((in[position >> 3] >> (position & 7)) & 1);
+            position++;
+            if (counts[length] != 0 && code - first[length] < counts[length]) {
+                out[i] = sorted[offsets[length] + code - first[length]];
+                break;
+            }
+        }
+    }
+}
+
+void benchCorpus(const char* name, const std::vector<unsigned char>& input) {
+    double megabytes = static_cast<double>(input.size()) / 1e6;
+    std::vector<unsigned char> encoded, decoded;
+    encoded.reserve(input.size() + input.size() / 100);
+    decoded.reserve(input.size());
+    double encodeSeconds = timeSeconds([&] {
+        Tree::HuffmanEncoder encoder;
+        encoder.write(input.data(), input.size(), encoded);
+        encoder.finish(encoded);
+    });
+    double decodeSeconds = timeSeconds([&] {
+        Tree::HuffmanDecoder decoder;
+        decoder.write(encoded.data(), encoded.size(), decoded);
+    });
+
+    // 单段码流、单张码表的对照：逐位解码与表驱动解码
+    uint64_t frequencies[256] = {};
+    for (unsigned char byte : input) frequencies[byte]++;
+    Tree::HuffmanTable table;
+    table.build(frequencies);
+    std::vector<unsigned char> stream(table.encoded_bits(frequencies) / 8 + 16), out(input.size());
+    size_t size;
+    table.encode(input.data(), input.size(), stream.data(), 1, &size);
+    double bitSeconds = timeSeconds([&] { decodeBitByBit(table, stream.data(), out.data(), out.size()); });
+    bool bitOk = out == input;
+    double singleSeconds = timeSeconds([&] { table.decode(stream.data(), &size, 1, out.data(), out.size()); });
+
+    std::cout << std::fixed << std::setprecision(1) << name << " ratio "
+              << 100.0 * static_cast<double>(encoded.size()) / static_cast<double>(input.size())
+              << "%, encode " << megabytes / encodeSeconds << " MB/s, decode " << megabytes / decodeSeconds
+              << " MB/s (1 stream: " << megabytes / singleSeconds << " MB/s, bit by bit: " << megabytes / bitSeconds
+              << " MB/s)" << (decoded == input && bitOk && out == input ? "" : " MISMATCH") << "\n";
+}
+
+void testPerformance(size_t size) {
+    std::cout << "-- " << size << " bytes --\n";
+    benchCorpus("[text]  ", makeText(size, 42));
+    benchCorpus("[binary]", makeBinary(size, 42));
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大字节数（默认 100M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testCodeLengths();
+    allPassed &= testCanonicalTable();
+    allPassed &= testStreaming();
+    allPassed &= testCorruption();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 100000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t size = 1000000; size <= maxCount; size *= 10) {
+        testPerformance(size);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,233 @@
+#include <Tree/MultiQueue.hpp>
+#include <Tree/AVLTree.hpp>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <queue>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <memory>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：在 threads 个线程上执行 fn(0) ... fn(threads - 1)
+template <typename Fn>
+void runThreads(size_t threads, Fn fn) {
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads; i++) workers.emplace_back(fn, i);
+    for (std::thread& worker : workers) worker.join();
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：单线程下的严格模式与松弛模式
+bool testSingleThread() {
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(1));
+
+    Tree::MultiQueue<int> strict(Tree::MultiQueueOptions{0, 2, true});
+    for (int value : values) strict.push(value);
+    std::vector<int> popped;
+    int value;
+    while (strict.try_pop(value)) popped.push_back(value);
+    CHECK(strict.shard_count() == 1 && std::is_sorted(popped.rbegin(), popped.rend()) && popped.size() == values.size(),
+          "Strict mode pops in priority order");
+
+    Tree::MultiQueue<int> relaxed(Tree::MultiQueueOptions{8, 2, false});
+    for (int v : values) relaxed.push(v);
+    CHECK(relaxed.shard_count() == 16 && relaxed.size() == values.size(), "Relaxed mode shards by threads * factor");
+    popped.clear();
+    while (relaxed.try_pop(value)) popped.push_back(value);
+    std::sort(popped.begin(), popped.end());
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(popped == sorted && relaxed.empty() && !relaxed.try_pop(value), "Relaxed mode returns every element once");
+
+    Tree::MultiQueue<std::unique_ptr<int>, std::function<bool(const std::unique_ptr<int>&, const std::unique_ptr<int>&)>>
+        pointers(Tree::MultiQueueOptions{1, 1, false},
+                 [](const std::unique_ptr<int>& left, const std::unique_ptr<int>& right) { return *left > *right; });
+    for (int i = 5; i > 0; i--) pointers.push(std::make_unique<int>(i));
+    std::unique_ptr<int> smallest;
+    CHECK(pointers.try_pop(smallest) && *smallest == 1, "Move-only elements and custom comparator");
+
+    return true;
+}
+
+// 测试 2：多线程同时 push 与 pop，每个元素恰好出队一次
+bool testConcurrent() {
+    const size_t producers = 4, consumers = 4, perProducer = 20000;
+    Tree::MultiQueue<size_t> queue(Tree::MultiQueueOptions{producers + consumers, 2, false});
+    std::atomic<size_t> remaining{producers * perProducer};
+    std::vector<std::vector<size_t>> received(consumers);
+
+    runThreads(producers + consumers, [&](size_t id) {
+        if (id < producers) {
+            for (size_t i = 0; i < perProducer; i++) queue.push(id * perProducer + i);
+            return;
+        }
+        std::vector<size_t>& mine = received[id - producers];
+        size_t value;
+        while (remaining.load() > 0) {
+            if (queue.try_pop(value)) {
+                mine.push_back(value);
+                remaining.fetch_sub(1);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<size_t> all;
+    for (auto& part : received) all.insert(all.end(), part.begin(), part.end());
+    std::sort(all.begin(), all.end());
+    bool exact = all.size() == producers * perProducer;
+    for (size_t i = 0; exact && i < all.size(); i++) exact = all[i] == i;
+    CHECK(exact && queue.empty(), "Concurrent producers and consumers lose and duplicate nothing");
+
+    Tree::MultiQueue<size_t> strict(Tree::MultiQueueOptions{0, 2, true});
+    std::atomic<size_t> pushed{0};
+    runThreads(8, [&](size_t id) {
+        for (size_t i = 0; i < 10000; i++) {
+            strict.push(id * 10000 + i);
+            pushed.fetch_add(1);
+            size_t value;
+            if (i % 2 == 0 && strict.try_pop(value)) pushed.fetch_sub(1);
+        }
+    });
+    CHECK(strict.size() == pushed.load(), "Concurrent strict mode keeps an exact size");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+
+// 单锁基线：std::mutex 保护的 std::priority_queue
+class LockedQueue {
+    std::mutex mutex_;
+    std::priority_queue<unsigned, std::vector<unsigned>, std::greater<unsigned>> queue_;
+
+public:
+    void push(unsigned value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(value);
+    }
+
+    bool try_pop(unsigned& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return false;
+        out = queue_.top();
+        queue_.pop();
+        return true;
+    }
+};
+
+// 预先放入 count 个元素，各线程交替 push 与 pop，共 count 次操作；返回每秒百万次操作
+template <typename Queue>
+double throughput(Queue& queue, size_t threads, size_t count) {
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < count; i++) queue.push(static_cast<unsigned>(rng()));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    runThreads(threads, [&](size_t id) {
+        std::mt19937 local(static_cast<unsigned>(id + 1));
+        size_t operations = count / threads;
+        unsigned value;
+        for (size_t i = 0; i < operations; i++) {
+            if (i % 2 == 0) queue.push(static_cast<unsigned>(local()));
+            else queue.try_pop(value);
+        }
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(count / threads * threads) / seconds / 1e6;
+}
+
+// 排名误差：预先放入 count 个互不相同的键，多线程并发出队，按全局出队序号回放，
+// 每次出队的误差为当时仍在队列中、比它更优的键的个数
+struct RankError {
+    double mean;
+    size_t max;
+};
+
+RankError rankError(size_t threads, size_t count) {
+    Tree::MultiQueue<unsigned, std::greater<unsigned>> queue(Tree::MultiQueueOptions{threads, 2, false});
+    std::vector<unsigned> keys(count);
+    std::iota(keys.begin(), keys.end(), 0u);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(11));
+    for (unsigned key : keys) queue.push(key);
+
+    std::vector<unsigned> order(count);
+    std::atomic<size_t> sequence{0};
+    runThreads(threads, [&](size_t) {
+        unsigned key;
+        while (queue.try_pop(key)) order[sequence.fetch_add(1)] = key;
+    });
+
+    Tree::AVLTree<unsigned, char> remaining;
+    for (unsigned key = 0; key < count; key++) remaining.insert(key, 0);
+    size_t total = 0, max = 0;
+    for (unsigned key : order) {
+        size_t error = remaining.rank(key);
+        total += error;
+        max = std::max(max, error);
+        remaining.erase(key);
+    }
+    return RankError{static_cast<double>(total) / static_cast<double>(count), max};
+}
+
+void testPerformance(size_t count) {
+    std::cout << "-- " << count << " operations --\n";
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+        LockedQueue locked;
+        Tree::MultiQueue<unsigned, std::greater<unsigned>> strict(Tree::MultiQueueOptions{threads, 2, true});
+        Tree::MultiQueue<unsigned, std::greater<unsigned>> relaxed(Tree::MultiQueueOptions{threads, 2, false});
+        double lockedOps = throughput(locked, threads, count);
+        double strictOps = throughput(strict, threads, count);
+        double relaxedOps = throughput(relaxed, threads, count);
+        RankError error = rankError(threads, std::min<size_t>(count, 1000000));
+        std::cout << std::setw(2) << threads << " threads: [mutex + std::priority_queue] " << lockedOps
+                  << " Mops/s, [MultiQueue strict] " << strictOps << " Mops/s, [MultiQueue c=2] " << relaxedOps
+                  << " Mops/s, rank error mean " << error.mean << " max " << error.max << "\n";
+    }
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大操作数（默认 1M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testSingleThread();
+    allPassed &= testConcurrent();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,448 @@
+#include <Tree/RedBlackTree.hpp>
+#include <Tree/AVLTree.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <memory_resource>
+#include <type_traits>
+#include <sstream>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：按迭代器顺序取出全部键值对
+template <typename TreeType>
+auto treeToVector(TreeType& tree) {
+    std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>> result;
+    for (auto& entry : tree) {
+        result.emplace_back(entry.first, entry.second);
+    }
+    return result;
+}
+
+template <typename TreeType, typename MapType>
+bool sameContents(TreeType& tree, const MapType& model) {
+    return tree.size() == model.size() && tree.validate() &&
+           treeToVector(tree) == std::vector<std::pair<typename TreeType::key_type, typename TreeType::mapped_type>>(
+                                     model.begin(), model.end());
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：随机插入、删除与查找
+bool testInsertAndErase() {
+    CHECK(sizeof(Tree::RBLink) == 3 * sizeof(void*), "Link is three words");
+
+    Tree::RedBlackTree<int, int> tree;
+    std::map<int, int> model;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 50000; i++) {
+        int key = static_cast<int>(rng() % 5000);
+        if (rng() % 3 != 0) {
+            bool inserted = tree.insert(key, i).second;
+            if (inserted != model.emplace(key, i).second) break;
+        } else {
+            if (tree.erase(key) != model.erase(key)) break;
+        }
+    }
+    CHECK(sameContents(tree, model), "Random operations match std::map");
+
+    bool found = true;
+    for (int key = -1; key <= 5000; key++) {
+        auto it = tree.find(key);
+        auto expected = model.find(key);
+        found &= (it == tree.end()) == (expected == model.end()) && tree.contains(key) == (expected != model.end());
+        if (it != tree.end()) found &= it->second == expected->second;
+    }
+    CHECK(found, "find and contains");
+
+    tree[7] = -7;
+    tree.insert_or_assign(8, -8);
+    CHECK(tree.at(7) == -7 && tree.at(8) == -8, "operator[] and insert_or_assign");
+
+    bool caught = false;
+    try {
+        tree.at(-1);
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() on missing key throws");
+
+    for (auto it = tree.begin(); it != tree.end();) {
+        it = it->first % 2 == 0 ? tree.erase(it) : std::next(it);
+    }
+    bool odd = true;
+    for (auto& entry : tree) odd &= entry.first % 2 != 0;
+    CHECK(odd && tree.validate(), "Erase by iterator");
+
+    tree.clear();
+    CHECK(tree.empty() && tree.begin() == tree.end() && tree.validate(), "Clear");
+
+    return true;
+}
+
+// 测试 2：lower_bound、upper_bound 与双向迭代
+bool testBoundsAndIterators() {
+    Tree::RedBlackTree<int, int> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i * 10, i);
+    }
+
+    CHECK(tree.lower_bound(50)->first == 50 && tree.lower_bound(51)->first == 60 && tree.upper_bound(50)->first == 60,
+          "lower_bound and upper_bound");
+    CHECK(tree.lower_bound(991) == tree.end() && tree.upper_bound(-5) == tree.begin(), "Bounds at the ends");
+
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();) {
+        --it;
+        backward.push_back(it->first);
+    }
+    CHECK(backward.size() == 100 && backward.front() == 990 && backward.back() == 0 &&
+              std::is_sorted(backward.rbegin(), backward.rend()),
+          "Reverse iteration from end()");
+
+    return true;
+}
+
+// 测试 3：带提示的插入
+bool testInsertHint() {
+    Tree::RedBlackTree<int, int> sorted;
+    for (int i = 0; i < 10000; i++) {
+        sorted.insert_hint(sorted.end(), i, i);
+    }
+    CHECK(sorted.size() == 10000 && sorted.validate() && sorted.begin()->first == 0, "Sorted input with end() hint");
+
+    // 近似有序：每次传入上一次返回的位置，偶尔有乱序的键
+    Tree::RedBlackTree<int, int> nearly;
+    std::map<int, int> model;
+    std::mt19937 rng(2);
+    auto hint = nearly.end();
+    for (int i = 0; i < 10000; i++) {
+        int key = rng() % 10 == 0 ? static_cast<int>(rng() % 20000) : i * 2;
+        hint = nearly.insert_hint(hint, key, i);
+        model.emplace(key, i);
+    }
+    CHECK(sameContents(nearly, model), "Nearly sorted input with previous position as hint");
+
+    // 提示在前驱、后继、错误位置以及已有键上
+    Tree::RedBlackTree<int, int> tree;
+    for (int i = 0; i < 100; i += 10) tree.insert(i, i);
+    auto at = tree.insert_hint(tree.find(50), 45, 45);
+    auto after = tree.insert_hint(tree.find(50), 55, 55);
+    auto wrong = tree.insert_hint(tree.begin(), 95, 95);
+    auto existing = tree.insert_hint(tree.find(20), 30, -1);
+    CHECK(at->first == 45 && after->first == 55 && wrong->first == 95 && existing->second == 30 &&
+              tree.size() == 13 && tree.validate(),
+          "Hints before, after, wrong and on an existing key");
+
+    return true;
+}
+
+// 测试 4：拷贝、移动与自定义分配器
+bool testCopyMoveAllocator() {
+    Tree::RedBlackTree<int, std::string> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i, std::to_string(i));
+    }
+
+    Tree::RedBlackTree<int, std::string> copy(tree);
+    tree[0] = "changed";
+    CHECK(copy.at(0) == "0" && copy.size() == 100 && copy.validate(), "Copy constructor is deep");
+
+    Tree::RedBlackTree<int, std::string> moved(std::move(tree));
+    CHECK(moved.size() == 100 && tree.empty() && tree.begin() == tree.end() && moved.at(0) == "changed", "Move constructor");
+    CHECK((std::is_nothrow_move_constructible<Tree::RedBlackTree<int, std::string>>::value), "Move constructor is noexcept");
+
+    // 节点池随树移动，源树重新使用时与目标树互不影响
+    Tree::RedBlackTree<int, int> source;
+    for (int i = 0; i < 1000; i++) {
+        source.insert(i, i);
+    }
+    Tree::RedBlackTree<int, int> target(std::move(source));
+    for (int i = 0; i < 1000; i++) {
+        source.insert(i, -i);
+        if (i % 2 == 0) target.erase(i);
+    }
+    CHECK(source.size() == 1000 && target.size() == 500 && source.validate() && target.validate() && source.at(7) == -7,
+          "Moved-from tree is independent of the target");
+
+    tree = copy;
+    moved = std::move(copy);
+    CHECK(tree.size() == 100 && moved.at(99) == "99" && copy.empty() && moved.validate(), "Copy and move assignment");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    using PmrTree = Tree::RedBlackTree<int, int, std::less<int>, std::pmr::polymorphic_allocator<std::pair<const int, int>>>;
+    PmrTree pmrTree(std::less<int>(), &pool);
+    for (int i = 0; i < 1000; i++) {
+        pmrTree.insert((i * 7919) % 1000, i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        pmrTree.erase(i);
+    }
+    CHECK(pmrTree.size() == 666 && pmrTree.validate() && pmrTree.get_allocator().resource() == &pool,
+          "Tree with polymorphic allocator");
+
+    std::pmr::unsynchronized_pool_resource otherPool;
+    PmrTree other(std::less<int>(), &otherPool);
+    other = std::move(pmrTree);
+    CHECK(other.size() == 666 && other.validate() && pmrTree.empty(), "Move assignment between unequal allocators");
+
+    return true;
+}
+
+// 测试 5：侵入式红黑树
+struct ByDeadline {};
+struct ById {};
+
+struct Timer : Tree::RBHook<ByDeadline>, Tree::RBHook<ById> {
+    long long deadline;
+    int id;
+
+    Timer(long long deadline, int id) : deadline(deadline), id(id) {}
+};
+
+struct DeadlineOf {
+    long long operator()(const Timer& timer) const {
+        return timer.deadline;
+    }
+};
+
+struct IdOf {
+    const int& operator()(const Timer& timer) const {
+        return timer.id;
+    }
+};
+
+bool testIntrusive() {
+    std::vector<Timer> timers;
+    for (int i = 0; i < 1000; i++) {
+        timers.emplace_back((i * 37) % 100, i);
+    }
+
+    Tree::IntrusiveRedBlackTree<Timer, DeadlineOf, std::less<>, ByDeadline> byDeadline;
+    Tree::IntrusiveRedBlackTree<Timer, IdOf, std::less<>, ById> byId;
+    for (Timer& timer : timers) {
+        byDeadline.insert_multi(timer);
+        byId.insert(timer);
+    }
+    CHECK(byDeadline.size() == 1000 && byId.size() == 1000 && byDeadline.validate() && byId.validate(),
+          "Same objects in two trees through two hooks");
+
+    // 相等的截止时间按插入顺序排列
+    bool stable = true;
+    int lastId = -1;
+    for (auto it = byDeadline.lower_bound(42); it != byDeadline.upper_bound(42); ++it) {
+        stable &= it->deadline == 42 && it->id > lastId;
+        lastId = it->id;
+    }
+    CHECK(stable && lastId >= 0, "insert_multi keeps equal keys in insertion order");
+
+    Timer duplicate(0, 5);
+    CHECK(!byId.insert(duplicate).second && !duplicate.Tree::RBHook<ById>::is_linked() && byId.size() == 1000,
+          "Duplicate id rejected");
+
+    // 按 id 取消一半的定时器，再按截止时间依次取出
+    for (int i = 0; i < 1000; i += 2) {
+        Timer& timer = *byId.find(i);
+        byDeadline.erase(timer);
+        byId.erase(timer);
+    }
+    CHECK(byDeadline.size() == 500 && !timers[0].Tree::RBHook<ByDeadline>::is_linked() &&
+              timers[1].Tree::RBHook<ByDeadline>::is_linked() && byDeadline.validate(),
+          "Erase by reference unlinks the hook");
+
+    long long last = -1;
+    bool ordered = true;
+    while (!byDeadline.empty()) {
+        Timer& timer = byDeadline.pop_front();
+        ordered &= timer.deadline >= last && timer.id % 2 == 1;
+        last = timer.deadline;
+    }
+    CHECK(ordered, "pop_front returns timers by deadline");
+
+    Timer copy = timers[1];
+    CHECK(!copy.Tree::RBHook<ById>::is_linked() && byId.iterator_to(timers[1])->id == 1, "Copies start unlinked, iterator_to");
+
+    byId.clear();
+    bool unlinked = true;
+    for (Timer& timer : timers) unlinked &= !timer.Tree::RBHook<ById>::is_linked();
+    CHECK(byId.empty() && unlinked, "clear unlinks every element");
+
+    return true;
+}
+
+// 测试 6：操作计数策略
+bool testStats() {
+    using CountedTree =
+        Tree::RedBlackTree<int, int, std::less<int>, std::allocator<std::pair<const int, int>>, Linear::stats::counting>;
+    CountedTree tree;
+    const int n = 1000;
+    for (int i = 0; i < n; i++) {
+        tree.insert(i, i);
+    }
+    Linear::stats::Counters inserted = tree.stats();
+    CHECK(inserted.node_allocations == n && inserted.rotations > 0 && inserted.rotations <= 2 * n,
+          "Insert counts nodes and at most two rotations each");
+    CHECK(inserted.comparisons > n && inserted.comparisons < 2 * n * 20, "Insert comparisons grow logarithmically");
+
+    tree.find(n / 2);
+    CHECK(tree.stats().comparisons > inserted.comparisons, "Find counts comparisons");
+
+    for (int i = 0; i < n; i += 2) {
+        tree.erase(i);
+    }
+    CHECK(tree.stats().rotations - inserted.rotations <= 3 * (n / 2) && tree.validate(),
+          "Erase counts at most three rotations each");
+
+    std::ostringstream out;
+    Linear::stats::registry().dump(out);
+    CHECK(out.str().find("Tree::RedBlackTree") != std::string::npos, "Registry dump names the tree");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+// 混合负载：insertPercent% 的操作为插入或删除（各半），其余为查找
+template <typename MapType>
+void runMix(const std::string& name, MapType& map, const std::vector<long long>& keys, int insertPercent, size_t count) {
+    std::mt19937_64 rng(9);
+    long long found = 0;
+    long long ms = timeMs([&] {
+        for (size_t i = 0; i < count; i++) {
+            long long key = keys[i % keys.size()];
+            int op = static_cast<int>(rng() % 100);
+            if (op < insertPercent / 2) {
+                map.insert({key, key});
+            } else if (op < insertPercent) {
+                map.erase(key);
+            } else {
+                found += map.count(key);
+            }
+        }
+    });
+    std::cout << "[" << name << "] " << insertPercent << "% updates: " << ms << " ms (found " << found << ")\n";
+}
+
+// 让 RedBlackTree 与 std::map 使用同一套调用
+template <typename TreeType>
+struct TreeAdapter {
+    TreeType tree;
+
+    void insert(const std::pair<long long, long long>& entry) {
+        tree.insert(entry.first, entry.second);
+    }
+    void erase(long long key) {
+        tree.erase(key);
+    }
+    size_t count(long long key) const {
+        return tree.contains(key);
+    }
+};
+
+void testPerformance(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<long long> keys(count);
+    for (size_t i = 0; i < count; i++) keys[i] = static_cast<long long>(rng() % (count * 2));
+    std::vector<long long> sorted(count);
+    for (size_t i = 0; i < count; i++) sorted[i] = static_cast<long long>(i);
+
+    std::cout << "-- " << count << " keys --\n";
+    {
+        std::map<long long, long long> map;
+        long long insertMs = timeMs([&] {
+            for (long long key : keys) map.emplace(key, key);
+        });
+        long long found = 0;
+        long long lookupMs = timeMs([&] {
+            for (long long key : keys) found += map.count(key);
+        });
+        long long hintMs = timeMs([&] {
+            std::map<long long, long long> ordered;
+            for (long long key : sorted) ordered.emplace_hint(ordered.end(), key, key);
+        });
+        std::cout << "[std::map]     random insert: " << insertMs << " ms, lookup: " << lookupMs
+                  << " ms, sorted insert with hint: " << hintMs << " ms (found " << found << ")\n";
+        runMix("std::map    ", map, keys, 90, count);
+        runMix("std::map    ", map, keys, 10, count);
+    }
+    {
+        TreeAdapter<Tree::RedBlackTree<long long, long long>> adapter;
+        long long insertMs = timeMs([&] {
+            for (long long key : keys) adapter.tree.insert(key, key);
+        });
+        long long found = 0;
+        long long lookupMs = timeMs([&] {
+            for (long long key : keys) found += adapter.tree.contains(key);
+        });
+        long long hintMs = timeMs([&] {
+            Tree::RedBlackTree<long long, long long> ordered;
+            for (long long key : sorted) ordered.insert_hint(ordered.end(), key, key);
+        });
+        std::cout << "[RedBlackTree] random insert: " << insertMs << " ms, lookup: " << lookupMs
+                  << " ms, sorted insert with hint: " << hintMs << " ms (found " << found << ")\n";
+        runMix("RedBlackTree", adapter, keys, 90, count);
+        runMix("RedBlackTree", adapter, keys, 10, count);
+    }
+    {
+        TreeAdapter<Tree::AVLTree<long long, long long>> adapter;
+        long long insertMs = timeMs([&] {
+            for (long long key : keys) adapter.tree.insert(key, key);
+        });
+        long long found = 0;
+        long long lookupMs = timeMs([&] {
+            for (long long key : keys) found += adapter.tree.contains(key);
+        });
+        std::cout << "[AVLTree]      random insert: " << insertMs << " ms, lookup: " << lookupMs << " ms (found " << found
+                  << ")\n";
+        runMix("AVLTree     ", adapter, keys, 90, count);
+        runMix("AVLTree     ", adapter, keys, 10, count);
+    }
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 1M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInsertAndErase();
+    allPassed &= testBoundsAndIterators();
+    allPassed &= testInsertHint();
+    allPassed &= testCopyMoveAllocator();
+    allPassed &= testIntrusive();
+    allPassed &= testStats();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
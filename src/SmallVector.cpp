@@ -0,0 +1,221 @@
+#include <Linear/SmallVector.hpp>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <memory_resource>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 统计分配次数与当前占用字节数的分配器
+struct AllocStats {
+    static size_t allocations;
+    static size_t bytes;
+    static size_t peak;
+
+    static void reset() {
+        allocations = 0;
+        bytes = 0;
+        peak = 0;
+    }
+};
+size_t AllocStats::allocations = 0;
+size_t AllocStats::bytes = 0;
+size_t AllocStats::peak = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        AllocStats::allocations++;
+        AllocStats::bytes += count * sizeof(T);
+        AllocStats::peak = std::max(AllocStats::peak, AllocStats::bytes);
+        return std::allocator<T>().allocate(count);
+    }
+    void deallocate(T* ptr, size_t count) {
+        AllocStats::bytes -= count * sizeof(T);
+        std::allocator<T>().deallocate(ptr, count);
+    }
+
+    bool operator==(const CountingAllocator&) const {
+        return true;
+    }
+    bool operator!=(const CountingAllocator&) const {
+        return false;
+    }
+};
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：内联存储与溢出到堆
+bool testInlineAndSpill() {
+    AllocStats::reset();
+    {
+        Linear::SmallVector<int, 4, CountingAllocator<int>> vec;
+        for (int i = 0; i < 4; i++) {
+            vec.push_back(i);
+        }
+        CHECK(vec.is_inline() && vec.capacity() == 4 && AllocStats::allocations == 0, "First N elements stay inline");
+
+        vec.push_back(4);
+        CHECK(!vec.is_inline() && vec.size() == 5 && AllocStats::allocations == 1, "Spill to heap");
+        CHECK(vec[0] == 0 && vec[4] == 4, "Elements after spill");
+        const auto& view = vec;
+        CHECK(view.size() == 5 && view.capacity() >= 5 && !view.empty() && view[4] == 4, "Query through a const reference");
+
+        vec.erase(0);
+        vec.erase(0);
+        vec.shrink_to_fit();
+        CHECK(vec.is_inline() && vec.size() == 3 && vec[0] == 2 && vec[2] == 4, "Shrink back into inline storage");
+    }
+    CHECK(AllocStats::bytes == 0, "Heap memory released");
+
+    return true;
+}
+
+// 测试 2：插入、删除与迭代
+bool testInsertAndErase() {
+    Linear::SmallVector<std::string, 3> vec;
+    vec.push_back("b");
+    vec.push_back("d");
+    vec.insert(1, "c");
+    vec.insert(0, "a");
+    vec.emplace(4, 1, 'e');
+    vec.erase(2);
+
+    std::vector<std::string> collected;
+    for (auto it = vec.begin(); it != vec.end(); ++it) {
+        collected.push_back(*it);
+    }
+    CHECK((collected == std::vector<std::string>{"a", "b", "d", "e"}), "Insert, emplace and erase across the inline boundary");
+
+    bool caught = false;
+    try {
+        vec.at(4);
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() out of range");
+
+    return true;
+}
+
+// 测试 3：拷贝与移动
+bool testCopyAndMove() {
+    Linear::SmallVector<std::string, 2> small;
+    small.push_back("x");
+    Linear::SmallVector<std::string, 2> large;
+    for (int i = 0; i < 10; i++) {
+        large.push_back(std::to_string(i));
+    }
+
+    Linear::SmallVector<std::string, 2> smallCopy(small);
+    Linear::SmallVector<std::string, 2> largeCopy(large);
+    small[0] = "changed";
+    CHECK(smallCopy[0] == "x" && largeCopy.size() == 10 && largeCopy[9] == "9", "Copy constructor is deep");
+
+    const std::string* heap = &large[0];
+    Linear::SmallVector<std::string, 2> largeMoved(std::move(large));
+    CHECK(&largeMoved[0] == heap && large.empty() && large.is_inline(), "Move steals heap storage");
+
+    Linear::SmallVector<std::string, 2> smallMoved(std::move(smallCopy));
+    CHECK(smallMoved.is_inline() && smallMoved[0] == "x" && smallCopy.empty(), "Move of inline elements");
+
+    smallMoved = largeMoved;
+    CHECK(smallMoved.size() == 10 && smallMoved[5] == "5", "Copy assignment");
+    largeMoved = std::move(smallMoved);
+    CHECK(largeMoved.size() == 10 && smallMoved.empty(), "Move assignment");
+    largeMoved = Linear::SmallVector<std::string, 2>(1, "y");
+    CHECK(largeMoved.size() == 1 && largeMoved[0] == "y" && largeMoved.is_inline(), "Move assignment from inline");
+
+    std::pmr::monotonic_buffer_resource arena1, arena2;
+    using PmrSmall = Linear::SmallVector<int, 2, std::pmr::polymorphic_allocator<int>>;
+    PmrSmall left(&arena1), right(&arena2);
+    for (int i = 0; i < 5; i++) {
+        right.push_back(i);
+    }
+    left = std::move(right);
+    CHECK(left.size() == 5 && left[4] == 4 && left.get_allocator().resource() == &arena1, "Move assignment with unequal allocators");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+// 大量短小序列：每个序列长度服从 [0, 2 * avg] 的均匀分布
+template <typename VecType>
+void benchShortVectors(const std::string& name, size_t count, int avgLength) {
+    std::mt19937 rng(11);
+    std::vector<int> lengths(count);
+    for (int& len : lengths) len = static_cast<int>(rng() % (2 * avgLength + 1));
+
+    AllocStats::reset();
+    auto t0 = std::chrono::high_resolution_clock::now();
+    std::vector<VecType> vectors(count);
+    for (size_t i = 0; i < count; i++) {
+        for (int k = 0; k < lengths[i]; k++) {
+            vectors[i].push_back(k);
+        }
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (VecType& vec : vectors) {
+        for (auto it = vec.begin(); it != vec.end(); ++it) sum += *it;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    size_t totalBytes = AllocStats::bytes + count * sizeof(VecType);
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    std::cout << "[" << name << "] build: " << ms(t0, t1) << " ms, scan: " << ms(t1, t2) << " ms, allocations: "
+              << AllocStats::allocations << ", heap: " << AllocStats::bytes / 1024 << " KB, total: " << totalBytes / 1024
+              << " KB (checksum " << sum << ")\n";
+}
+
+void testPerformance(size_t count, int avgLength) {
+    using Alloc = CountingAllocator<int>;
+    std::cout << "-- " << count << " vectors, average length " << avgLength << " --\n";
+    benchShortVectors<std::vector<int, Alloc>>("std::vector", count, avgLength);
+    benchShortVectors<Linear::Vector<int, Alloc, Linear::growth::doubling>>("Vector 2x", count, avgLength);
+    benchShortVectors<Linear::Vector<int, Alloc, Linear::growth::one_and_half>>("Vector 1.5x", count, avgLength);
+    benchShortVectors<Linear::Vector<int, Alloc, Linear::growth::size_class>>("Vector size class", count, avgLength);
+    benchShortVectors<Linear::SmallVector<int, 4, Alloc>>("SmallVector<4>", count, avgLength);
+    benchShortVectors<Linear::SmallVector<int, 8, Alloc>>("SmallVector<8>", count, avgLength);
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：短序列个数（默认 1M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInlineAndSpill();
+    allPassed &= testInsertAndErase();
+    allPassed &= testCopyAndMove();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    std::cout << "\n=== Short Vector Workload ===\n";
+    for (int avgLength : {2, 4, 16}) {
+        testPerformance(count, avgLength);
+    }
+
+    return allPassed ? 0 : 1;
+}
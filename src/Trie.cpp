@@ -0,0 +1,513 @@
+#include <Tree/Trie.hpp>
+#include <iostream>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include <new>
+#include <memory_resource>
+#include <filesystem>
+#include <fstream>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 统计堆上的存活字节数，用于比较每个键的内存占用（只计申请的大小，不含 malloc 自身的开销）
+static size_t g_heapBytes = 0;
+
+// 不能内联：内联到调用处后 GCC 会把前置的 16 字节头误报为越界访问和不匹配的释放
+#if defined(_MSC_VER) && !defined(__clang__)
+#define COUNTING_NOINLINE __declspec(noinline)
+#else
+#define COUNTING_NOINLINE __attribute__((noinline))
+#endif
+
+COUNTING_NOINLINE void* operator new(size_t size) {
+    void* block = std::malloc(size + 16);
+    if (block == nullptr) throw std::bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    g_heapBytes += size;
+    return static_cast<char*>(block) + 16;
+}
+
+COUNTING_NOINLINE void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr) return;
+    char* block = static_cast<char*>(ptr) - 16;
+    g_heapBytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+// 辅助函数：按键序取出全部键值对
+template <typename TrieType>
+std::vector<std::pair<std::string, int>> trieToVector(const TrieType& trie) {
+    std::vector<std::pair<std::string, int>> result;
+    trie.for_each([&](std::string_view key, const int& value) { result.emplace_back(std::string(key), value); });
+    return result;
+}
+
+bool sameContents(const Tree::Trie<int>& trie, const std::map<std::string, int>& model) {
+    return trie.size() == model.size() && trie.validate() &&
+           trieToVector(trie) == std::vector<std::pair<std::string, int>>(model.begin(), model.end());
+}
+
+// 辅助函数：生成容易互为前缀、且带有超过内联长度的公共前缀的键
+std::string randomKey(std::mt19937& rng) {
+    static const char* stems[] = {"", "a", "/api/v1/users/", "/api/v1/user", "/static/images/2024/", "\xff\x00\x80"};
+    size_t stem = rng() % 6;
+    std::string key = stem == 5 ? std::string(stems[5], 3) : std::string(stems[stem]);
+    size_t length = rng() % 8;
+    for (size_t i = 0; i < length; i++) key.push_back("ab/\0z"[rng() % 5]);
+    return key;
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：随机插入、删除与查找
+bool testInsertAndErase() {
+    Tree::Trie<int> trie;
+    std::map<std::string, int> model;
+    std::mt19937 rng(1);
+    bool matched = true;
+    for (int i = 0; i < 50000; i++) {
+        std::string key = randomKey(rng);
+        if (rng() % 3 != 0) {
+            matched &= trie.insert(key, i).second == model.emplace(key, i).second;
+        } else {
+            matched &= trie.erase(key) == model.erase(key);
+        }
+        if (i % 5000 == 0) matched &= trie.validate();
+    }
+    CHECK(matched && sameContents(trie, model), "Random operations match std::map");
+
+    bool found = true;
+    for (auto& entry : model) found &= trie.find(entry.first) != nullptr && *trie.find(entry.first) == entry.second;
+    CHECK(found && trie.find("/api/v1/users/zzzz") == nullptr && !trie.contains("/api/v2"), "find and contains");
+
+    trie.insert_or_assign("", 42);
+    trie["/new"] = 7;
+    CHECK(trie.at("") == 42 && trie.at("/new") == 7 && trie.validate(), "insert_or_assign, operator[] and the empty key");
+
+    bool caught = false;
+    try {
+        trie.at("/missing");
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "at() on missing key throws");
+
+    model[""] = 42;
+    model["/new"] = 7;
+    for (auto& entry : model) trie.erase(entry.first);
+    CHECK(trie.empty() && trie.memory_usage() == 0 && trie.validate(), "Erasing every key frees every node");
+
+    return true;
+}
+
+// 测试 2：节点在 4/16/48/256 之间增长与收缩
+bool testNodeGrowth() {
+    Tree::Trie<int> trie;
+    std::string prefix = "/a/rather/long/shared/prefix/";
+    bool valid = true;
+    for (int byte = 0; byte < 256; byte++) {
+        trie.insert(prefix + static_cast<char>(byte), byte);
+        valid &= trie.validate();
+    }
+    size_t full = trie.memory_usage();
+    CHECK(valid && trie.size() == 256, "Growing to a 256-way node");
+
+    for (int byte = 0; byte < 256; byte++) {
+        valid &= trie.find(prefix + static_cast<char>(byte)) != nullptr && *trie.find(prefix + static_cast<char>(byte)) == byte;
+    }
+    CHECK(valid, "Every byte value is reachable, including zero bytes");
+
+    for (int byte = 255; byte >= 2; byte--) {
+        trie.erase(prefix + static_cast<char>(byte));
+        valid &= trie.validate();
+    }
+    CHECK(valid && trie.size() == 2 && trie.memory_usage() < full / 8, "Shrinking back to a small node");
+
+    trie.erase(prefix + '\x01');
+    CHECK(trie.size() == 1 && trie.validate() && trie.contains(prefix + '\0'), "Collapsing a node with one child");
+
+    return true;
+}
+
+// 测试 3：最长前缀匹配与按前缀有序遍历
+bool testPrefixQueries() {
+    Tree::Trie<int> trie;
+    std::map<std::string, int> model;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 3000; i++) {
+        std::string key = randomKey(rng);
+        trie.insert(key, i);
+        model.emplace(key, i);
+    }
+
+    bool matched = true;
+    for (int i = 0; i < 3000; i++) {
+        std::string query = randomKey(rng) + randomKey(rng);
+        std::string expected;
+        bool any = false;
+        for (size_t length = query.size() + 1; length-- > 0;) {
+            if (model.count(query.substr(0, length)) != 0) {
+                expected = query.substr(0, length);
+                any = true;
+                break;
+            }
+        }
+        auto result = trie.longest_prefix(query);
+        matched &= any ? result.second != nullptr && result.first == expected && *result.second == model[expected]
+                       : result.second == nullptr;
+    }
+    CHECK(matched, "longest_prefix matches a brute-force search");
+
+    for (const char* prefix : {"", "a", "/api/v1/user", "/api/v1/users/a", "/static/", "\xff", "/none"}) {
+        std::vector<std::pair<std::string, int>> scanned;
+        trie.scan_prefix(prefix, [&](std::string_view key, int& value) { scanned.emplace_back(std::string(key), value); });
+        std::vector<std::pair<std::string, int>> expected;
+        std::string p = prefix;
+        for (auto it = model.lower_bound(p); it != model.end() && it->first.compare(0, p.size(), p) == 0; ++it) {
+            expected.emplace_back(it->first, it->second);
+        }
+        matched &= scanned == expected;
+    }
+    CHECK(matched, "scan_prefix visits matching keys in order");
+
+    std::string zero("\xff\x00\x80", 3);
+    size_t zeroCount = 0;
+    trie.scan_prefix(zero, [&](std::string_view key, int&) { zeroCount += key.compare(0, 3, zero) == 0; });
+    CHECK(zeroCount > 0 && zeroCount == static_cast<size_t>(std::count_if(model.begin(), model.end(), [&](auto& entry) {
+              return entry.first.compare(0, 3, zero) == 0;
+          })),
+          "Prefixes containing zero bytes");
+
+    return true;
+}
+
+// 测试 4：拷贝、移动与自定义分配器
+bool testCopyMoveAllocator() {
+    Tree::Trie<int> trie;
+    for (int i = 0; i < 1000; i++) {
+        trie.insert("/item/" + std::to_string(i), i);
+    }
+
+    Tree::Trie<int> copy(trie);
+    trie.insert_or_assign("/item/0", -1);
+    CHECK(copy.at("/item/0") == 0 && copy.size() == 1000 && copy.validate() &&
+              copy.memory_usage() == trie.memory_usage(),
+          "Copy constructor is deep");
+
+    Tree::Trie<int> moved(std::move(trie));
+    CHECK(moved.size() == 1000 && trie.empty() && moved.at("/item/0") == -1 && trie.memory_usage() == 0, "Move constructor");
+
+    trie = copy;
+    moved = std::move(copy);
+    CHECK(trie.at("/item/0") == 0 && moved.at("/item/999") == 999 && copy.empty() && moved.validate(),
+          "Copy and move assignment");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    Tree::Trie<std::string, std::pmr::polymorphic_allocator<std::string>> pmrTrie(&pool);
+    for (int i = 0; i < 1000; i++) {
+        pmrTrie.insert("/k/" + std::to_string(i * 7919 % 1000), std::to_string(i));
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        pmrTrie.erase("/k/" + std::to_string(i));
+    }
+    CHECK(pmrTrie.size() == 666 && pmrTrie.validate() && pmrTrie.get_allocator().resource() == &pool,
+          "Trie with polymorphic allocator");
+
+    return true;
+}
+
+// 测试 5：FrozenTrie 与 Trie 内容一致，文件写出后映射打开
+bool testFrozenTrie() {
+    std::map<std::string, int> model;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 20000; i++) model.emplace(randomKey(rng), i);
+    for (int i = 0; i < 300; i++) model.emplace("/static/images/2024/" + std::string(static_cast<size_t>(i % 40), 'x'), -i);
+
+    Tree::FrozenTrie<int> frozen(model.begin(), model.end());
+    std::vector<std::pair<std::string, int>> items(model.begin(), model.end());
+    CHECK(frozen.size() == model.size() && frozen.validate() && trieToVector(frozen) == items,
+          "Build from a sorted map and iterate in order");
+
+    bool matched = true;
+    for (auto& entry : model) matched &= frozen.find(entry.first) != nullptr && *frozen.find(entry.first) == entry.second;
+    for (int i = 0; i < 20000; i++) {
+        std::string probe = randomKey(rng) + randomKey(rng);
+        matched &= frozen.contains(probe) == (model.count(probe) != 0);
+    }
+    CHECK(matched && frozen.at("") == model.at("") && !frozen.contains("/static/images/2024/" + std::string(40, 'x')),
+          "find and contains match std::map");
+
+    for (int i = 0; i < 3000; i++) {
+        std::string query = randomKey(rng) + randomKey(rng);
+        std::string expected;
+        bool any = false;
+        for (size_t length = query.size() + 1; length-- > 0;) {
+            if (model.count(query.substr(0, length)) != 0) {
+                expected = query.substr(0, length);
+                any = true;
+                break;
+            }
+        }
+        auto result = frozen.longest_prefix(query);
+        matched &= any ? result.second != nullptr && result.first == expected && *result.second == model[expected]
+                       : result.second == nullptr;
+    }
+    CHECK(matched, "longest_prefix matches a brute-force search");
+
+    for (const char* prefix : {"", "a", "/api/v1/user", "/api/v1/users/a", "/static/images/2024/xxxxx", "\xff", "/none"}) {
+        std::vector<std::pair<std::string, int>> scanned;
+        frozen.scan_prefix(prefix, [&](std::string_view key, const int& value) {
+            scanned.emplace_back(std::string(key), value);
+        });
+        std::vector<std::pair<std::string, int>> expected;
+        std::string p = prefix;
+        for (auto it = model.lower_bound(p); it != model.end() && it->first.compare(0, p.size(), p) == 0; ++it) {
+            expected.emplace_back(it->first, it->second);
+        }
+        matched &= scanned == expected;
+    }
+    CHECK(matched, "scan_prefix visits matching keys in order");
+
+    std::vector<std::pair<std::string, int>> none;
+    std::vector<std::pair<std::string, int>> single{{"only", 1}};
+    std::vector<std::pair<std::string, int>> emptyKey{{"", 2}, {"a", 3}};
+    Tree::FrozenTrie<int> small(none.begin(), none.end());
+    bool edges = small.empty() && small.validate() && small.find("") == nullptr &&
+                 small.longest_prefix("x").second == nullptr;
+    small.build(single.begin(), single.end());
+    edges &= small.size() == 1 && small.at("only") == 1 && !small.contains("onl") && !small.contains("only!") &&
+             small.longest_prefix("only!").first == "only" && small.validate();
+    small.build(emptyKey.begin(), emptyKey.end());
+    edges &= small.at("") == 2 && small.at("a") == 3 && small.longest_prefix("b").first.empty() && small.validate();
+    CHECK(edges, "Empty dictionary, a single key and the empty key");
+
+    // 写出文件再映射打开，内容与内存中构建的完全相同
+    std::string path = (std::filesystem::temp_directory_path() / "frozen_trie_test.bin").string();
+    Tree::FrozenTrie<int>::build_to_file(path, model.begin(), model.end());
+    Tree::FrozenTrie<int> mapped(path, true);
+    CHECK(mapped.is_mapped() && mapped.memory_usage() == frozen.memory_usage() &&
+              std::filesystem::file_size(path) == frozen.memory_usage() && trieToVector(mapped) == trieToVector(frozen),
+          "build_to_file and open");
+
+    Tree::FrozenTrie<int> moved(std::move(mapped));
+    CHECK(moved.is_mapped() && moved.at("a") == model.at("a") && !mapped.is_mapped() && mapped.empty() &&
+              mapped.find("a") == nullptr,
+          "Move constructor");
+    moved.close();
+
+    small.save(path);
+    Tree::FrozenTrie<int> saved(path, true);
+    CHECK(saved.size() == 2 && saved.at("a") == 3, "save writes the in-memory image");
+
+    bool caught = false;
+    std::vector<std::pair<std::string, int>> unsorted{{"a", 1}, {"c", 3}, {"b", 2}};
+    try {
+        Tree::FrozenTrie<int>::build_to_file(path, unsorted.begin(), unsorted.end());
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    CHECK(caught && Tree::FrozenTrie<int>(path).size() == 2, "Unsorted input throws and keeps the old file");
+
+    caught = false;
+    try {
+        Tree::FrozenTrie<double> wrongType(path);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    CHECK(caught, "Opening with a different value type throws");
+
+    Tree::FrozenTrie<int>::build_to_file(path, model.begin(), model.end());
+    // 翻转文件中部的一个字节
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        std::streamoff middle = static_cast<std::streamoff>(frozen.memory_usage() / 2);
+        file.seekg(middle);
+        char byte = static_cast<char>(file.get());
+        file.seekp(middle);
+        file.put(static_cast<char>(~byte));
+    }
+    caught = false;
+    try {
+        Tree::FrozenTrie<int> verified(path, true);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    Tree::FrozenTrie<int> unchecked(path);
+    CHECK(caught && unchecked.size() == model.size() && !unchecked.validate(),
+          "Corrupt file rejected by a verified open");
+    unchecked.close();
+    std::filesystem::remove(path);
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename Fn>
+long long timeMs(Fn fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+// URL 风格的键：少量主机与路径段组合，末尾带数字 ID，前缀大量共享
+std::vector<std::string> makeUrls(size_t count) {
+    static const char* hosts[] = {"https://example.com", "https://api.example.com", "https://cdn.example.net",
+                                  "http://intranet.local", "https://shop.example.org"};
+    static const char* sections[] = {"/users/", "/products/", "/api/v2/orders/", "/static/img/", "/blog/2024/",
+                                     "/search?q=", "/docs/reference/", "/u/"};
+    static const char* tails[] = {"", "/profile", "/edit", "/comments?page=2", ".png", "/settings/notifications"};
+    std::mt19937_64 rng(42);
+    std::vector<std::string> urls;
+    urls.reserve(count);
+    while (urls.size() < count) {
+        std::string url = hosts[rng() % 5];
+        url += sections[rng() % 8];
+        url += std::to_string(rng() % (count * 4));
+        url += tails[rng() % 6];
+        urls.push_back(std::move(url));
+    }
+    std::sort(urls.begin(), urls.end());
+    urls.erase(std::unique(urls.begin(), urls.end()), urls.end());
+    std::shuffle(urls.begin(), urls.end(), rng);
+    return urls;
+}
+
+template <typename Build, typename Lookup>
+void benchContainer(const char* name, const std::vector<std::string>& keys, const std::vector<std::string>& probes,
+                    Build build, Lookup lookup) {
+    size_t before = g_heapBytes;
+    size_t bytes = 0;
+    long long insertMs = 0, lookupMs = 0;
+    unsigned long long checksum = 0;
+    build([&](auto& container, auto insert) {
+        insertMs = timeMs([&] {
+            for (size_t i = 0; i < keys.size(); i++) insert(container, keys[i], i);
+        });
+        bytes = g_heapBytes - before;
+        lookupMs = timeMs([&] {
+            for (const std::string& probe : probes) checksum += lookup(container, probe);
+        });
+    });
+    std::cout << name << " insert: " << insertMs << " ms, lookup x" << probes.size() << ": " << lookupMs << " ms, "
+              << static_cast<double>(bytes) / static_cast<double>(keys.size()) << " bytes/key (checksum " << checksum
+              << ")\n";
+}
+
+void testPerformance(size_t count) {
+    std::vector<std::string> keys = makeUrls(count);
+    std::vector<std::string> probes(keys.begin(), keys.end());
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+    size_t keyBytes = 0;
+    for (const std::string& key : keys) keyBytes += key.size();
+
+    std::cout << "-- " << keys.size() << " keys, average length " << keyBytes / keys.size() << " --\n";
+    benchContainer(
+        "[Tree::Trie]        ", keys, probes,
+        [](auto run) {
+            Tree::Trie<uint64_t> trie;
+            run(trie, [](auto& t, const std::string& key, size_t i) { t.insert(key, i); });
+        },
+        [](auto& t, const std::string& key) { return *t.find(key); });
+    benchContainer(
+        "[std::unordered_map]", keys, probes,
+        [](auto run) {
+            std::unordered_map<std::string, uint64_t> map;
+            run(map, [](auto& m, const std::string& key, size_t i) { m.emplace(key, i); });
+        },
+        [](auto& m, const std::string& key) { return m.find(key)->second; });
+    benchContainer(
+        "[std::map]          ", keys, probes,
+        [](auto run) {
+            std::map<std::string, uint64_t> map;
+            run(map, [](auto& m, const std::string& key, size_t i) { m.emplace(key, i); });
+        },
+        [](auto& m, const std::string& key) { return m.find(key)->second; });
+
+    // FrozenTrie 由有序序列一次性构建；分别在内存中的镜像与映射的文件上查找
+    std::vector<std::pair<std::string_view, uint64_t>> sorted;
+    sorted.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) sorted.emplace_back(keys[i], i);
+    std::sort(sorted.begin(), sorted.end());
+    Tree::FrozenTrie<uint64_t> frozen;
+    long long buildMs = timeMs([&] { frozen.build(sorted.begin(), sorted.end()); });
+    sorted = std::vector<std::pair<std::string_view, uint64_t>>();
+    unsigned long long checksum = 0;
+    long long lookupMs = timeMs([&] {
+        for (const std::string& probe : probes) checksum += *frozen.find(probe);
+    });
+    std::cout << "[Tree::FrozenTrie]  build: " << buildMs << " ms, lookup x" << probes.size() << ": " << lookupMs
+              << " ms, " << static_cast<double>(frozen.memory_usage()) / static_cast<double>(keys.size())
+              << " bytes/key, " << frozen.node_count() << " nodes (checksum " << checksum << ")\n";
+
+    std::string path = (std::filesystem::temp_directory_path() / "frozen_trie_bench.bin").string();
+    frozen.save(path);
+    frozen.close();
+    auto start = std::chrono::high_resolution_clock::now();
+    Tree::FrozenTrie<uint64_t> mapped(path);
+    auto opened = std::chrono::high_resolution_clock::now();
+    checksum = 0;
+    lookupMs = timeMs([&] {
+        for (const std::string& probe : probes) checksum += *mapped.find(probe);
+    });
+    std::cout << "[FrozenTrie mapped]  open: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(opened - start).count() << " us, lookup x"
+              << probes.size() << ": " << lookupMs << " ms (checksum " << checksum << ")\n";
+    mapped.close();
+    std::filesystem::remove(path);
+
+    // 路由表式的最长前缀匹配：把一部分键当作路由前缀，查询时在原键后追加路径
+    Tree::Trie<uint64_t> routes;
+    for (size_t i = 0; i < keys.size(); i += 4) routes.insert(keys[i], i);
+    size_t hits = 0;
+    long long prefixMs = timeMs([&] {
+        for (const std::string& probe : probes) hits += routes.longest_prefix(probe + "/x").second != nullptr;
+    });
+    std::cout << "[Tree::Trie] longest_prefix x" << probes.size() << ": " << prefixMs << " ms (" << hits << " hits)\n";
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大键数（默认 10M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testInsertAndErase();
+    allPassed &= testNodeGrowth();
+    allPassed &= testPrefixQueries();
+    allPassed &= testCopyMoveAllocator();
+    allPassed &= testFrozenTrie();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 10000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 100000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,288 @@
+#include <Linear/UnrolledList.hpp>
+#include <Linear/DoublyList.hpp>
+#include <Linear/Vector.hpp>
+#include <vector>
+#include <list>
+#include <string>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+
+// 自定义测试宏
+#define CHECK(condition, message) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "\033[31m[FAIL]\033[0m Line " << __LINE__ << ": " << message << "\n"; \
+            return false; \
+        } else { \
+            std::cout << "\033[32m[PASS]\033[0m " << message << "\n"; \
+        } \
+    } while(0)
+
+// 辅助函数：将链表转换为 vector 方便比较
+template <typename ListType>
+auto listToVector(ListType& list) {
+    std::vector<std::decay_t<decltype(*list.begin())>> result;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
+// ------------------------- 测试用例 -------------------------
+
+// 测试 1：基础插入和遍历（块容量取 4，便于触发拆分）
+bool testPushAndIterate() {
+    Linear::UnrolledList<int, 4> list;
+    std::vector<int> expected;
+    for (int i = 0; i < 10; i++) {
+        list.push_back(i);
+        expected.push_back(i);
+    }
+    list.push_front(-1);
+    expected.insert(expected.begin(), -1);
+
+    CHECK(list.size() == 11, "Size should be 11");
+    CHECK(listToVector(list) == expected, "Elements in order");
+
+    std::vector<int> backwards;
+    auto it = list.end();
+    while (it != list.begin()) {
+        --it;
+        backwards.push_back(*it);
+    }
+    CHECK((backwards == std::vector<int>(expected.rbegin(), expected.rend())), "Reverse traversal");
+
+    return true;
+}
+
+// 测试 2：按迭代器插入与删除
+bool testInsertAndErase() {
+    Linear::UnrolledList<int, 4> list;
+    std::vector<int> expected;
+    std::mt19937 rng(7);
+    bool matched = true;
+    for (int i = 0; i < 500; i++) {
+        size_t index = rng() % (expected.size() + 1);
+        auto it = list.begin();
+        for (size_t k = 0; k < index; k++) ++it;
+        auto inserted = list.insert(i, it);
+        expected.insert(expected.begin() + index, i);
+        matched &= *inserted == i;
+    }
+    CHECK(matched && listToVector(list) == expected, "Random position inserts");
+
+    for (int i = 0; i < 400; i++) {
+        size_t index = rng() % expected.size();
+        auto it = list.begin();
+        for (size_t k = 0; k < index; k++) ++it;
+        auto next = list.erase(it);
+        expected.erase(expected.begin() + index);
+        matched &= index < expected.size() ? *next == expected[index] : next == list.end();
+    }
+    CHECK(matched, "Erase returns the following element");
+    CHECK(list.size() == expected.size(), "Size after random erases");
+    CHECK(listToVector(list) == expected, "Random position erases");
+
+    list.pop_front();
+    list.pop_back();
+    expected.erase(expected.begin());
+    expected.pop_back();
+    CHECK(listToVector(list) == expected, "Pop front and back");
+
+    return true;
+}
+
+// 测试 3：splice 与 merge
+bool testSpliceAndMerge() {
+    Linear::UnrolledList<int, 4> list1, list2;
+    for (int i = 0; i < 6; i++) list1.push_back(i);
+    for (int i = 10; i < 13; i++) list2.push_back(i);
+
+    auto pos = list1.begin();
+    ++pos;
+    ++pos;
+    list1.splice(list2, pos);
+    CHECK((listToVector(list1) == std::vector<int>{0, 1, 10, 11, 12, 2, 3, 4, 5}), "Splice in the middle of a block");
+    CHECK(list2.empty(), "Source list empty after splice");
+
+    Linear::UnrolledList<int, 4> list3, list4;
+    for (int i = 0; i < 20; i += 2) list3.push_back(i);
+    for (int i = 1; i < 20; i += 4) list4.push_back(i);
+    list3.merge(list4);
+    CHECK((listToVector(list3) == std::vector<int>{0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 18}), "After merge");
+    CHECK(list4.empty() && list3.size() == 15, "Sizes after merge");
+
+    return true;
+}
+
+// 测试 4：去重、删除、反转与排序
+bool testAlgorithms() {
+    Linear::UnrolledList<std::string, 4> list;
+    for (const char* word : {"a", "a", "b", "c", "c", "c", "d", "a", "a"}) {
+        list.push_back(word);
+    }
+    list.unique();
+    CHECK((listToVector(list) == std::vector<std::string>{"a", "b", "c", "d", "a"}), "After unique");
+
+    list.remove("a");
+    CHECK((listToVector(list) == std::vector<std::string>{"b", "c", "d"}), "After remove");
+
+    list.reverse();
+    CHECK((listToVector(list) == std::vector<std::string>{"d", "c", "b"}), "After reverse");
+
+    Linear::UnrolledList<int, 8> numbers;
+    std::vector<int> expected;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 1000; i++) {
+        int v = static_cast<int>(rng() % 100);
+        numbers.push_back(v);
+        expected.push_back(v);
+    }
+    numbers.sort();
+    std::sort(expected.begin(), expected.end());
+    CHECK(listToVector(numbers) == expected, "Sort ascending");
+
+    numbers.sort([](const int& a, const int& b) { return a > b; });
+    std::reverse(expected.begin(), expected.end());
+    CHECK(listToVector(numbers) == expected, "Sort descending");
+
+    return true;
+}
+
+// 测试 5：拷贝、移动语义与原位构造
+bool testMoveAndEmplace() {
+    Linear::UnrolledList<std::string, 4> list;
+    for (int i = 0; i < 10; i++) {
+        list.emplace_back(3, static_cast<char>('a' + i));
+    }
+    list.emplace_front("front");
+    auto it = list.emplace(++list.begin(), "second");
+    CHECK(*it == "second" && list.front() == "front" && list.back() == "jjj" && list.size() == 12, "Emplace at both ends and in the middle");
+
+    Linear::UnrolledList<std::string, 4> copy(list);
+    Linear::UnrolledList<std::string, 4> moved(std::move(list));
+    CHECK(list.empty() && listToVector(copy) == listToVector(moved), "Copy and move constructors");
+    CHECK((std::is_nothrow_move_constructible<Linear::UnrolledList<std::string, 4>>::value),
+          "Move constructor is noexcept");
+
+    Linear::UnrolledList<std::string, 4> assigned;
+    assigned.push_back("x");
+    assigned = copy;
+    copy.front() = "changed";
+    CHECK(listToVector(assigned) == listToVector(moved), "Copy assignment is deep");
+
+    assigned = std::move(moved);
+    CHECK(moved.empty() && assigned.size() == 12 && assigned.front() == "front", "Move assignment");
+
+    std::string value = "moved-from";
+    assigned.push_back(std::move(value));
+    CHECK(value.empty() && assigned.back() == "moved-from", "Rvalue push_back moves");
+
+    return true;
+}
+
+// 测试 6：异常处理
+bool testExceptions() {
+    Linear::UnrolledList<int> list;
+    bool caught = false;
+    try {
+        list.back();
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    CHECK(caught, "Should throw out_of_range for back() on empty list");
+
+    return true;
+}
+
+// ------------------------- 性能对比 -------------------------
+template <typename ListType>
+void pushAll(ListType& list, const std::vector<int>& values) {
+    for (int v : values) list.push_back(v);
+}
+
+template <typename ListType>
+auto advance(ListType& list, size_t index) {
+    auto it = list.begin();
+    for (size_t i = 0; i < index; i++) ++it;
+    return it;
+}
+
+template <typename ListType>
+void benchList(const std::string& name, const std::vector<int>& values, const std::vector<size_t>& positions) {
+    ListType list;
+    pushAll(list, values);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t pos : positions) list.insert(0, advance(list, pos % list.size()));
+    auto t2 = std::chrono::high_resolution_clock::now();
+    list.sort();
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+    std::cout << "[" << name << "] scan: " << us(t0, t1) << " us, random insert x" << positions.size() << ": "
+              << us(t1, t2) << " us, sort: " << us(t2, t3) << " us (checksum " << sum << ")\n";
+}
+
+void benchVector(const std::vector<int>& values, const std::vector<size_t>& positions) {
+    Linear::Vector<int> vec;
+    pushAll(vec, values);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (auto it = vec.begin(); it != vec.end(); ++it) sum += *it;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t pos : positions) vec.insert(pos % vec.size(), 0);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::sort(&vec[0], &vec[0] + vec.size());
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+    std::cout << "[Vector] scan: " << us(t0, t1) << " us, random insert x" << positions.size() << ": "
+              << us(t1, t2) << " us, sort: " << us(t2, t3) << " us (checksum " << sum << ")\n";
+}
+
+void testPerformance(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<int> values(count);
+    for (int& v : values) v = static_cast<int>(rng());
+    std::vector<size_t> positions(100);
+    for (size_t& p : positions) p = rng();
+
+    std::cout << "-- " << count << " elements --\n";
+    benchList<Linear::UnrolledList<int>>("UnrolledList", values, positions);
+    benchList<Linear::DoublyList<int>>("DoublyList", values, positions);
+    benchVector(values, positions);
+}
+
+// ------------------------- 主函数 -------------------------
+// 可选参数：性能测试的最大元素个数（默认 1M，可传 100000000 跑满 100M）
+int main(int argc, char* argv[]) {
+    bool allPassed = true;
+
+    allPassed &= testPushAndIterate();
+    allPassed &= testInsertAndErase();
+    allPassed &= testSpliceAndMerge();
+    allPassed &= testAlgorithms();
+    allPassed &= testMoveAndEmplace();
+    allPassed &= testExceptions();
+
+    if (allPassed) {
+        std::cout << "\033[32mAll tests passed!\033[0m\n";
+    } else {
+        std::cout << "\033[31mSome tests failed!\033[0m\n";
+    }
+
+    size_t maxCount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    std::cout << "\n=== Performance Comparison ===\n";
+    for (size_t count = 1000; count <= maxCount; count *= 10) {
+        testPerformance(count);
+    }
+
+    return allPassed ? 0 : 1;
+}
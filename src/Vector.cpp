@@ -1,9 +1,21 @@
 #include <Linear/Vector.hpp>
 #include <vector>
 #include <stdexcept>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <memory_resource>
+#include <sstream>
+#include <iterator>
+#if defined(_WIN32)
 #include <Windows.h>
 #include <psapi.h>
-#include <chrono>
+#elif defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
 
 // 自定义测试宏
 #define CHECK(condition, message) \
@@ -61,13 +73,17 @@ bool testEraseAndClear() {
 // 测试 3：边界条件
 bool testEdgeCases() {
     Linear::Vector<int> vec;
-    // 测试初始插入扩容
+    // 测试初始插入扩容：首次分配至少 32 字节
     vec.push_back(1);
-    CHECK(vec.capacity() == 1, "Initial capacity");
-    vec.push_back(2);
-    CHECK(vec.capacity() == 2, "Double capacity");
-    vec.push_back(3);
-    CHECK(vec.capacity() == 4, "Double capacity again");
+    CHECK(vec.capacity() == 8, "Initial capacity");
+    for (int i = 2; i <= 9; i++) {
+        vec.push_back(i);
+    }
+    CHECK(vec.capacity() == 16, "Double capacity");
+    for (int i = 10; i <= 17; i++) {
+        vec.push_back(i);
+    }
+    CHECK(vec.capacity() == 32, "Double capacity again");
 
     // 测试头部插入
     Linear::Vector<int> vec2;
@@ -158,14 +174,470 @@ bool testIterators() {
     --it2;
     CHECK(*it2 == 2, "Reverse traversal");
 
+    // 后缀 ++/-- 与 const 迭代器解引用，满足双向迭代器的要求
+    auto post = vec.begin();
+    CHECK(*post++ == "first" && *post == "second", "Postfix ++");
+    CHECK(*post-- == "second" && post == vec.begin(), "Postfix --");
+    const auto fixed = vec.begin();
+    CHECK(*fixed == "first" && fixed->size() == 5, "Dereference a const iterator");
+    std::vector<std::string> reversed(std::make_reverse_iterator(vec.end()), std::make_reverse_iterator(vec.begin()));
+    CHECK((reversed == std::vector<std::string>{"third", "second", "first"}), "std::reverse_iterator adapter");
+
+    return true;
+}
+
+// 测试 7：可按位搬移类型的快速路径
+struct Point {
+    int x;
+    int y;
+};
+
+struct Handle {
+    int* ptr;
+
+    explicit Handle(int v) : ptr(new int(v)) {}
+    Handle(const Handle& other) : ptr(new int(*other.ptr)) {}
+    Handle& operator=(const Handle& other) {
+        *ptr = *other.ptr;
+        return *this;
+    }
+    ~Handle() { delete ptr; }
+};
+
+namespace Linear {
+    template <>
+    struct is_trivially_relocatable<Handle> : std::true_type {};
+}
+
+bool testRelocation() {
+    Linear::Vector<Point> points;
+    for (int i = 0; i < 100; i++) {
+        points.push_back(Point{i, -i});
+    }
+    points.insert(50, Point{1000, 1000});
+    points.erase(0);
+    CHECK(points.size() == 100, "Trivially copyable size after insert/erase");
+    CHECK(points[0].x == 1 && points[49].x == 1000 && points[50].x == 50, "Trivially copyable elements shifted");
+
+    Linear::Vector<Handle> handles;
+    for (int i = 0; i < 10; i++) {
+        handles.push_back(Handle(i));
+    }
+    handles.insert(5, Handle(42));
+    handles.erase(0);
+    CHECK(*handles[0].ptr == 1 && *handles[4].ptr == 42 && *handles[9].ptr == 9, "Opt-in relocatable elements");
+
+    Linear::Vector<std::string> words;
+    words.push_back("b");
+    words.push_back("d");
+    words.insert(1, "c");
+    words.insert(0, "a");
+    words.insert(4, "e");
+    words.erase(2);
+    CHECK(words.size() == 4, "Non-trivial size after insert/erase");
+    CHECK(words[0] == "a" && words[1] == "b" && words[2] == "d" && words[3] == "e", "Non-trivial elements shifted");
+
+    return true;
+}
+
+// 测试 8：自定义分配器
+bool testAllocator() {
+    std::pmr::monotonic_buffer_resource arena;
+    Linear::Vector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> vec{
+        std::pmr::polymorphic_allocator<std::pmr::string>(&arena)};
+    vec.push_back("a long string that does not fit into the small string buffer");
+    vec.push_back("b");
+    vec.insert(1, "c");
+    vec.erase(0);
+    CHECK(vec.size() == 2 && vec[0] == "c" && vec[1] == "b", "Vector with polymorphic allocator");
+    CHECK(vec.get_allocator().resource() == &arena, "Allocator resource is kept");
+
+    return true;
+}
+
+// 测试 9：排序与并行排序
+// 统计存活实例数，用来确认并行排序在比较器抛出异常时析构了临时缓冲区中的元素
+struct Tracked {
+    static std::atomic<int> live;
+    int value;
+
+    explicit Tracked(int v) : value(v) { live++; }
+    Tracked(const Tracked& other) : value(other.value) { live++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { live++; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { live--; }
+};
+std::atomic<int> Tracked::live{0};
+
+// 比较次数达到 limit 时抛出异常，limit 为 0 时只计数
+bool sortThrowsAt(size_t limit, size_t& calls) {
+    std::atomic<size_t> count{0};
+    Linear::Vector<Tracked> tracked;
+    for (int i = 0; i < 4000; i++) {
+        tracked.emplace_back((i * 7919) % 4000);
+    }
+    bool thrown = false;
+    try {
+        tracked.sort(Linear::execution::parallel_policy{4, 0}, [&](const Tracked& a, const Tracked& b) {
+            if (++count == limit) throw std::runtime_error("comparator failed");
+            return a.value < b.value;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    calls = count;
+    return thrown == (limit != 0) && Tracked::live == static_cast<int>(tracked.size());
+}
+
+bool testSort() {
+    std::mt19937 rng(5);
+    std::vector<int> expected;
+    Linear::Vector<int> vec;
+    for (int i = 0; i < 100000; i++) {
+        int v = static_cast<int>(rng() % 1000);
+        vec.push_back(v);
+        expected.push_back(v);
+    }
+
+    Linear::Vector<int> serial(vec);
+    serial.sort();
+    std::sort(expected.begin(), expected.end());
+    CHECK((std::equal(expected.begin(), expected.end(), &serial[0])), "Serial sort");
+
+    for (size_t threads : {2, 3, 4, 8}) {
+        Linear::Vector<int> parallel(vec);
+        parallel.sort(Linear::execution::parallel_policy{threads, 0});
+        CHECK((std::equal(expected.begin(), expected.end(), &parallel[0])), "Parallel sort with " + std::to_string(threads) + " threads");
+    }
+
+    Linear::Vector<std::string> words;
+    for (int i = 0; i < 5000; i++) {
+        words.push_back(std::to_string(rng() % 100000));
+    }
+    words.sort(Linear::execution::parallel_policy{4, 0}, [](const std::string& a, const std::string& b) { return a > b; });
+    bool descending = true;
+    for (size_t i = 1; i < words.size(); i++) {
+        descending &= !(words[i - 1] < words[i]);
+    }
+    CHECK(descending && words.size() == 5000, "Parallel sort of strings with comparator");
+
+    Linear::Vector<int> small;
+    small.push_back(2);
+    small.push_back(1);
+    small.sort(Linear::execution::par);
+    CHECK(small[0] == 1 && small[1] == 2, "Parallel sort falls back below threshold");
+
+    // 分块排序阶段与最后一轮归并中抛出异常都不能泄漏缓冲区中的元素
+    size_t total = 0;
+    CHECK(sortThrowsAt(0, total) && total > 100, "Parallel sort keeps every element");
+    size_t calls = 0;
+    CHECK(sortThrowsAt(100, calls) && sortThrowsAt(total - 10, calls) && Tracked::live == 0,
+          "Parallel sort destroys the buffer when the comparator throws");
+
+    return true;
+}
+
+// 测试 10：移动语义与原位构造
+struct Counted {
+    static int copies;
+    static int moves;
+    int value;
+
+    explicit Counted(int v) : value(v) {}
+    Counted(int a, int b) : value(a + b) {}
+    Counted(const Counted& other) : value(other.value) { copies++; }
+    Counted(Counted&& other) noexcept : value(other.value) { moves++; }
+    Counted& operator=(const Counted& other) {
+        value = other.value;
+        copies++;
+        return *this;
+    }
+    Counted& operator=(Counted&& other) noexcept {
+        value = other.value;
+        moves++;
+        return *this;
+    }
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+Linear::Vector<Counted> makeCounted(int count) {
+    Linear::Vector<Counted> vec;
+    vec.reserve(count);
+    for (int i = 0; i < count; i++) {
+        vec.emplace_back(i);
+    }
+    return vec;
+}
+
+bool testMoveAndEmplace() {
+    Counted::reset();
+    Linear::Vector<Counted> vec = makeCounted(100);
+    CHECK(Counted::copies == 0 && Counted::moves == 0, "Emplace and return by value do not copy");
+
+    Linear::Vector<Counted> moved(std::move(vec));
+    CHECK(moved.size() == 100 && vec.size() == 0 && vec.capacity() == 0, "Move constructor steals the buffer");
+    CHECK(Counted::copies == 0 && Counted::moves == 0, "Move constructor does not touch elements");
+
+    Linear::Vector<Counted> assigned;
+    assigned.emplace_back(1);
+    assigned = std::move(moved);
+    CHECK(assigned.size() == 100 && assigned[99].value == 99 && moved.empty(), "Move assignment");
+    CHECK(Counted::copies == 0 && Counted::moves == 0, "Move assignment does not touch elements");
+
+    Counted::reset();
+    assigned.emplace(0, 3, 4);
+    CHECK(assigned[0].value == 7 && assigned.size() == 101 && Counted::copies == 0, "Emplace in the middle without copies");
+
+    Counted::reset();
+    Linear::Vector<Counted> grow;
+    for (int i = 0; i < 1000; i++) {
+        grow.push_back(Counted(i));
+    }
+    CHECK(Counted::copies == 0, "push_back of rvalues and growth only move");
+
+    Linear::Vector<std::string> words;
+    words.push_back("self");
+    for (int i = 0; i < 10; i++) {
+        words.emplace_back(words[0]);
+    }
+    CHECK(words.size() == 11 && words[10] == "self", "Emplace of an element of the same vector during growth");
+
+    std::pmr::monotonic_buffer_resource arena1, arena2;
+    using PmrVector = Linear::Vector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+    PmrVector left(&arena1), right(&arena2);
+    right.push_back("x");
+    left = std::move(right);
+    CHECK(left.size() == 1 && left[0] == "x" && left.get_allocator().resource() == &arena1, "Move assignment with unequal allocators");
+
+    return true;
+}
+
+// 测试 11：扩容策略
+template <typename VecType>
+std::vector<size_t> capacitySteps(int count) {
+    VecType vec;
+    std::vector<size_t> steps;
+    for (int i = 0; i < count; i++) {
+        vec.push_back(i);
+        if (steps.empty() || steps.back() != vec.capacity()) steps.push_back(vec.capacity());
+    }
+    return steps;
+}
+
+bool testGrowthPolicy() {
+    using Doubling = Linear::Vector<int, std::allocator<int>, Linear::growth::doubling>;
+    using OneAndHalf = Linear::Vector<int, std::allocator<int>, Linear::growth::one_and_half>;
+    using SizeClass = Linear::Vector<int, std::allocator<int>, Linear::growth::size_class>;
+
+    CHECK((capacitySteps<Doubling>(100) == std::vector<size_t>{8, 16, 32, 64, 128}), "Doubling growth");
+    CHECK((capacitySteps<OneAndHalf>(100) == std::vector<size_t>{8, 12, 18, 27, 41, 62, 93, 140}), "1.5x growth");
+    CHECK((capacitySteps<SizeClass>(100) == std::vector<size_t>{8, 12, 20, 32, 48, 80, 128}), "Size class growth");
+
+    // 超过一页后按整页取整
+    CHECK(Linear::growth::size_class::next(2000, 2001, 4) * 4 % Linear::growth::kPageBytes == 0, "Page aligned growth");
+    CHECK(Linear::growth::size_class::round_bytes(129) == 160 && Linear::growth::size_class::round_bytes(4096) == 4096,
+          "Size class rounding");
+
+    // 大元素首次分配不少于一个
+    struct Big {
+        char bytes[100];
+    };
+    CHECK(Linear::growth::doubling::next(0, 1, sizeof(Big)) == 1, "Large element first capacity");
+
+    SizeClass vec;
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    vec.erase(0);
+    vec.insert(500, -1);
+    CHECK(vec.size() == 1000 && vec[0] == 1 && vec[500] == -1 && vec[999] == 999, "Vector with size class growth");
+
+    vec.shrink_to_fit();
+    CHECK(vec.capacity() == 1000 && vec[999] == 999, "Shrink to fit");
+
+    vec.reserve_amortized(1001);
+    CHECK(vec.capacity() > 1001 && vec.capacity() == Linear::growth::size_class::next(1000, 1001, sizeof(int)),
+          "Amortized reserve follows the growth policy");
+    vec.reserve_amortized(500);
+    CHECK(vec.capacity() > 1001, "Amortized reserve never shrinks");
+
+    return true;
+}
+
+// 测试 12：批量区间操作
+template <typename VecType, typename T>
+bool sameElements(VecType& vec, const std::vector<T>& expected) {
+    return vec.size() == expected.size() && std::equal(expected.begin(), expected.end(), vec.begin());
+}
+
+struct ThrowOnCopy {
+    static int budget;
+    int value;
+
+    explicit ThrowOnCopy(int v) : value(v) {}
+    ThrowOnCopy(const ThrowOnCopy& other) : value(other.value) {
+        if (--budget < 0) throw std::runtime_error("copy failed");
+    }
+    ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+};
+int ThrowOnCopy::budget = 0;
+
+bool testRangeOperations() {
+    Linear::Vector<int> vec;
+    std::vector<int> source{1, 2, 3, 4, 5};
+    vec.append(source.begin(), source.end());
+    std::istringstream input("6 7 8");
+    vec.append(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    CHECK((sameElements(vec, std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8})), "Append forward and input ranges");
+
+    std::vector<int> middle{10, 11, 12};
+    vec.insert(2, middle.begin(), middle.end());
+    std::istringstream front("-2 -1");
+    vec.insert(0, std::istream_iterator<int>(front), std::istream_iterator<int>());
+    CHECK((sameElements(vec, std::vector<int>{-2, -1, 1, 2, 10, 11, 12, 3, 4, 5, 6, 7, 8})), "Insert forward and input ranges");
+
+    vec.erase(2, 7);
+    CHECK((sameElements(vec, std::vector<int>{-2, -1, 3, 4, 5, 6, 7, 8})), "Erase index range");
+
+    size_t removed = vec.erase_if([](int v) { return v % 2 == 0; });
+    CHECK(removed == 4 && (sameElements(vec, std::vector<int>{-1, 3, 5, 7})), "Erase if");
+
+    vec.assign(3, 9);
+    CHECK((sameElements(vec, std::vector<int>{9, 9, 9})), "Assign count copies");
+    vec.assign(source.begin(), source.begin() + 2);
+    CHECK((sameElements(vec, std::vector<int>{1, 2})), "Assign range");
+
+    vec.resize(4);
+    CHECK((sameElements(vec, std::vector<int>{1, 2, 0, 0})), "Resize grows with value initialised elements");
+    vec.resize(1);
+    vec.resize(100, vec[0]);
+    CHECK(vec.size() == 100 && vec[99] == 1, "Resize with a value from the same vector");
+
+    // 与 std::vector 对照的随机批量编辑，覆盖原地插入的两种情况与扩容插入
+    std::mt19937 rng(17);
+    Linear::Vector<std::string> words;
+    std::vector<std::string> expected;
+    for (int round = 0; round < 300; round++) {
+        std::vector<std::string> batch(rng() % 8);
+        for (std::string& word : batch) word = "w" + std::to_string(rng() % 1000);
+        size_t index = rng() % (expected.size() + 1);
+        switch (rng() % 4) {
+        case 0:
+        case 1:
+            words.insert(index, batch.begin(), batch.end());
+            expected.insert(expected.begin() + index, batch.begin(), batch.end());
+            break;
+        case 2: {
+            size_t last = std::min(expected.size(), index + rng() % 6);
+            words.erase(index, last);
+            expected.erase(expected.begin() + index, expected.begin() + last);
+            break;
+        }
+        default:
+            words.append(batch.begin(), batch.end());
+            expected.insert(expected.end(), batch.begin(), batch.end());
+            break;
+        }
+    }
+    CHECK(sameElements(words, expected), "Random batch edits match std::vector");
+
+    // 扩容插入失败时原内容不变
+    ThrowOnCopy::budget = 1 << 30;
+    Linear::Vector<ThrowOnCopy> guarded;
+    for (int i = 0; i < 4; i++) {
+        guarded.emplace_back(i);
+    }
+    guarded.resize(guarded.capacity(), ThrowOnCopy(7));
+    std::vector<ThrowOnCopy> batch(3, ThrowOnCopy(9));
+    ThrowOnCopy::budget = 2;
+    bool caught = false;
+    try {
+        guarded.insert(1, batch.begin(), batch.end());
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    ThrowOnCopy::budget = 1 << 30;
+    CHECK(caught && guarded.size() == guarded.capacity() && guarded[1].value == 1, "Failed reallocating insert leaves vector unchanged");
+
+    return true;
+}
+
+// 测试 13：操作计数策略
+bool testStats() {
+    using CountedVector = Linear::Vector<int, std::allocator<int>, Linear::growth::doubling, Linear::stats::counting>;
+    using PlainVector = Linear::Vector<int, std::allocator<int>, Linear::growth::doubling, Linear::stats::none>;
+    CHECK(sizeof(PlainVector) < sizeof(CountedVector), "Disabled stats take no space");
+
+    Linear::stats::Counters before = Linear::stats::registry().total("Linear::Vector");
+    {
+        CountedVector vec;
+        vec.reserve(16);
+        CHECK(vec.stats().reallocations == 1 && vec.stats().relocated_bytes == 0, "Reserve counts one empty reallocation");
+
+        for (int i = 0; i < 10; i++) {
+            vec.push_back(i);
+        }
+        CHECK(vec.stats().copies == 10 && vec.stats().reallocations == 1, "Push back of lvalues counts copies");
+
+        int value = 42;
+        vec.insert(0, value);
+        CHECK(vec.stats().copies == 11 && vec.stats().moves == 11, "Insert at front counts the shift");
+
+        vec.erase(0);
+        CHECK(vec.stats().moves == 21, "Erase at front counts the shift");
+
+        for (int i = 0; i < 7; i++) {
+            vec.push_back(i);
+        }
+        CHECK(vec.stats().reallocations == 2 && vec.stats().relocated_bytes == 16 * sizeof(int),
+              "Growth counts relocated bytes");
+
+        vec.sort();
+        CHECK(vec.stats().comparisons > 0, "Sort counts comparisons");
+
+        CountedVector copy(vec);
+        CHECK(copy.stats().copies == vec.size() && copy.stats().comparisons == 0, "Copy starts with fresh counters");
+
+        Linear::stats::Counters live = Linear::stats::registry().total("Linear::Vector") - before;
+        CHECK(live.copies == vec.stats().copies + copy.stats().copies, "Registry sums live vectors");
+    }
+    Linear::stats::Counters retired = Linear::stats::registry().total("Linear::Vector") - before;
+    CHECK(retired.reallocations >= 2 && retired.comparisons > 0, "Registry keeps counters of destroyed vectors");
+
+    std::ostringstream out;
+    Linear::stats::registry().dump(out);
+    CHECK(out.str().find("Linear::Vector") != std::string::npos, "Registry dump names the container");
+
+    PlainVector plain;
+    plain.push_back(1);
+    CHECK(plain.stats().copies == 0, "Disabled stats report zero");
+
     return true;
 }
 
 // ------------------------- 性能测试工具函数 -------------------------
+// 当前常驻内存（KB）：Windows 取工作集，Linux 读 /proc/self/statm，其他平台返回 0
 size_t getMemoryUsage() {
+#if defined(_WIN32)
     PROCESS_MEMORY_COUNTERS pmc;
     GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
-    return pmc.WorkingSetSize / 1024; // 返回 KB
+    return pmc.WorkingSetSize / 1024;
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0;
+    size_t resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+    return 0;
+#endif
 }
 
 template <typename VecType>
@@ -187,8 +659,121 @@ void testPerformance(const std::string& name, int count = 1000000) {
               << "Memory: " << (endMem - startMem) << " KB\n";
 }
 
+// ------------------------- 分配器对比 -------------------------
+template <typename MakeVec>
+void testAllocatorPerformance(const std::string& name, MakeVec makeVec, int rounds = 20000) {
+    // push 密集：大量短小 Vector 反复构造、扩容和释放
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        auto vec = makeVec();
+        for (int i = 0; i < 64; ++i) {
+            vec.push_back(i);
+        }
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    // erase 密集：填满后从中间逐个删除
+    for (int r = 0; r < rounds / 100; ++r) {
+        auto vec = makeVec();
+        for (int i = 0; i < 1000; ++i) {
+            vec.push_back(i);
+        }
+        while (!vec.empty()) {
+            vec.erase(vec.size() / 2);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "[" << name << "] push-heavy: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count() << " us, erase-heavy: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count() << " us\n";
+}
+
+// ------------------------- 批量编辑 -------------------------
+// 对 count 个元素做 10% 的批量插入、区间删除和分散删除；逐个操作的对照组在 count 较大时为 O(k·n)，只在小规模时运行
+void testBatchEdits(size_t count) {
+    size_t batch = count / 10;
+    std::mt19937 rng(23);
+    std::vector<int> source(count), incoming(batch);
+    for (int& v : source) v = static_cast<int>(rng());
+    for (int& v : incoming) v = static_cast<int>(rng());
+    bool runSingle = count <= 100000;
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+
+    std::cout << "-- " << count << " elements, batch of " << batch << " --\n";
+
+    {
+        Linear::Vector<int> vec;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        vec.append(source.begin(), source.end());
+        auto t1 = std::chrono::high_resolution_clock::now();
+        vec.insert(count / 2, incoming.begin(), incoming.end());
+        auto t2 = std::chrono::high_resolution_clock::now();
+        vec.erase(count / 4, count / 4 + batch);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        vec.erase_if([](int v) { return v % 10 == 0; });
+        auto t4 = std::chrono::high_resolution_clock::now();
+        std::cout << "[Linear::Vector range] append: " << us(t0, t1) << " us, insert: " << us(t1, t2)
+                  << " us, erase range: " << us(t2, t3) << " us, erase_if: " << us(t3, t4) << " us\n";
+    }
+
+    {
+        std::vector<int> vec;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        vec.insert(vec.end(), source.begin(), source.end());
+        auto t1 = std::chrono::high_resolution_clock::now();
+        vec.insert(vec.begin() + count / 2, incoming.begin(), incoming.end());
+        auto t2 = std::chrono::high_resolution_clock::now();
+        vec.erase(vec.begin() + count / 4, vec.begin() + count / 4 + batch);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        vec.erase(std::remove_if(vec.begin(), vec.end(), [](int v) { return v % 10 == 0; }), vec.end());
+        auto t4 = std::chrono::high_resolution_clock::now();
+        std::cout << "[std::vector range]    append: " << us(t0, t1) << " us, insert: " << us(t1, t2)
+                  << " us, erase range: " << us(t2, t3) << " us, erase_if: " << us(t3, t4) << " us\n";
+    }
+
+    if (!runSingle) return;
+    {
+        Linear::Vector<int> vec;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int v : source) vec.push_back(v);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < batch; i++) vec.insert(count / 2 + i, incoming[i]);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < batch; i++) vec.erase(count / 4);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (size_t i = vec.size(); i > 0; i--) {
+            if (vec[i - 1] % 10 == 0) vec.erase(i - 1);
+        }
+        auto t4 = std::chrono::high_resolution_clock::now();
+        std::cout << "[Linear::Vector single] append: " << us(t0, t1) << " us, insert: " << us(t1, t2)
+                  << " us, erase range: " << us(t2, t3) << " us, erase_if: " << us(t3, t4) << " us\n";
+    }
+}
+
+// ------------------------- 并行排序扩展性 -------------------------
+void testSortScaling(size_t count) {
+    std::mt19937 rng(99);
+    Linear::Vector<int> source;
+    source.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        source.push_back(static_cast<int>(rng()));
+    }
+
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= cores; threads *= 2) {
+        Linear::Vector<int> vec(source);
+        auto start = std::chrono::high_resolution_clock::now();
+        vec.sort(Linear::execution::parallel_policy{threads});
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "[sort " << count << " ints] threads: " << threads << ", time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+    }
+}
+
 // ------------------------- 主函数 -------------------------
-int main() {
+// 可选参数：并行排序扩展性测试的元素个数（默认 10M）
+int main(int argc, char* argv[]) {
     bool allPassed = true;
 
     std::cout << "=== Running Vector tests ===\n";
@@ -198,6 +783,13 @@ int main() {
     allPassed &= testCopyAndAssignment();
     allPassed &= testExceptions();
     allPassed &= testIterators();
+    allPassed &= testRelocation();
+    allPassed &= testAllocator();
+    allPassed &= testSort();
+    allPassed &= testMoveAndEmplace();
+    allPassed &= testGrowthPolicy();
+    allPassed &= testRangeOperations();
+    allPassed &= testStats();
 
     if (allPassed) {
         std::cout << "\n\033[32mAll tests passed!\033[0m\n\n";
@@ -212,5 +804,20 @@ int main() {
     std::cout << "\n-- std::vector --\n";
     testPerformance<std::vector<int>>("std::vector");
 
-    return 0;
+    std::cout << "\n=== Allocator Comparison ===\n";
+    using PmrVector = Linear::Vector<int, std::pmr::polymorphic_allocator<int>>;
+    testAllocatorPerformance("default", [] { return Linear::Vector<int>(); });
+    std::pmr::monotonic_buffer_resource arena;
+    testAllocatorPerformance("monotonic", [&] { return PmrVector(&arena); });
+    std::pmr::unsynchronized_pool_resource pool;
+    testAllocatorPerformance("pool", [&] { return PmrVector(&pool); });
+
+    std::cout << "\n=== Batch Edits ===\n";
+    testBatchEdits(100000);
+    testBatchEdits(1000000);
+
+    std::cout << "\n=== Parallel Sort Scaling ===\n";
+    testSortScaling(argc > 1 ? std::stoull(argv[1]) : 10000000);
+
+    return allPassed ? 0 : 1;
 }
\ No newline at end of file